@@ -0,0 +1,272 @@
+/*
+ * archive.c - tar archives as a listing source (--source=tar:FILE)
+ * ----------------------------------------------------------------
+ * The archive's headers are read once, front to back, into an in-memory tree;
+ * member data is skipped.  Understands ustar (with the prefix field), GNU
+ * long names and pax extended headers, which covers what GNU tar, bsdtar and
+ * most libraries write.  Compressed archives are not read: pipe them through
+ * the decompressor and give "-" as FILE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef __linux__
+#include <sys/sysmacros.h>
+#endif
+#include "gls.h"
+#include "backend.h"
+
+#define TAR_BLOCK 512
+
+typedef struct {
+    char name[100];
+    char mode[8];
+    char uid[8];
+    char gid[8];
+    char size[12];
+    char mtime[12];
+    char chksum[8];
+    char typeflag;
+    char linkname[100];
+    char magic[6];
+    char version[2];
+    char uname[32];
+    char gname[32];
+    char devmajor[8];
+    char devminor[8];
+    char prefix[155];
+    char pad[12];
+} TarHeader;
+
+// Values carried from GNU long-name and pax headers to the next member.
+typedef struct {
+    char *path;
+    char *linkpath;
+    bool have_size, have_mtime, have_uid, have_gid;
+    long long size, mtime, uid, gid;
+} Overrides;
+
+// Octal, or base-256 when the top bit of the first byte is set.
+static long long parse_number(const char *field, size_t len) {
+    const unsigned char *p = (const unsigned char *)field;
+    long long v = 0;
+
+    if (len > 0 && (p[0] & 0x80)) {
+        v = p[0] & 0x3f;
+        for (size_t i = 1; i < len; i++) v = (v << 8) | p[i];
+        return v;
+    }
+    size_t i = 0;
+    while (i < len && (p[i] == ' ' || p[i] == '\0')) i++;
+    for (; i < len && p[i] >= '0' && p[i] <= '7'; i++) v = v * 8 + (p[i] - '0');
+    return v;
+}
+
+static bool checksum_ok(const unsigned char *block, const TarHeader *h) {
+    long long want = parse_number(h->chksum, sizeof(h->chksum));
+    long long sum = 0;
+    size_t off = offsetof(TarHeader, chksum);
+
+    for (size_t i = 0; i < TAR_BLOCK; i++)
+        sum += (i >= off && i < off + sizeof(h->chksum)) ? ' ' : block[i];
+    return sum == want;
+}
+
+static char *field_string(const char *field, size_t len) {
+    size_t n = strnlen(field, len);
+    char *s = xmalloc(n + 1);
+    memcpy(s, field, n);
+    s[n] = '\0';
+    return s;
+}
+
+static bool skip_bytes(FILE *fp, long long len) {
+    if (len == 0) return true;
+    if (fseeko(fp, (off_t)len, SEEK_CUR) == 0) return true;
+
+    char buf[TAR_BLOCK * 16];
+    while (len > 0) {
+        size_t n = len < (long long)sizeof(buf) ? (size_t)len : sizeof(buf);
+        if (fread(buf, 1, n, fp) != n) return false;
+        len -= (long long)n;
+    }
+    return true;
+}
+
+static long long padded(long long size) {
+    return (size + TAR_BLOCK - 1) / TAR_BLOCK * TAR_BLOCK;
+}
+
+// Read a member's data (a long name or pax header) into memory.
+static char *read_data(FILE *fp, long long size) {
+    if (size < 0 || size > 16 * 1024 * 1024) return NULL;
+    char *buf = xmalloc((size_t)size + 1);
+    if (fread(buf, 1, (size_t)size, fp) != (size_t)size ||
+        !skip_bytes(fp, padded(size) - size)) {
+        free(buf);
+        return NULL;
+    }
+    buf[size] = '\0';
+    return buf;
+}
+
+// pax records are "LEN key=value\n", LEN counting the whole record.
+static void parse_pax(const char *data, size_t size, Overrides *ov) {
+    size_t pos = 0;
+    while (pos < size) {
+        char *end;
+        long len = strtol(data + pos, &end, 10);
+        if (len <= 0 || (size_t)len > size - pos || *end != ' ') return;
+        const char *key = end + 1;
+        const char *rec_end = data + pos + len - 1;     // the '\n'
+        const char *eq = memchr(key, '=', (size_t)(rec_end - key));
+        if (eq) {
+            size_t klen = (size_t)(eq - key), vlen = (size_t)(rec_end - eq - 1);
+            char *value = xmalloc(vlen + 1);
+            memcpy(value, eq + 1, vlen);
+            value[vlen] = '\0';
+            if (klen == 4 && memcmp(key, "path", 4) == 0) {
+                free(ov->path);
+                ov->path = value;
+                value = NULL;
+            } else if (klen == 8 && memcmp(key, "linkpath", 8) == 0) {
+                free(ov->linkpath);
+                ov->linkpath = value;
+                value = NULL;
+            } else if (klen == 4 && memcmp(key, "size", 4) == 0) {
+                ov->size = atoll(value);
+                ov->have_size = true;
+            } else if (klen == 5 && memcmp(key, "mtime", 5) == 0) {
+                ov->mtime = atoll(value);
+                ov->have_mtime = true;
+            } else if (klen == 3 && memcmp(key, "uid", 3) == 0) {
+                ov->uid = atoll(value);
+                ov->have_uid = true;
+            } else if (klen == 3 && memcmp(key, "gid", 3) == 0) {
+                ov->gid = atoll(value);
+                ov->have_gid = true;
+            }
+            free(value);
+        }
+        pos += (size_t)len;
+    }
+}
+
+static mode_t type_bits(char typeflag) {
+    switch (typeflag) {
+        case '2': return S_IFLNK;
+        case '3': return S_IFCHR;
+        case '4': return S_IFBLK;
+        case '5': return S_IFDIR;
+        case '6': return S_IFIFO;
+        default:  return S_IFREG;
+    }
+}
+
+Backend *tar_backend(const char *file) {
+    bool use_stdin = strcmp(file, "-") == 0;
+    FILE *fp = use_stdin ? stdin : fopen(file, "rb");
+    if (!fp) {
+        perror(file);
+        return NULL;
+    }
+
+    MemTree *t = memtree_new();
+    Overrides ov = {0};
+    unsigned char block[TAR_BLOCK];
+    ino_t next_ino = 3;
+    bool ok = true;
+
+    while (fread(block, 1, TAR_BLOCK, fp) == TAR_BLOCK) {
+        const TarHeader *h = (const TarHeader *)block;
+        bool zero = true;
+        for (size_t i = 0; i < TAR_BLOCK && zero; i++) zero = block[i] == 0;
+        if (zero) break;
+        if (!checksum_ok(block, h)) {
+            ok = false;
+            break;
+        }
+
+        long long size = parse_number(h->size, sizeof(h->size));
+        if (h->typeflag == 'L' || h->typeflag == 'K' || h->typeflag == 'x') {
+            char *data = read_data(fp, size);
+            if (!data) {
+                ok = false;
+                break;
+            }
+            char **slot = h->typeflag == 'K' ? &ov.linkpath : &ov.path;
+            if (h->typeflag == 'x') {
+                parse_pax(data, (size_t)size, &ov);
+                free(data);
+            } else {
+                free(*slot);
+                *slot = data;
+            }
+            continue;
+        }
+        if (h->typeflag == 'g' || h->typeflag == 'V') {
+            if (!skip_bytes(fp, padded(size))) {
+                ok = false;
+                break;
+            }
+            continue;
+        }
+        if (ov.have_size) size = ov.size;
+
+        char path[PATH_MAX];
+        if (ov.path) {
+            snprintf(path, sizeof(path), "%s", ov.path);
+        } else if (memcmp(h->magic, "ustar", 5) == 0 && h->prefix[0]) {
+            snprintf(path, sizeof(path), "%.*s/%.*s",
+                     (int)strnlen(h->prefix, sizeof(h->prefix)), h->prefix,
+                     (int)strnlen(h->name, sizeof(h->name)), h->name);
+        } else {
+            snprintf(path, sizeof(path), "%.*s", (int)strnlen(h->name, sizeof(h->name)), h->name);
+        }
+
+        struct stat st = {0};
+        st.st_mode = type_bits(h->typeflag) | (mode_t)(parse_number(h->mode, sizeof(h->mode)) & 07777);
+        st.st_uid = (uid_t)(ov.have_uid ? ov.uid : parse_number(h->uid, sizeof(h->uid)));
+        st.st_gid = (gid_t)(ov.have_gid ? ov.gid : parse_number(h->gid, sizeof(h->gid)));
+        st.st_mtime = (time_t)(ov.have_mtime ? ov.mtime : parse_number(h->mtime, sizeof(h->mtime)));
+        st.st_atime = st.st_ctime = st.st_mtime;
+        st.st_nlink = S_ISDIR(st.st_mode) ? 2 : 1;
+        st.st_ino = next_ino++;
+        if (h->typeflag == '3' || h->typeflag == '4') {
+            st.st_rdev = makedev((unsigned)parse_number(h->devmajor, sizeof(h->devmajor)),
+                                 (unsigned)parse_number(h->devminor, sizeof(h->devminor)));
+        }
+
+        char *target = NULL;
+        if (h->typeflag == '2') {
+            target = ov.linkpath ? xstrdup(ov.linkpath)
+                                 : field_string(h->linkname, sizeof(h->linkname));
+            st.st_size = (off_t)strlen(target);
+        } else if (S_ISREG(st.st_mode) && h->typeflag != '1') {
+            st.st_size = (off_t)size;
+            st.st_blocks = (blkcnt_t)((size + 511) / 512);
+        } else if (S_ISDIR(st.st_mode)) {
+            st.st_size = 4096;
+            st.st_blocks = 8;
+        }
+        memtree_add(t, path, &st, target);
+        free(target);
+
+        // Hard links and special files carry no data.
+        long long data = (h->typeflag == '0' || h->typeflag == '\0' || h->typeflag == '7') ? size : 0;
+        free(ov.path);
+        free(ov.linkpath);
+        memset(&ov, 0, sizeof(ov));
+        if (!skip_bytes(fp, padded(data))) {
+            ok = false;
+            break;
+        }
+    }
+    free(ov.path);
+    free(ov.linkpath);
+    if (!use_stdin) fclose(fp);
+
+    if (!ok) fprintf(stderr, "Warning: %s: damaged or truncated tar archive; listing what was read\n", file);
+    return memtree_backend(t, "tar");
+}
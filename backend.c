@@ -0,0 +1,566 @@
+/*
+ * backend.c - Listing sources for --source
+ * ----------------------------------------
+ * The real filesystem, in-memory trees (which the tar and mock sources fill)
+ * and the dispatch from the pipeline to whichever source is active.  The
+ * snapshot source lives in snapshot.c next to the file format it reads.
+ *
+ * Each source takes its own shortcut for a stat batch: the filesystem opens
+ * the directory once and uses fstatat() on the leaf names, an in-memory tree
+ * finds the directory once and binary-searches its sorted children.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "gls.h"
+#include "backend.h"
+#include "hash.h"
+
+#define MAX_SYMLINK_HOPS 40
+#define MOCK_MAX_ENTRIES 50000000L
+
+// Only the filesystem is in use until backend_init() picks something else.
+static Backend fs_backend;
+static Backend *active = &fs_backend;
+
+static unsigned char mode_to_dtype(mode_t mode) {
+#ifdef DT_UNKNOWN
+    if (S_ISDIR(mode)) return DT_DIR;
+    if (S_ISREG(mode)) return DT_REG;
+    if (S_ISLNK(mode)) return DT_LNK;
+    if (S_ISCHR(mode)) return DT_CHR;
+    if (S_ISBLK(mode)) return DT_BLK;
+    if (S_ISFIFO(mode)) return DT_FIFO;
+    if (S_ISSOCK(mode)) return DT_SOCK;
+    return DT_UNKNOWN;
+#else
+    (void)mode;
+    return 0;
+#endif
+}
+
+// stat() for sources that only know lstat() and readlink().
+int backend_follow_links(Backend *b, const char *path, struct stat *st) {
+    char cur[PATH_MAX], target[PATH_MAX];
+
+    snprintf(cur, sizeof(cur), "%s", path);
+    for (int hop = 0; hop <= MAX_SYMLINK_HOPS; hop++) {
+        if (b->lstat(b, cur, st) != 0) return -1;
+        if (!S_ISLNK(st->st_mode)) return 0;
+
+        ssize_t n = b->readlink(b, cur, target, sizeof(target) - 1);
+        if (n < 0) return -1;
+        target[n] = '\0';
+        char *slash = strrchr(cur, '/');
+        if (target[0] == '/' || !slash) {
+            snprintf(cur, sizeof(cur), "%s", target);
+        } else {
+            size_t dir_len = (size_t)(slash - cur) + 1;
+            if (dir_len + (size_t)n >= sizeof(cur)) {
+                errno = ENAMETOOLONG;
+                return -1;
+            }
+            memcpy(cur + dir_len, target, (size_t)n + 1);
+        }
+    }
+    errno = ELOOP;
+    return -1;
+}
+
+// ========================================
+// Filesystem
+// ========================================
+
+static BackendDir *fs_open_dir(Backend *b, const char *path) {
+    (void)b;
+    DIR *dir = opendir(path);
+    if (!dir) return NULL;
+    BackendDir *d = xcalloc(1, sizeof(BackendDir));
+    d->handle = dir;
+    return d;
+}
+
+static int fs_next_batch(Backend *b, BackendDir *d, FileEntry *out, int max) {
+    struct dirent *entry;
+    int n = 0;
+
+    (void)b;
+    errno = 0;
+    while (n < max && (entry = readdir(d->handle)) != NULL) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+        out[n].name = xstrdup(entry->d_name);
+#ifdef DT_UNKNOWN
+        out[n].d_type = entry->d_type;
+#else
+        out[n].d_type = 0;
+#endif
+        n++;
+    }
+    return (n == 0 && errno != 0) ? -1 : n;
+}
+
+static void fs_close_dir(Backend *b, BackendDir *d) {
+    (void)b;
+    closedir(d->handle);
+    free(d);
+}
+
+// One open() per batch, then fstatat() on leaf names: the kernel resolves
+// the directory once instead of walking the full path for every entry.
+static void fs_stat_batch(Backend *b, const char *dir, FileEntry *entries, int count, bool *ok) {
+    int dfd = open(dir, O_RDONLY | O_DIRECTORY);
+
+    (void)b;
+    for (int i = 0; i < count; i++) {
+        if (dfd >= 0) {
+            ok[i] = fstatat(dfd, entries[i].name, &entries[i].st, AT_SYMLINK_NOFOLLOW) == 0;
+        } else {
+            char fullpath[PATH_MAX];
+            join_path(fullpath, sizeof(fullpath), dir, entries[i].name);
+            ok[i] = lstat(fullpath, &entries[i].st) == 0;
+        }
+    }
+    if (dfd >= 0) close(dfd);
+}
+
+static int fs_lstat(Backend *b, const char *path, struct stat *st) {
+    (void)b;
+    return lstat(path, st);
+}
+
+static int fs_stat(Backend *b, const char *path, struct stat *st) {
+    (void)b;
+    return stat(path, st);
+}
+
+static ssize_t fs_readlink(Backend *b, const char *path, char *buf, size_t len) {
+    (void)b;
+    return readlink(path, buf, len);
+}
+
+static Backend fs_backend = {
+    .name = "fs",
+    .open_dir = fs_open_dir,
+    .next_batch = fs_next_batch,
+    .close_dir = fs_close_dir,
+    .stat_batch = fs_stat_batch,
+    .lstat = fs_lstat,
+    .stat = fs_stat,
+    .readlink = fs_readlink,
+};
+
+// ========================================
+// In-memory Trees
+// ========================================
+
+typedef struct MemNode {
+    char *name;
+    char *target;
+    struct stat st;
+    struct MemNode **children;  // sorted by name once the tree is sealed
+    int child_count;
+    int child_capacity;
+} MemNode;
+
+struct MemTree {
+    MemNode *root;
+    // Build-time index of every node by normalised path.
+    char **keys;
+    MemNode **nodes;
+    size_t slots;
+    size_t used;
+};
+
+static MemNode *new_mem_node(const char *name, const struct stat *st) {
+    MemNode *n = xcalloc(1, sizeof(MemNode));
+    n->name = xstrdup(name);
+    n->st = *st;
+    return n;
+}
+
+static struct stat implied_dir(const struct stat *like) {
+    struct stat st = *like;
+    st.st_mode = S_IFDIR | 0755;
+    st.st_nlink = 2;
+    st.st_size = 4096;
+    st.st_blocks = 8;
+    return st;
+}
+
+MemTree *memtree_new(void) {
+    MemTree *t = xcalloc(1, sizeof(MemTree));
+    struct stat st = {0};
+    st.st_uid = getuid();
+    st.st_gid = getgid();
+    st = implied_dir(&st);
+    t->root = new_mem_node(".", &st);
+    t->slots = 1024;
+    t->keys = xcalloc(t->slots, sizeof(char *));
+    t->nodes = xcalloc(t->slots, sizeof(MemNode *));
+    return t;
+}
+
+// Drop "./", repeated and trailing slashes and a leading "/"; "" is the root.
+static void normalise(char *dest, size_t len, const char *path) {
+    size_t n = 0;
+    while (*path && n + 1 < len) {
+        while (*path == '/') path++;
+        if (path[0] == '.' && (path[1] == '/' || path[1] == '\0')) {
+            path++;
+            continue;
+        }
+        if (n > 0 && *path) dest[n++] = '/';
+        while (*path && *path != '/' && n + 1 < len) dest[n++] = *path++;
+    }
+    dest[n] = '\0';
+}
+
+static size_t path_slot(const MemTree *t, const char *key) {
+    Hash128 h;
+    hash128_init(&h, 0);
+    hash128_update(&h, key, strlen(key));
+    size_t slot = hash128_final(&h).lo & (t->slots - 1);
+    while (t->keys[slot] && strcmp(t->keys[slot], key) != 0)
+        slot = (slot + 1) & (t->slots - 1);
+    return slot;
+}
+
+static void index_node(MemTree *t, const char *key, MemNode *node) {
+    if ((t->used + 1) * 2 > t->slots) {
+        char **old_keys = t->keys;
+        MemNode **old_nodes = t->nodes;
+        size_t old_slots = t->slots;
+        t->slots *= 2;
+        t->keys = xcalloc(t->slots, sizeof(char *));
+        t->nodes = xcalloc(t->slots, sizeof(MemNode *));
+        for (size_t i = 0; i < old_slots; i++) {
+            if (!old_keys[i]) continue;
+            size_t s = path_slot(t, old_keys[i]);
+            t->keys[s] = old_keys[i];
+            t->nodes[s] = old_nodes[i];
+        }
+        free(old_keys);
+        free(old_nodes);
+    }
+    size_t slot = path_slot(t, key);
+    t->keys[slot] = xstrdup(key);
+    t->nodes[slot] = node;
+    t->used++;
+}
+
+static void add_child(MemNode *parent, MemNode *child) {
+    if (parent->child_count >= parent->child_capacity) {
+        parent->child_capacity = parent->child_capacity ? parent->child_capacity * 2 : 8;
+        parent->children = xrealloc(parent->children,
+                                    (size_t)parent->child_capacity * sizeof(MemNode *));
+    }
+    parent->children[parent->child_count++] = child;
+}
+
+// Find or create the node for a normalised path.
+static MemNode *intern(MemTree *t, const char *key, const struct stat *like) {
+    if (key[0] == '\0') return t->root;
+
+    size_t slot = path_slot(t, key);
+    if (t->keys[slot]) return t->nodes[slot];
+
+    char parent_key[PATH_MAX];
+    snprintf(parent_key, sizeof(parent_key), "%s", key);
+    char *slash = strrchr(parent_key, '/');
+    const char *leaf = slash ? key + (slash - parent_key) + 1 : key;
+    if (slash) *slash = '\0';
+    else parent_key[0] = '\0';
+
+    struct stat dir_st = implied_dir(like);
+    MemNode *parent = intern(t, parent_key, like);
+    MemNode *node = new_mem_node(leaf, &dir_st);
+    add_child(parent, node);
+    index_node(t, key, node);
+    return node;
+}
+
+void memtree_add(MemTree *t, const char *path, const struct stat *st, const char *target) {
+    char key[PATH_MAX];
+
+    normalise(key, sizeof(key), path);
+    MemNode *node = intern(t, key, st);
+    node->st = *st;
+    free(node->target);
+    node->target = target ? xstrdup(target) : NULL;
+}
+
+static int compare_mem_nodes(const void *a, const void *b) {
+    return strcmp((*(MemNode *const *)a)->name, (*(MemNode *const *)b)->name);
+}
+
+// Sort children for lookups and derive directory link counts, which
+// archives do not record.
+static void seal_node(MemNode *node) {
+    qsort(node->children, (size_t)node->child_count, sizeof(MemNode *), compare_mem_nodes);
+    nlink_t links = 2;
+    for (int i = 0; i < node->child_count; i++) {
+        seal_node(node->children[i]);
+        if (S_ISDIR(node->children[i]->st.st_mode)) links++;
+    }
+    if (S_ISDIR(node->st.st_mode)) node->st.st_nlink = links;
+}
+
+static void free_mem_node(MemNode *node) {
+    for (int i = 0; i < node->child_count; i++) free_mem_node(node->children[i]);
+    free(node->children);
+    free(node->target);
+    free(node->name);
+    free(node);
+}
+
+static MemNode *find_child(const MemNode *dir, const char *name) {
+    int lo = 0, hi = dir->child_count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        int c = strcmp(dir->children[mid]->name, name);
+        if (c == 0) return dir->children[mid];
+        if (c < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+static MemNode *mem_lookup(Backend *b, const char *path) {
+    MemTree *t = b->state;
+    char key[PATH_MAX];
+    MemNode *node = t->root;
+
+    normalise(key, sizeof(key), path);
+    for (char *part = key, *next; node && *part; part = next) {
+        next = strchr(part, '/');
+        if (next) *next++ = '\0';
+        else next = part + strlen(part);
+        if (!S_ISDIR(node->st.st_mode)) {
+            errno = ENOTDIR;
+            return NULL;
+        }
+        node = find_child(node, part);
+    }
+    if (!node) errno = ENOENT;
+    return node;
+}
+
+static BackendDir *mem_open_dir(Backend *b, const char *path) {
+    MemNode *node = mem_lookup(b, path);
+    if (!node) return NULL;
+    if (!S_ISDIR(node->st.st_mode)) {
+        errno = ENOTDIR;
+        return NULL;
+    }
+    BackendDir *d = xcalloc(1, sizeof(BackendDir));
+    d->handle = node;
+    d->end = (uint64_t)node->child_count;
+    return d;
+}
+
+static int mem_next_batch(Backend *b, BackendDir *d, FileEntry *out, int max) {
+    const MemNode *dir = d->handle;
+    int n = 0;
+
+    (void)b;
+    while (n < max && d->pos < d->end) {
+        const MemNode *child = dir->children[d->pos++];
+        out[n].name = xstrdup(child->name);
+        out[n].d_type = mode_to_dtype(child->st.st_mode);
+        n++;
+    }
+    return n;
+}
+
+static void mem_close_dir(Backend *b, BackendDir *d) {
+    (void)b;
+    free(d);
+}
+
+static void mem_stat_batch(Backend *b, const char *dir, FileEntry *entries, int count, bool *ok) {
+    const MemNode *node = mem_lookup(b, dir);
+
+    for (int i = 0; i < count; i++) {
+        const MemNode *child = node ? find_child(node, entries[i].name) : NULL;
+        ok[i] = child != NULL;
+        if (child) entries[i].st = child->st;
+    }
+}
+
+static int mem_lstat(Backend *b, const char *path, struct stat *st) {
+    const MemNode *node = mem_lookup(b, path);
+    if (!node) return -1;
+    *st = node->st;
+    return 0;
+}
+
+static ssize_t mem_readlink(Backend *b, const char *path, char *buf, size_t len) {
+    const MemNode *node = mem_lookup(b, path);
+    if (!node) return -1;
+    if (!node->target) {
+        errno = EINVAL;
+        return -1;
+    }
+    size_t n = strlen(node->target);
+    if (n > len) n = len;
+    memcpy(buf, node->target, n);
+    return (ssize_t)n;
+}
+
+static void mem_destroy(Backend *b) {
+    MemTree *t = b->state;
+    free_mem_node(t->root);
+    free(t);
+    free(b);
+}
+
+Backend *memtree_backend(MemTree *t, const char *name) {
+    for (size_t i = 0; i < t->slots; i++) free(t->keys[i]);
+    free(t->keys);
+    free(t->nodes);
+    t->keys = NULL;
+    t->nodes = NULL;
+    seal_node(t->root);
+
+    Backend *b = xcalloc(1, sizeof(Backend));
+    b->name = name;
+    b->state = t;
+    b->open_dir = mem_open_dir;
+    b->next_batch = mem_next_batch;
+    b->close_dir = mem_close_dir;
+    b->stat_batch = mem_stat_batch;
+    b->lstat = mem_lstat;
+    b->readlink = mem_readlink;
+    b->destroy = mem_destroy;
+    return b;
+}
+
+// ========================================
+// Mock Trees
+// ========================================
+
+// A synthetic, fully deterministic tree: every directory down to DEPTH has
+// FANOUT subdirectories d0.. and FILES regular files f0.. of varied sizes.
+static void mock_fill(MemTree *t, const char *path, int depth, int fanout, int files,
+                      const struct stat *base, ino_t *next_ino) {
+    char child[PATH_MAX];
+    struct stat st = *base;
+
+    for (int i = 0; i < files; i++) {
+        snprintf(child, sizeof(child), "%s/f%d", path, i);
+        st.st_mode = S_IFREG | 0644;
+        st.st_nlink = 1;
+        st.st_size = (off_t)(((unsigned)i * 2654435761u) % 1048576u);
+        st.st_blocks = (st.st_size + 511) / 512;
+        st.st_mtime = base->st_mtime - i * 3600;
+        st.st_ino = (*next_ino)++;
+        memtree_add(t, child, &st, NULL);
+    }
+    if (depth == 0) return;
+    for (int i = 0; i < fanout; i++) {
+        snprintf(child, sizeof(child), "%s/d%d", path, i);
+        st = implied_dir(base);
+        st.st_ino = (*next_ino)++;
+        memtree_add(t, child, &st, NULL);
+        mock_fill(t, child, depth - 1, fanout, files, &st, next_ino);
+    }
+}
+
+static Backend *mock_backend(const char *spec) {
+    int depth, fanout, files;
+    char extra;
+
+    if (sscanf(spec, "%d,%d,%d%c", &depth, &fanout, &files, &extra) != 3 ||
+        depth < 0 || fanout < 0 || files < 0) {
+        fprintf(stderr, "Error: mock source needs DEPTH,FANOUT,FILES\n");
+        return NULL;
+    }
+    long dirs = 1, total = 0;
+    for (int d = 0; d <= depth && total <= MOCK_MAX_ENTRIES; d++) {
+        total += dirs * (files + (d < depth ? fanout : 0));
+        dirs *= fanout > 0 ? fanout : 1;
+        if (fanout == 0) break;
+    }
+    if (total > MOCK_MAX_ENTRIES) {
+        fprintf(stderr, "Error: mock tree too large (max %ld entries)\n", MOCK_MAX_ENTRIES);
+        return NULL;
+    }
+
+    MemTree *t = memtree_new();
+    struct stat base = t->root->st;
+    base.st_mtime = 1700000000;
+    base.st_ino = 2;
+    t->root->st = base;
+    ino_t next_ino = 3;
+    mock_fill(t, ".", depth, fanout, files, &base, &next_ino);
+    return memtree_backend(t, "mock");
+}
+
+// ========================================
+// Dispatch
+// ========================================
+
+int backend_init(const Options *opts) {
+    const char *spec = opts->source;
+    Backend *b = NULL;
+
+    if (!spec || strcmp(spec, "fs") == 0) return 0;
+    if (strncmp(spec, "snapshot:", 9) == 0) b = snapshot_backend(spec + 9);
+    else if (strncmp(spec, "tar:", 4) == 0) b = tar_backend(spec + 4);
+    else if (strncmp(spec, "mock:", 5) == 0) b = mock_backend(spec + 5);
+    else if (strncmp(spec, "replay:", 7) == 0) b = replay_backend(spec + 7, opts->replay_latency);
+    else fprintf(stderr, "Error: unknown source '%s'\n", spec);
+    if (!b) return 1;
+    active = b;
+    return 0;
+}
+
+void backend_shutdown(void) {
+    if (active != &fs_backend && active->destroy) active->destroy(active);
+    active = &fs_backend;
+}
+
+bool backend_is_fs(void) {
+    return active == &fs_backend;
+}
+
+Backend *backend_install(Backend *b) {
+    Backend *prev = active;
+    active = b;
+    return prev;
+}
+
+BackendDir *backend_open_dir(const char *path) {
+    return active->open_dir(active, path);
+}
+
+int backend_next_batch(BackendDir *dir, FileEntry *out, int max) {
+    return active->next_batch(active, dir, out, max);
+}
+
+void backend_close_dir(BackendDir *dir) {
+    active->close_dir(active, dir);
+}
+
+void backend_stat_batch(const char *dir, FileEntry *entries, int count, bool *ok) {
+    active->stat_batch(active, dir, entries, count, ok);
+}
+
+int backend_lstat(const char *path, struct stat *st) {
+    return active->lstat(active, path, st);
+}
+
+int backend_stat(const char *path, struct stat *st) {
+    if (active->stat) return active->stat(active, path, st);
+    return backend_follow_links(active, path, st);
+}
+
+ssize_t backend_readlink(const char *path, char *buf, size_t len) {
+    return active->readlink(active, path, buf, len);
+}
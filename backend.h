@@ -0,0 +1,101 @@
+#ifndef BACKEND_H
+#define BACKEND_H
+
+/*
+ * backend.h - Listing sources for --source
+ * ----------------------------------------
+ * Everything the listing pipeline reads about a tree goes through one
+ * Backend: open a directory, pull its names in batches, lstat a batch of
+ * entries, readlink.  Sorting and formatting never see where the metadata
+ * came from, so snapshots, archives and synthetic trees are listed exactly
+ * like the real filesystem.
+ *
+ * Calls may come from several walker threads at once.  A backend is fully
+ * built before the listing starts and only read afterwards.  Failures return
+ * -1 (or NULL) with errno set, like the system calls they stand in for.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "gls.h"
+
+// Entries requested per next_batch()/stat_batch() call by the pipeline.
+#define BACKEND_BATCH 256
+
+typedef struct Backend Backend;
+
+// An open directory; each source keeps its own cursor in it.
+typedef struct {
+    void *handle;           // e.g. the DIR * or the tree node
+    uint64_t pos;
+    uint64_t end;
+} BackendDir;
+
+struct Backend {
+    const char *name;
+    void *state;
+    BackendDir *(*open_dir)(Backend *b, const char *path);
+    // Fill name and d_type of up to `max` entries ("." and ".." excluded).
+    // Returns the number filled, 0 at the end, -1 on error.
+    int (*next_batch)(Backend *b, BackendDir *dir, FileEntry *out, int max);
+    void (*close_dir)(Backend *b, BackendDir *dir);
+    // lstat `count` entries of directory `dir` into their st fields;
+    // ok[i] is cleared for entries that no longer exist.
+    void (*stat_batch)(Backend *b, const char *dir, FileEntry *entries, int count, bool *ok);
+    int (*lstat)(Backend *b, const char *path, struct stat *st);
+    // Follows symlinks; NULL means resolve through lstat() and readlink().
+    int (*stat)(Backend *b, const char *path, struct stat *st);
+    // Like readlink(2): not NUL terminated, returns the length.
+    ssize_t (*readlink)(Backend *b, const char *path, char *buf, size_t len);
+    void (*destroy)(Backend *b);
+};
+
+// Select the source for this run from opts->source (NULL = filesystem):
+//   fs | snapshot:FILE | tar:FILE | mock:DEPTH,FANOUT,FILES | replay:FILE
+// Returns non-zero (with a message) if it cannot be opened.
+int backend_init(const Options *opts);
+void backend_shutdown(void);
+// True when reading the live filesystem, which some modes require.
+bool backend_is_fs(void);
+
+// Swap the active source for a wrapper around it (see capture.c); returns
+// the previous one.  Only valid before the listing starts.
+Backend *backend_install(Backend *b);
+
+// stat() resolved through b->lstat() and b->readlink(), for sources that
+// do not provide their own.
+int backend_follow_links(Backend *b, const char *path, struct stat *st);
+
+// The pipeline's calls, routed to the active backend.
+BackendDir *backend_open_dir(const char *path);
+int backend_next_batch(BackendDir *dir, FileEntry *out, int max);
+void backend_close_dir(BackendDir *dir);
+void backend_stat_batch(const char *dir, FileEntry *entries, int count, bool *ok);
+int backend_lstat(const char *path, struct stat *st);
+int backend_stat(const char *path, struct stat *st);
+ssize_t backend_readlink(const char *path, char *buf, size_t len);
+
+// ========================================
+// In-memory Trees
+// ========================================
+
+// A tree held in memory, used by the tar and mock sources.  Paths are
+// relative to the tree's root, which is "." (a leading "/" or "./" is
+// ignored).
+typedef struct MemTree MemTree;
+
+MemTree *memtree_new(void);
+// Add or replace one entry; missing parent directories are created.
+// `target` is the symlink target (NULL otherwise).
+void memtree_add(MemTree *t, const char *path, const struct stat *st, const char *target);
+// Wrap the tree as a backend, which takes ownership of it.
+Backend *memtree_backend(MemTree *t, const char *name);
+
+// Provided by the individual sources
+Backend *snapshot_backend(const char *file);
+Backend *tar_backend(const char *file);
+Backend *replay_backend(const char *file, bool timed);
+
+#endif
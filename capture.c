@@ -0,0 +1,714 @@
+/*
+ * capture.c - Recording listing I/O for --capture, replaying it as a source
+ * ------------------------------------------------------------------------
+ * File layout (native byte order): an 8-byte magic, an endian marker and
+ * flags, then one record per call in the order the calls completed:
+ *
+ *   u8 type, u64 nanoseconds, i32 errno, u32 path length, path
+ *   DIR    u32 count, then count x (u32 length, name, u8 d_type)
+ *   STATS  u32 count, then count x (u32 length, name, i32 errno, SnapStat)
+ *   LSTAT  SnapStat                      (STAT likewise, following links)
+ *   LINK   u32 length, target
+ *
+ * SnapStat is only present when the errno field is 0.  A DIR record covers
+ * the open and every batch of one enumeration; its time is their sum.
+ *
+ * Records are built on the calling worker thread and appended under one
+ * lock, so a capture costs a buffer copy and one fwrite() per call.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "gls.h"
+#include "backend.h"
+#include "capture.h"
+#include "snapshot.h"
+#include "timing.h"
+#include "hash.h"
+
+#define CAPTURE_MAGIC     "GLSCAPT1"
+#define CAPTURE_ENDIAN    0x01020304u
+#define CAPTURE_FLAG_HASH 0x1u
+
+enum { REC_DIR = 1, REC_STATS, REC_LSTAT, REC_STAT, REC_LINK };
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t capacity;
+} Buf;
+
+typedef struct {
+    FILE *fp;
+    const char *file;
+    pthread_mutex_t lock;
+    Backend wrapper;
+    Backend *inner;             // the source being recorded
+    bool hash_names;
+    uint64_t salt;
+    char **roots;               // operands, never hashed
+    int root_count;
+    long records;
+    bool failed;
+} Capture;
+
+static Capture cap = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+// One enumeration in progress.
+typedef struct {
+    BackendDir *inner;
+    BackendDir outer;
+    char *path;
+    Buf names;
+    uint32_t count;
+    uint64_t ns;
+} CaptureDir;
+
+// ========================================
+// Record Encoding
+// ========================================
+
+static void buf_put(Buf *b, const void *data, size_t len) {
+    if (b->len + len > b->capacity) {
+        b->capacity = (b->len + len) * 2;
+        b->data = xrealloc(b->data, b->capacity);
+    }
+    memcpy(b->data + b->len, data, len);
+    b->len += len;
+}
+
+static void buf_u32(Buf *b, uint32_t v) { buf_put(b, &v, sizeof(v)); }
+static void buf_i32(Buf *b, int32_t v) { buf_put(b, &v, sizeof(v)); }
+
+static void buf_str(Buf *b, const char *s) {
+    uint32_t len = (uint32_t)strlen(s);
+    buf_u32(b, len);
+    buf_put(b, s, len);
+}
+
+static void buf_stat(Buf *b, const struct stat *st) {
+    SnapStat ss;
+    snapstat_from(&ss, st);
+    buf_put(b, &ss, sizeof(ss));
+}
+
+// ========================================
+// Name Hashing
+// ========================================
+
+static void hash_component(const char *name, size_t len, char *out, size_t out_len) {
+    if ((len == 1 && name[0] == '.') || (len == 2 && name[0] == '.' && name[1] == '.')) {
+        snprintf(out, out_len, "%.*s", (int)len, name);
+        return;
+    }
+    Hash128 h;
+    hash128_init(&h, cap.salt);
+    hash128_update(&h, name, len);
+    snprintf(out, out_len, "%sn%016llx", name[0] == '.' ? "." : "",
+             (unsigned long long)hash128_final(&h).lo);
+}
+
+// Hash every component of `path` after `keep` bytes, keeping the slashes.
+static void hash_components(const char *path, size_t keep, char *out, size_t len) {
+    size_t n = keep < len - 1 ? keep : len - 1;
+    memcpy(out, path, n);
+    out[n] = '\0';
+    for (const char *p = path + keep; *p && n + 1 < len;) {
+        if (*p == '/') {
+            out[n++] = *p++;
+            out[n] = '\0';
+            continue;
+        }
+        size_t part = strcspn(p, "/");
+        char hashed[64];
+        hash_component(p, part, hashed, sizeof(hashed));
+        n += (size_t)snprintf(out + n, len - n, "%s", hashed);
+        if (n >= len) n = len - 1;
+        p += part;
+    }
+}
+
+static void anon_path(const char *path, char *out, size_t len) {
+    size_t keep = 0;
+
+    if (!cap.hash_names) {
+        snprintf(out, len, "%s", path);
+        return;
+    }
+    for (int i = 0; i < cap.root_count; i++) {
+        size_t rlen = strlen(cap.roots[i]);
+        if (rlen > keep && strncmp(path, cap.roots[i], rlen) == 0 &&
+            (path[rlen] == '\0' || path[rlen] == '/' || cap.roots[i][rlen - 1] == '/'))
+            keep = rlen;
+    }
+    hash_components(path, keep, out, len);
+}
+
+static void anon_name(const char *name, char *out, size_t len) {
+    if (cap.hash_names) hash_component(name, strlen(name), out, len);
+    else snprintf(out, len, "%s", name);
+}
+
+// ========================================
+// Recording Wrapper
+// ========================================
+
+static void begin_record(Buf *b, uint8_t type, uint64_t ns, int err, const char *path) {
+    char anon[PATH_MAX];
+    anon_path(path, anon, sizeof(anon));
+    buf_put(b, &type, 1);
+    buf_put(b, &ns, sizeof(ns));
+    buf_i32(b, err);
+    buf_str(b, anon);
+}
+
+static void write_record(Buf *b) {
+    pthread_mutex_lock(&cap.lock);
+    if (fwrite(b->data, 1, b->len, cap.fp) != b->len) cap.failed = true;
+    cap.records++;
+    pthread_mutex_unlock(&cap.lock);
+    free(b->data);
+}
+
+static void record_dir(const char *path, int err, uint64_t ns, uint32_t count, const Buf *names) {
+    Buf b = {0};
+    begin_record(&b, REC_DIR, ns, err, path);
+    buf_u32(&b, count);
+    if (names->len) buf_put(&b, names->data, names->len);
+    write_record(&b);
+}
+
+static BackendDir *cap_open_dir(Backend *w, const char *path) {
+    (void)w;
+    uint64_t t0 = timing_now();
+    BackendDir *inner = cap.inner->open_dir(cap.inner, path);
+    uint64_t ns = timing_now() - t0;
+
+    if (!inner) {
+        int err = errno;
+        Buf none = {0};
+        record_dir(path, err, ns, 0, &none);
+        errno = err;
+        return NULL;
+    }
+    CaptureDir *cd = xcalloc(1, sizeof(CaptureDir));
+    cd->inner = inner;
+    cd->path = xstrdup(path);
+    cd->ns = ns;
+    cd->outer.handle = cd;
+    return &cd->outer;
+}
+
+static int cap_next_batch(Backend *w, BackendDir *dir, FileEntry *out, int max) {
+    (void)w;
+    CaptureDir *cd = dir->handle;
+    uint64_t t0 = timing_now();
+    int n = cap.inner->next_batch(cap.inner, cd->inner, out, max);
+    int err = errno;
+    cd->ns += timing_now() - t0;
+
+    for (int i = 0; i < n; i++) {
+        char anon[256];
+        anon_name(out[i].name, anon, sizeof(anon));
+        buf_str(&cd->names, anon);
+        buf_put(&cd->names, &out[i].d_type, 1);
+    }
+    if (n > 0) cd->count += (uint32_t)n;
+    errno = err;
+    return n;
+}
+
+static void cap_close_dir(Backend *w, BackendDir *dir) {
+    (void)w;
+    CaptureDir *cd = dir->handle;
+    cap.inner->close_dir(cap.inner, cd->inner);
+    record_dir(cd->path, 0, cd->ns, cd->count, &cd->names);
+    free(cd->names.data);
+    free(cd->path);
+    free(cd);
+}
+
+static void cap_stat_batch(Backend *w, const char *dir, FileEntry *entries, int count, bool *ok) {
+    (void)w;
+    uint64_t t0 = timing_now();
+    cap.inner->stat_batch(cap.inner, dir, entries, count, ok);
+    uint64_t ns = timing_now() - t0;
+
+    Buf b = {0};
+    begin_record(&b, REC_STATS, ns, 0, dir);
+    buf_u32(&b, (uint32_t)count);
+    for (int i = 0; i < count; i++) {
+        char anon[256];
+        anon_name(entries[i].name, anon, sizeof(anon));
+        buf_str(&b, anon);
+        buf_i32(&b, ok[i] ? 0 : ENOENT);
+        if (ok[i]) buf_stat(&b, &entries[i].st);
+    }
+    write_record(&b);
+}
+
+static int record_stat(uint8_t type, const char *path, struct stat *st) {
+    uint64_t t0 = timing_now();
+    int r = type == REC_LSTAT ? cap.inner->lstat(cap.inner, path, st)
+                              : cap.inner->stat(cap.inner, path, st);
+    uint64_t ns = timing_now() - t0;
+    int err = r == 0 ? 0 : errno;
+
+    Buf b = {0};
+    begin_record(&b, type, ns, err, path);
+    if (r == 0) buf_stat(&b, st);
+    write_record(&b);
+    errno = err;
+    return r;
+}
+
+static int cap_lstat(Backend *w, const char *path, struct stat *st) {
+    (void)w;
+    return record_stat(REC_LSTAT, path, st);
+}
+
+static int cap_stat(Backend *w, const char *path, struct stat *st) {
+    (void)w;
+    return record_stat(REC_STAT, path, st);
+}
+
+static ssize_t cap_readlink(Backend *w, const char *path, char *buf, size_t len) {
+    (void)w;
+    uint64_t t0 = timing_now();
+    ssize_t n = cap.inner->readlink(cap.inner, path, buf, len);
+    uint64_t ns = timing_now() - t0;
+    int err = n < 0 ? errno : 0;
+
+    Buf b = {0};
+    begin_record(&b, REC_LINK, ns, err, path);
+    if (n >= 0) {
+        char target[PATH_MAX], anon[PATH_MAX];
+        size_t tlen = (size_t)n < sizeof(target) - 1 ? (size_t)n : sizeof(target) - 1;
+        memcpy(target, buf, tlen);
+        target[tlen] = '\0';
+        if (cap.hash_names) hash_components(target, 0, anon, sizeof(anon));
+        else memcpy(anon, target, tlen + 1);
+        buf_str(&b, anon);
+    }
+    write_record(&b);
+    errno = err;
+    return n;
+}
+
+static uint64_t random_salt(void) {
+    uint64_t salt = 0;
+    FILE *fp = fopen("/dev/urandom", "rb");
+    if (!fp || fread(&salt, sizeof(salt), 1, fp) != 1)
+        salt = (uint64_t)time(NULL) ^ ((uint64_t)getpid() << 32);
+    if (fp) fclose(fp);
+    return salt;
+}
+
+int capture_start(const Options *opts) {
+    cap.fp = fopen(opts->capture, "wb");
+    if (!cap.fp) {
+        perror(opts->capture);
+        return 1;
+    }
+    cap.file = opts->capture;
+    cap.hash_names = opts->hash_names;
+    cap.salt = opts->hash_names ? random_salt() : 0;
+    cap.roots = opts->operands;
+    cap.root_count = opts->operand_count;
+
+    uint32_t header[2] = { CAPTURE_ENDIAN, opts->hash_names ? CAPTURE_FLAG_HASH : 0 };
+    if (fwrite(CAPTURE_MAGIC, 1, 8, cap.fp) != 8 || fwrite(header, sizeof(header), 1, cap.fp) != 1)
+        cap.failed = true;
+
+    cap.inner = backend_install(&cap.wrapper);
+    cap.wrapper = (Backend){
+        .name = "capture",
+        .open_dir = cap_open_dir,
+        .next_batch = cap_next_batch,
+        .close_dir = cap_close_dir,
+        .stat_batch = cap_stat_batch,
+        .lstat = cap_lstat,
+        // Sources without their own stat() get it resolved through the
+        // wrapper's lstat() and readlink(), which are recorded.
+        .stat = cap.inner->stat ? cap_stat : NULL,
+        .readlink = cap_readlink,
+    };
+    return 0;
+}
+
+int capture_finish(void) {
+    if (!cap.fp) return 0;
+
+    backend_install(cap.inner);
+    if (fclose(cap.fp) != 0) cap.failed = true;
+    cap.fp = NULL;
+    if (cap.failed) {
+        fprintf(stderr, "Error: unable to write capture %s\n", cap.file);
+        return 1;
+    }
+    fprintf(stderr, "Capture: %ld calls recorded to %s\n", cap.records, cap.file);
+    return 0;
+}
+
+// ========================================
+// Replay Source
+// ========================================
+
+// Everything recorded about one path; later records replace earlier ones.
+typedef struct {
+    char *path;
+    bool has_dir, has_lstat, has_stat, has_link;
+    int dir_err, lstat_err, stat_err, link_err;
+    uint64_t dir_ns, lstat_ns, stat_ns, link_ns;
+    char **names;
+    unsigned char *types;
+    uint32_t name_count;
+    struct stat lst;
+    struct stat st;
+    char *target;
+} ReplayItem;
+
+typedef struct {
+    ReplayItem **slots;
+    size_t slot_count;
+    size_t used;
+    bool timed;
+} Replay;
+
+typedef struct {
+    const char *p;
+    size_t left;
+} Reader;
+
+static bool rd(Reader *r, void *dest, size_t len) {
+    if (r->left < len) return false;
+    memcpy(dest, r->p, len);
+    r->p += len;
+    r->left -= len;
+    return true;
+}
+
+static char *rd_str(Reader *r) {
+    uint32_t len;
+    if (!rd(r, &len, sizeof(len)) || r->left < len) return NULL;
+    char *s = xmalloc((size_t)len + 1);
+    memcpy(s, r->p, len);
+    s[len] = '\0';
+    r->p += len;
+    r->left -= len;
+    return s;
+}
+
+static bool rd_stat(Reader *r, struct stat *st) {
+    SnapStat ss;
+    if (!rd(r, &ss, sizeof(ss))) return false;
+    snapstat_to(st, &ss);
+    return true;
+}
+
+static size_t replay_slot(const Replay *rp, const char *path) {
+    Hash128 h;
+    hash128_init(&h, 0);
+    hash128_update(&h, path, strlen(path));
+    size_t slot = hash128_final(&h).lo & (rp->slot_count - 1);
+    while (rp->slots[slot] && strcmp(rp->slots[slot]->path, path) != 0)
+        slot = (slot + 1) & (rp->slot_count - 1);
+    return slot;
+}
+
+static ReplayItem *replay_find(const Replay *rp, const char *path) {
+    return rp->slots[replay_slot(rp, path)];
+}
+
+static ReplayItem *replay_item(Replay *rp, const char *path) {
+    if ((rp->used + 1) * 2 > rp->slot_count) {
+        ReplayItem **old = rp->slots;
+        size_t old_count = rp->slot_count;
+        rp->slot_count = old_count * 2;
+        rp->slots = xcalloc(rp->slot_count, sizeof(ReplayItem *));
+        for (size_t i = 0; i < old_count; i++) {
+            if (old[i]) rp->slots[replay_slot(rp, old[i]->path)] = old[i];
+        }
+        free(old);
+    }
+    size_t slot = replay_slot(rp, path);
+    if (!rp->slots[slot]) {
+        rp->slots[slot] = xcalloc(1, sizeof(ReplayItem));
+        rp->slots[slot]->path = xstrdup(path);
+        rp->used++;
+    }
+    return rp->slots[slot];
+}
+
+static void clear_names(ReplayItem *it) {
+    for (uint32_t i = 0; i < it->name_count; i++) free(it->names[i]);
+    free(it->names);
+    free(it->types);
+    it->names = NULL;
+    it->types = NULL;
+    it->name_count = 0;
+}
+
+static bool load_record(Replay *rp, Reader *r) {
+    uint8_t type;
+    uint64_t ns;
+    int32_t err;
+    uint32_t count;
+
+    if (!rd(r, &type, 1) || !rd(r, &ns, sizeof(ns)) || !rd(r, &err, sizeof(err))) return false;
+    char *path = rd_str(r);
+    if (!path) return false;
+    ReplayItem *it = replay_item(rp, path);
+    bool ok = true;
+
+    switch (type) {
+        case REC_DIR:
+            ok = rd(r, &count, sizeof(count)) && count <= r->left;
+            if (!ok) break;
+            clear_names(it);
+            it->has_dir = true;
+            it->dir_err = err;
+            it->dir_ns = ns;
+            it->names = xcalloc(count ? count : 1, sizeof(char *));
+            it->types = xcalloc(count ? count : 1, 1);
+            for (uint32_t i = 0; ok && i < count; i++) {
+                ok = (it->names[i] = rd_str(r)) != NULL && rd(r, &it->types[i], 1);
+                if (it->names[i]) it->name_count++;
+            }
+            break;
+        case REC_STATS:
+            ok = rd(r, &count, sizeof(count));
+            for (uint32_t i = 0; ok && i < count; i++) {
+                char *name = rd_str(r);
+                int32_t e;
+                char full[PATH_MAX];
+                ok = name && rd(r, &e, sizeof(e));
+                if (ok) {
+                    join_path(full, sizeof(full), path, name);
+                    ReplayItem *child = replay_item(rp, full);
+                    child->has_lstat = true;
+                    child->lstat_err = e;
+                    child->lstat_ns = ns / count;
+                    if (e == 0) ok = rd_stat(r, &child->lst);
+                }
+                free(name);
+            }
+            break;
+        case REC_LSTAT:
+            it->has_lstat = true;
+            it->lstat_err = err;
+            it->lstat_ns = ns;
+            if (err == 0) ok = rd_stat(r, &it->lst);
+            break;
+        case REC_STAT:
+            it->has_stat = true;
+            it->stat_err = err;
+            it->stat_ns = ns;
+            if (err == 0) ok = rd_stat(r, &it->st);
+            break;
+        case REC_LINK:
+            it->has_link = true;
+            it->link_err = err;
+            it->link_ns = ns;
+            free(it->target);
+            it->target = NULL;
+            if (err == 0) ok = (it->target = rd_str(r)) != NULL;
+            break;
+        default:
+            ok = false;
+    }
+    free(path);
+    return ok;
+}
+
+static void replay_wait(const Replay *rp, uint64_t ns) {
+    if (!rp->timed || ns == 0) return;
+    struct timespec ts = { (time_t)(ns / 1000000000ULL), (long)(ns % 1000000000ULL) };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {}
+}
+
+static BackendDir *replay_open_dir(Backend *b, const char *path) {
+    const Replay *rp = b->state;
+    ReplayItem *it = replay_find(rp, path);
+
+    if (!it || !it->has_dir) {
+        errno = ENOENT;
+        return NULL;
+    }
+    replay_wait(rp, it->dir_ns);
+    if (it->dir_err) {
+        errno = it->dir_err;
+        return NULL;
+    }
+    BackendDir *d = xcalloc(1, sizeof(BackendDir));
+    d->handle = it;
+    d->end = it->name_count;
+    return d;
+}
+
+static int replay_next_batch(Backend *b, BackendDir *d, FileEntry *out, int max) {
+    const ReplayItem *it = d->handle;
+    int n = 0;
+
+    (void)b;
+    while (n < max && d->pos < d->end) {
+        out[n].name = xstrdup(it->names[d->pos]);
+        out[n].d_type = it->types[d->pos];
+        d->pos++;
+        n++;
+    }
+    return n;
+}
+
+static void replay_close_dir(Backend *b, BackendDir *d) {
+    (void)b;
+    free(d);
+}
+
+static void replay_stat_batch(Backend *b, const char *dir, FileEntry *entries, int count, bool *ok) {
+    const Replay *rp = b->state;
+    uint64_t ns = 0;
+
+    for (int i = 0; i < count; i++) {
+        char full[PATH_MAX];
+        join_path(full, sizeof(full), dir, entries[i].name);
+        const ReplayItem *it = replay_find(rp, full);
+        ok[i] = it && it->has_lstat && it->lstat_err == 0;
+        if (ok[i]) entries[i].st = it->lst;
+        if (it) ns += it->lstat_ns;
+    }
+    replay_wait(rp, ns);
+}
+
+static int replay_lstat(Backend *b, const char *path, struct stat *st) {
+    const Replay *rp = b->state;
+    const ReplayItem *it = replay_find(rp, path);
+
+    if (!it || !it->has_lstat) {
+        errno = ENOENT;
+        return -1;
+    }
+    replay_wait(rp, it->lstat_ns);
+    if (it->lstat_err) {
+        errno = it->lstat_err;
+        return -1;
+    }
+    *st = it->lst;
+    return 0;
+}
+
+static int replay_stat(Backend *b, const char *path, struct stat *st) {
+    const Replay *rp = b->state;
+    const ReplayItem *it = replay_find(rp, path);
+
+    // Captures of sources without their own stat() recorded the lstat()
+    // and readlink() calls it was resolved through instead.
+    if (!it || !it->has_stat) return backend_follow_links(b, path, st);
+    replay_wait(rp, it->stat_ns);
+    if (it->stat_err) {
+        errno = it->stat_err;
+        return -1;
+    }
+    *st = it->st;
+    return 0;
+}
+
+static ssize_t replay_readlink(Backend *b, const char *path, char *buf, size_t len) {
+    const Replay *rp = b->state;
+    const ReplayItem *it = replay_find(rp, path);
+
+    if (!it || !it->has_link) {
+        errno = EINVAL;
+        return -1;
+    }
+    replay_wait(rp, it->link_ns);
+    if (it->link_err) {
+        errno = it->link_err;
+        return -1;
+    }
+    size_t n = strlen(it->target);
+    if (n > len) n = len;
+    memcpy(buf, it->target, n);
+    return (ssize_t)n;
+}
+
+static void replay_destroy(Backend *b) {
+    Replay *rp = b->state;
+    for (size_t i = 0; i < rp->slot_count; i++) {
+        ReplayItem *it = rp->slots[i];
+        if (!it) continue;
+        clear_names(it);
+        free(it->target);
+        free(it->path);
+        free(it);
+    }
+    free(rp->slots);
+    free(rp);
+    free(b);
+}
+
+static char *read_file(const char *file, size_t *len) {
+    FILE *fp = fopen(file, "rb");
+    if (!fp) {
+        perror(file);
+        return NULL;
+    }
+    size_t capacity = 1 << 20, used = 0, n;
+    char *data = xmalloc(capacity);
+    while ((n = fread(data + used, 1, capacity - used, fp)) > 0) {
+        used += n;
+        if (used == capacity) {
+            capacity *= 2;
+            data = xrealloc(data, capacity);
+        }
+    }
+    fclose(fp);
+    *len = used;
+    return data;
+}
+
+Backend *replay_backend(const char *file, bool timed) {
+    size_t len;
+    char *data = read_file(file, &len);
+    if (!data) return NULL;
+
+    Reader r = { data, len };
+    char magic[8];
+    uint32_t header[2];
+    if (!rd(&r, magic, sizeof(magic)) || memcmp(magic, CAPTURE_MAGIC, 8) != 0 ||
+        !rd(&r, header, sizeof(header)) || header[0] != CAPTURE_ENDIAN) {
+        fprintf(stderr, "Error: %s is not a capture file\n", file);
+        free(data);
+        return NULL;
+    }
+
+    Replay *rp = xcalloc(1, sizeof(Replay));
+    rp->timed = timed;
+    rp->slot_count = 1024;
+    rp->slots = xcalloc(rp->slot_count, sizeof(ReplayItem *));
+    while (r.left > 0) {
+        if (!load_record(rp, &r)) {
+            fprintf(stderr, "Warning: %s is truncated; replaying what was read\n", file);
+            break;
+        }
+    }
+    free(data);
+
+    Backend *b = xcalloc(1, sizeof(Backend));
+    b->name = "replay";
+    b->state = rp;
+    b->open_dir = replay_open_dir;
+    b->next_batch = replay_next_batch;
+    b->close_dir = replay_close_dir;
+    b->stat_batch = replay_stat_batch;
+    b->lstat = replay_lstat;
+    b->stat = replay_stat;
+    b->readlink = replay_readlink;
+    b->destroy = replay_destroy;
+    return b;
+}
@@ -0,0 +1,29 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+/*
+ * capture.h - Recording listing I/O for --capture, replaying it as a source
+ * ------------------------------------------------------------------------
+ * A capture wraps the active source and logs every enumeration, stat batch,
+ * lstat, stat and readlink together with its result and how long it took.
+ * --source=replay:FILE serves those results back from memory (sleeping for
+ * the recorded times with --replay-latency), so a production tree's shape
+ * and timing can be benchmarked anywhere.
+ *
+ * With --hash-names every path component below the operands is replaced by
+ * a salted hash that keeps a leading '.', so hidden files stay hidden but no
+ * name can be read back from the file.
+ */
+
+#include <stdbool.h>
+#include "gls.h"
+
+// Start recording to `file`.  Operands are kept verbatim even when names are
+// hashed, so the capture replays with the same command line.
+int capture_start(const Options *opts);
+
+// Stop recording and restore the wrapped source.  Returns non-zero if the
+// capture could not be written.
+int capture_finish(void);
+
+#endif
@@ -0,0 +1,237 @@
+/*
+ * checknames.c - Bulk existence check for --check-names
+ * -----------------------------------------------------
+ * Two strategies, chosen per directory:
+ *
+ *   probe  One fstatat() per expected name on the open directory, and no
+ *          directory read.  Cheapest when the list is small compared to the
+ *          directory, but it cannot see unexpected names, so extras are not
+ *          reported and do not affect the exit status.  `.`, `..` and names
+ *          with a '/' are never entries and count as missing; on a
+ *          case-insensitive filesystem a name found by probing may be
+ *          spelled differently in the directory.
+ *   scan   One readdir() pass over the directory, looking every name up in a
+ *          hash set of the expected names.  Finds extras as well, and wins as
+ *          soon as the list is a sizeable fraction of the directory; found
+ *          names are lstat()'ed only for --show-found.
+ *
+ * The directory's entry count is estimated from its own st_size (directory
+ * sizes grow with their entries on all common filesystems), so choosing costs
+ * one lstat().  The expected names are read once for all directories.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include "gls.h"
+#include "display.h"
+#include "checknames.h"
+#include "hash.h"
+
+#define EST_DIRENT_BYTES 32     // rough on-disk bytes per directory entry
+#define PROBE_RATIO      8      // probe only if the list is < 1/8 of the dir
+
+struct NameSet {
+    char **names;
+    int count;
+    int capacity;
+    int *table;             // open-addressing set of indices into names
+    size_t slots;
+};
+
+static uint64_t name_hash(const char *name) {
+    Hash128 h;
+    hash128_init(&h, 0);
+    hash128_update(&h, name, strlen(name));
+    return hash128_final(&h).lo;
+}
+
+// Returns the index of `name`, or -1.
+static int set_lookup(const NameSet *set, const char *name) {
+    size_t slot = name_hash(name) & (set->slots - 1);
+    for (;; slot = (slot + 1) & (set->slots - 1)) {
+        int i = set->table[slot];
+        if (i < 0) return -1;
+        if (strcmp(set->names[i], name) == 0) return i;
+    }
+}
+
+// Read one name per line; blank lines and duplicate names are dropped.
+NameSet *check_names_load(const char *file) {
+    FILE *fp = strcmp(file, "-") == 0 ? stdin : fopen(file, "r");
+    if (!fp) {
+        perror(file);
+        return NULL;
+    }
+    NameSet *set = xcalloc(1, sizeof(NameSet));
+
+    char *line = NULL;
+    size_t cap = 0;
+    ssize_t len;
+    while ((len = getline(&line, &cap, fp)) != -1) {
+        while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) line[--len] = '\0';
+        if (len == 0) continue;
+        if (set->count >= set->capacity) {
+            set->capacity = set->capacity ? set->capacity * 2 : 1024;
+            set->names = xrealloc(set->names, (size_t)set->capacity * sizeof(char *));
+        }
+        set->names[set->count++] = xstrdup(line);
+    }
+    free(line);
+    if (fp != stdin) fclose(fp);
+
+    set->slots = 16;
+    while (set->slots < (size_t)set->count * 2) set->slots *= 2;
+    set->table = xmalloc(set->slots * sizeof(int));
+    memset(set->table, 0xff, set->slots * sizeof(int));
+
+    int kept = 0;
+    for (int i = 0; i < set->count; i++) {
+        if (set_lookup(set, set->names[i]) >= 0) {
+            free(set->names[i]);
+            continue;
+        }
+        set->names[kept] = set->names[i];
+        size_t slot = name_hash(set->names[kept]) & (set->slots - 1);
+        while (set->table[slot] >= 0) slot = (slot + 1) & (set->slots - 1);
+        set->table[slot] = kept++;
+    }
+    set->count = kept;
+    return set;
+}
+
+void check_names_free(NameSet *set) {
+    if (!set) return;
+    for (int i = 0; i < set->count; i++) free(set->names[i]);
+    free(set->names);
+    free(set->table);
+    free(set);
+}
+
+static void print_name(const char *label, const char *name) {
+    char safe[PATH_MAX];
+    sanitize_string(safe, name, sizeof(safe));
+    printf("%s: %s\n", label, safe);
+}
+
+static int compare_strings(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// The long-format line of one found name, from a stat already done.
+static void show_found(const char *dir, char *name, const struct stat *st) {
+    char fullpath[PATH_MAX];
+    join_path(fullpath, sizeof(fullpath), dir, name);
+    FileStats dummy = {0};
+    FileEntry fe = { .name = name, .st = *st };
+    load_entry_details(&fe, fullpath);
+    print_file_entry(stdout, dir, &fe, &dummy);
+}
+
+// Whether `name` could be an entry of a directory at all.
+static bool entry_name(const char *name) {
+    return strcmp(name, ".") != 0 && strcmp(name, "..") != 0 && !strchr(name, '/');
+}
+
+// One fstatat() per expected name; fills `found`.
+static int probe_names(const NameSet *set, const char *dir, const Options *opts, bool *found,
+                       long *found_count) {
+    int dfd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (dfd < 0) {
+        perror(dir);
+        return 1;
+    }
+    for (int i = 0; i < set->count; i++) {
+        struct stat st;
+        if (!entry_name(set->names[i]) ||
+            fstatat(dfd, set->names[i], &st, AT_SYMLINK_NOFOLLOW) != 0)
+            continue;
+        found[i] = true;
+        (*found_count)++;
+        if (opts->check_show_found) show_found(dir, set->names[i], &st);
+    }
+    close(dfd);
+    return 0;
+}
+
+// One directory pass; fills `found` and prints the extras.
+static int scan_names(const NameSet *set, const char *dir, const Options *opts, bool *found,
+                      long *found_count, long *extra_count) {
+    // Hidden names still have to match; -a only decides if they count as
+    // extras.
+    Options all = *opts;
+    all.show_all = true;
+    DirListing list;
+    if (enumerate_directory(dir, &all, &list) != 0) return 1;
+
+    char **extras = xcalloc(list.count > 0 ? (size_t)list.count : 1, sizeof(char *));
+    for (int i = 0; i < list.count; i++) {
+        char *name = list.entries[i].name;
+        int idx = set_lookup(set, name);
+        if (idx < 0) {
+            if (opts->show_all || name[0] != '.') extras[(*extra_count)++] = name;
+            continue;
+        }
+        found[idx] = true;
+        (*found_count)++;
+        if (opts->check_show_found) {
+            char fullpath[PATH_MAX];
+            struct stat st;
+            join_path(fullpath, sizeof(fullpath), dir, name);
+            if (lstat(fullpath, &st) == 0) show_found(dir, name, &st);
+        }
+    }
+
+    qsort(extras, (size_t)*extra_count, sizeof(char *), compare_strings);
+    for (long i = 0; i < *extra_count; i++) print_name("extra", extras[i]);
+    free(extras);
+    free_listing(&list);
+    return 0;
+}
+
+int check_names(const NameSet *set, const char *dir, const Options *opts) {
+    struct stat dir_st;
+    int result = 0;
+    long found_count = 0, extra_count = 0;
+
+    if (lstat(dir, &dir_st) != 0) {
+        perror(dir);
+        return 1;
+    }
+    if (!S_ISDIR(dir_st.st_mode)) {
+        fprintf(stderr, "%s: Not a directory\n", dir);
+        return 1;
+    }
+
+    long estimate = (long)(dir_st.st_size / EST_DIRENT_BYTES);
+    bool probe = (long)set->count * PROBE_RATIO < estimate;
+    bool *found = xcalloc(set->count > 0 ? (size_t)set->count : 1, sizeof(bool));
+    if (probe ? probe_names(set, dir, opts, found, &found_count)
+              : scan_names(set, dir, opts, found, &found_count, &extra_count)) {
+        free(found);
+        return 1;
+    }
+
+    // Missing names keep the order of the input list.
+    for (int i = 0; i < set->count; i++) {
+        if (!found[i]) {
+            print_name("missing", set->names[i]);
+            result = 1;
+        }
+    }
+    free(found);
+    if (extra_count > 0) result = 1;
+
+    printf("\nSummary:\n");
+    printf("  Strategy:           %s\n",
+           probe ? "probe (one stat per name)" : "scan (one directory pass)");
+    printf("  Expected names:     %d\n", set->count);
+    printf("  Found:              %ld\n", found_count);
+    printf("  Missing:            %ld\n", (long)set->count - found_count);
+    if (probe) printf("  Extra:              not checked in probe mode\n");
+    else printf("  Extra:              %ld\n", extra_count);
+    return result;
+}
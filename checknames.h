@@ -0,0 +1,23 @@
+#ifndef CHECKNAMES_H
+#define CHECKNAMES_H
+
+/*
+ * checknames.h - Bulk existence check for --check-names
+ * -----------------------------------------------------
+ * Compares a list of expected names against the contents of one directory
+ * and reports which are missing and, unless a short list is probed name by
+ * name, which are unexpected.
+ */
+
+#include "gls.h"
+
+typedef struct NameSet NameSet;
+
+// Read the expected names from `file` (- for stdin) once, for every
+// directory.  Returns NULL (after printing why) if it cannot be read.
+NameSet *check_names_load(const char *file);
+void check_names_free(NameSet *set);
+
+int check_names(const NameSet *set, const char *dir, const Options *opts);
+
+#endif
@@ -0,0 +1,174 @@
+/*
+ * collisions.c - Case/normalisation collision finder for --collisions
+ * -------------------------------------------------------------------
+ * Each directory is enumerated without stat'ing its entries; every name is
+ * folded with unifold_key() and inserted into an open-addressing hash set.
+ * Names landing on an existing key are chained onto that key's group, and
+ * only groups with two or more members are printed.  Subdirectories are
+ * recognised from d_type, so lstat() is only needed on filesystems that do
+ * not report it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <dirent.h>
+#include "gls.h"
+#include "collisions.h"
+#include "hash.h"
+#include "unifold.h"
+#include "walk.h"
+
+typedef struct {
+    const Options *opts;
+    atomic_long groups;
+    atomic_long dirs;
+} CollisionCtx;
+
+typedef struct {
+    char *key;
+    size_t key_len;
+    uint64_t hash;
+    int next;           // next name in the same group, or -1
+    int group_size;     // valid on the first member of a group
+    bool member;        // joined an earlier name's group
+} FoldedName;
+
+// Print a name with every non-ASCII or unprintable byte escaped, so that
+// composed and decomposed forms are visibly different.
+static void print_escaped(FILE *out, const char *name) {
+    for (const unsigned char *p = (const unsigned char *)name; *p; p++) {
+        if (*p >= 0x20 && *p < 0x7f && *p != '\\') fputc(*p, out);
+        else fprintf(out, "\\x%02x", *p);
+    }
+}
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(((const FileEntry *)a)->name, ((const FileEntry *)b)->name);
+}
+
+static bool is_subdir(const char *path, const FileEntry *fe) {
+#ifdef DT_DIR
+    if (fe->d_type == DT_DIR) return true;
+    if (fe->d_type != DT_UNKNOWN) return false;
+#endif
+    char child[PATH_MAX];
+    struct stat st;
+    join_path(child, sizeof(child), path, fe->name);
+    return lstat(child, &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+static int visit_collisions(WalkNode *node, FILE *out, void *ctx) {
+    CollisionCtx *cc = ctx;
+    const char *path = walk_node_path(node);
+    DirListing list;
+
+    if (enumerate_directory(path, cc->opts, &list) != 0) return 1;
+    // Byte order keeps both the groups and the walk deterministic.
+    qsort(list.entries, (size_t)list.count, sizeof(FileEntry), compare_names);
+
+    // Folded keys plus a power-of-two hash set of indices into them.
+    FoldedName *names = xcalloc(list.count > 0 ? (size_t)list.count : 1, sizeof(FoldedName));
+    size_t slots = 16;
+    while (slots < (size_t)list.count * 2) slots *= 2;
+    int *table = xmalloc(slots * sizeof(int));
+    memset(table, 0xff, slots * sizeof(int));
+
+    long groups = 0;
+    for (int i = 0; i < list.count; i++) {
+        char key[UNIFOLD_KEY_MAX];
+        Hash128 h;
+        FoldedName *fn = &names[i];
+
+        fn->key_len = unifold_key(list.entries[i].name, key, sizeof(key));
+        hash128_init(&h, 0);
+        hash128_update(&h, key, fn->key_len);
+        fn->hash = hash128_final(&h).lo;
+        fn->next = -1;
+        fn->group_size = 1;
+
+        size_t slot = fn->hash & (slots - 1);
+        for (;; slot = (slot + 1) & (slots - 1)) {
+            int other = table[slot];
+            if (other < 0) {
+                fn->key = xmalloc(fn->key_len + 1);
+                memcpy(fn->key, key, fn->key_len + 1);
+                table[slot] = i;
+                break;
+            }
+            FoldedName *head = &names[other];
+            if (head->hash == fn->hash && head->key_len == fn->key_len &&
+                memcmp(head->key, key, fn->key_len) == 0) {
+                // Append to the group, keeping enumeration order.
+                int tail = other;
+                while (names[tail].next >= 0) tail = names[tail].next;
+                names[tail].next = i;
+                fn->member = true;
+                if (++head->group_size == 2) groups++;
+                break;
+            }
+        }
+    }
+
+    if (groups > 0) {
+        fprintf(out, "%s:\n", path);
+        for (int i = 0; i < list.count; i++) {
+            if (names[i].member || names[i].group_size < 2) continue;
+            fputs("  ", out);
+            for (int j = i; j >= 0; j = names[j].next) {
+                if (j != i) fputs("  |  ", out);
+                print_escaped(out, list.entries[j].name);
+            }
+            fputc('\n', out);
+        }
+        atomic_fetch_add(&cc->groups, groups);
+        atomic_fetch_add(&cc->dirs, 1);
+    }
+
+    for (int i = 0; i < list.count; i++) {
+        if (is_subdir(path, &list.entries[i])) {
+            char child[PATH_MAX];
+            join_path(child, sizeof(child), path, list.entries[i].name);
+            walk_add_child(node, child);
+        }
+        free(names[i].key);
+    }
+    free(names);
+    free(table);
+    free_listing(&list);
+    return 0;
+}
+
+int find_collisions(char **roots, int root_count, const Options *opts) {
+    CollisionCtx cc = { .opts = opts };
+    int result = 0;
+
+    atomic_init(&cc.groups, 0);
+    atomic_init(&cc.dirs, 0);
+    WalkConfig cfg = {
+        .visit = visit_collisions,
+        .emit = NULL,
+        .ctx = &cc,
+        .jobs = opts->jobs,
+        .mem_limit = opts->buffer_mem,
+    };
+    for (int r = 0; r < root_count; r++) {
+        struct stat st;
+        if (lstat(roots[r], &st) != 0) {
+            perror(roots[r]);
+            result = 1;
+        } else if (!S_ISDIR(st.st_mode)) {
+            fprintf(stderr, "%s: Not a directory\n", roots[r]);
+            result = 1;
+        } else if (walk_tree(roots[r], &cfg) != 0) {
+            result = 1;
+        }
+    }
+
+    long groups = atomic_load(&cc.groups);
+    long dirs = atomic_load(&cc.dirs);
+    printf("%s%ld collision group%s in %ld director%s\n", groups > 0 ? "\n" : "",
+           groups, groups == 1 ? "" : "s", dirs, dirs == 1 ? "y" : "ies");
+    return result;
+}
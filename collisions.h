@@ -0,0 +1,15 @@
+#ifndef COLLISIONS_H
+#define COLLISIONS_H
+
+/*
+ * collisions.h - Case/normalisation collision finder for --collisions
+ * -------------------------------------------------------------------
+ * Walks the given trees and reports names within one directory that would
+ * refer to the same file on a case- or normalisation-insensitive filesystem.
+ */
+
+#include "gls.h"
+
+int find_collisions(char **roots, int root_count, const Options *opts);
+
+#endif
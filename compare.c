@@ -0,0 +1,215 @@
+/*
+ * compare.c - Live tree comparison for --compare
+ * ----------------------------------------------
+ * Walk nodes carry paths relative to both roots.  A visit scans the directory
+ * on each side, sorts both listings by byte order and merge-joins them, so a
+ * level costs one pass over each listing.  With --jobs above 1 the second side
+ * is scanned on a helper thread while the visiting thread scans the first:
+ * when one tree is on a slow or remote filesystem, its latency overlaps the
+ * other's.  With one job both sides are scanned in turn.  Directories present on both sides
+ * become children of the node; everything else is reported immediately and
+ * the results stream out per directory in depth-first order.
+ *
+ * Output lines:
+ *   - PATH          only in the first tree
+ *   + PATH          only in the second tree
+ *   ! PATH: ...     in both, but different
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "gls.h"
+#include "display.h"
+#include "compare.h"
+#include "timefmt.h"
+#include "walk.h"
+
+typedef struct {
+    const Options *opts;
+    const char *root_a;
+    const char *root_b;
+    atomic_long only_a;
+    atomic_long only_b;
+    atomic_long differ;
+} CompareCtx;
+
+static int compare_names(const void *a, const void *b) {
+    return strcmp(((const FileEntry *)a)->name, ((const FileEntry *)b)->name);
+}
+
+static void side_path(char *dest, size_t len, const char *root, const char *rel) {
+    if (rel[0] == '\0') snprintf(dest, len, "%s", root);
+    else join_path(dest, len, root, rel);
+}
+
+static void print_rel(FILE *out, char tag, const char *rel, const char *name, const char *suffix) {
+    char safe[PATH_MAX];
+    char joined[PATH_MAX];
+    if (rel[0] == '\0') snprintf(joined, sizeof(joined), "%s", name);
+    else join_path(joined, sizeof(joined), rel, name);
+    sanitize_string(safe, joined, sizeof(safe));
+    fprintf(out, "%c %s%s", tag, safe, suffix);
+}
+
+static const char *type_name(mode_t mode) {
+    if (S_ISDIR(mode)) return "directory";
+    if (S_ISLNK(mode)) return "symlink";
+    if (S_ISREG(mode)) return "file";
+    return "special file";
+}
+
+// Append one "; "-separated item to a difference description.
+static void add_diff(char *desc, size_t len, size_t *used, const char *fmt, ...) {
+    va_list ap;
+    if (*used > 0 && *used + 2 < len) {
+        memcpy(desc + *used, "; ", 3);
+        *used += 2;
+    }
+    if (*used >= len) return;
+    va_start(ap, fmt);
+    int n = vsnprintf(desc + *used, len - *used, fmt, ap);
+    va_end(ap);
+    if (n > 0) *used += (size_t)n;
+}
+
+// Describe how two entries present on both sides differ; false if they don't.
+static bool describe_diff(const char *dir_a, const char *dir_b, const FileEntry *a,
+                          const FileEntry *b, char *desc, size_t len) {
+    size_t used = 0;
+    desc[0] = '\0';
+
+    if ((a->st.st_mode & S_IFMT) != (b->st.st_mode & S_IFMT)) {
+        add_diff(desc, len, &used, "type %s vs %s", type_name(a->st.st_mode), type_name(b->st.st_mode));
+        return true;
+    }
+    if ((a->st.st_mode & 07777) != (b->st.st_mode & 07777))
+        add_diff(desc, len, &used, "mode %04o vs %04o", (unsigned)(a->st.st_mode & 07777),
+                 (unsigned)(b->st.st_mode & 07777));
+    if (S_ISREG(a->st.st_mode)) {
+        if (a->st.st_size != b->st.st_size)
+            add_diff(desc, len, &used, "size %lld vs %lld", (long long)a->st.st_size, (long long)b->st.st_size);
+        if (a->st.st_mtime != b->st.st_mtime) {
+            char ta[64], tb[64];
+            timefmt_format(ST_MTIM(&a->st), ta, sizeof(ta));
+            timefmt_format(ST_MTIM(&b->st), tb, sizeof(tb));
+            add_diff(desc, len, &used, "mtime %s vs %s", ta, tb);
+        }
+    } else if (S_ISLNK(a->st.st_mode)) {
+        char pa[PATH_MAX], pb[PATH_MAX], la[PATH_MAX], lb[PATH_MAX];
+        join_path(pa, sizeof(pa), dir_a, a->name);
+        join_path(pb, sizeof(pb), dir_b, b->name);
+        if (get_link_target(pa, la, sizeof(la)) == 0 &&
+            get_link_target(pb, lb, sizeof(lb)) == 0 && strcmp(la, lb) != 0)
+            add_diff(desc, len, &used, "target %s vs %s", la, lb);
+    }
+    return used > 0;
+}
+
+// One side of a directory pair.
+typedef struct {
+    const char *dir;
+    const Options *opts;
+    DirListing list;
+    int status;
+} SideScan;
+
+// Sorted once, in the byte order the merge walks.
+static void *scan_side(void *arg) {
+    SideScan *side = arg;
+    side->status = scan_directory_unsorted(side->dir, side->opts, &side->list);
+    if (side->status == 0)
+        qsort(side->list.entries, (size_t)side->list.count, sizeof(FileEntry), compare_names);
+    return NULL;
+}
+
+static int visit_compare(WalkNode *node, FILE *out, void *ctx) {
+    CompareCtx *cc = ctx;
+    const char *rel = walk_node_path(node);
+    char dir_a[PATH_MAX], dir_b[PATH_MAX];
+    long only_a = 0, only_b = 0, differ = 0;
+
+    side_path(dir_a, sizeof(dir_a), cc->root_a, rel);
+    side_path(dir_b, sizeof(dir_b), cc->root_b, rel);
+    SideScan side_a = { .dir = dir_a, .opts = cc->opts };
+    SideScan side_b = { .dir = dir_b, .opts = cc->opts };
+    pthread_t helper;
+    bool threaded = cc->opts->jobs > 1 && pthread_create(&helper, NULL, scan_side, &side_b) == 0;
+    scan_side(&side_a);
+    if (threaded) pthread_join(helper, NULL);
+    else scan_side(&side_b);
+    if (side_a.status != 0 || side_b.status != 0) {
+        if (side_a.status == 0) free_listing(&side_a.list);
+        if (side_b.status == 0) free_listing(&side_b.list);
+        return 1;
+    }
+    DirListing la = side_a.list, lb = side_b.list;
+
+    int i = 0, j = 0;
+    while (i < la.count || j < lb.count) {
+        int cmp = i >= la.count ? 1 : j >= lb.count ? -1
+                : strcmp(la.entries[i].name, lb.entries[j].name);
+        if (cmp < 0) {
+            print_rel(out, '-', rel, la.entries[i].name,
+                      S_ISDIR(la.entries[i].st.st_mode) ? "/\n" : "\n");
+            only_a++;
+            i++;
+        } else if (cmp > 0) {
+            print_rel(out, '+', rel, lb.entries[j].name,
+                      S_ISDIR(lb.entries[j].st.st_mode) ? "/\n" : "\n");
+            only_b++;
+            j++;
+        } else {
+            const FileEntry *a = &la.entries[i], *b = &lb.entries[j];
+            char desc[PATH_MAX * 2 + 128];
+            if (describe_diff(dir_a, dir_b, a, b, desc, sizeof(desc))) {
+                print_rel(out, '!', rel, a->name, ": ");
+                fprintf(out, "%s\n", desc);
+                differ++;
+            }
+            if (S_ISDIR(a->st.st_mode) && S_ISDIR(b->st.st_mode)) {
+                char child[PATH_MAX];
+                if (rel[0] == '\0') snprintf(child, sizeof(child), "%s", a->name);
+                else join_path(child, sizeof(child), rel, a->name);
+                walk_add_child(node, child);
+            }
+            i++;
+            j++;
+        }
+    }
+
+    atomic_fetch_add(&cc->only_a, only_a);
+    atomic_fetch_add(&cc->only_b, only_b);
+    atomic_fetch_add(&cc->differ, differ);
+    free_listing(&la);
+    free_listing(&lb);
+    return 0;
+}
+
+int compare_trees(const char *dir_a, const char *dir_b, const Options *opts) {
+    CompareCtx cc = { .opts = opts, .root_a = dir_a, .root_b = dir_b };
+
+    atomic_init(&cc.only_a, 0);
+    atomic_init(&cc.only_b, 0);
+    atomic_init(&cc.differ, 0);
+    WalkConfig cfg = {
+        .visit = visit_compare,
+        .emit = NULL,
+        .ctx = &cc,
+        .jobs = opts->jobs,
+        .mem_limit = opts->buffer_mem,
+    };
+    int result = walk_tree("", &cfg);
+
+    long only_a = atomic_load(&cc.only_a);
+    long only_b = atomic_load(&cc.only_b);
+    long differ = atomic_load(&cc.differ);
+    printf("\nSummary:\n");
+    printf("  Only in first (-):  %ld\n", only_a);
+    printf("  Only in second (+): %ld\n", only_b);
+    printf("  Different (!):      %ld\n", differ);
+    return (result != 0 || only_a || only_b || differ) ? 1 : 0;
+}
@@ -0,0 +1,15 @@
+#ifndef COMPARE_H
+#define COMPARE_H
+
+/*
+ * compare.h - Live tree comparison for --compare
+ * ----------------------------------------------
+ * Walks two trees side by side and reports entries missing on either side or
+ * differing in type, size, permissions, mtime or symlink target.
+ */
+
+#include "gls.h"
+
+int compare_trees(const char *dir_a, const char *dir_b, const Options *opts);
+
+#endif
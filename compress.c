@@ -0,0 +1,360 @@
+/*
+ * compress.c - Threaded output compression for --compress
+ * -------------------------------------------------------
+ * stdout is swapped for a custom stream (fopencookie() / funopen()), so
+ * every printf() and fwrite() in gls lands in the current block without any
+ * other code knowing.  Blocks live in a ring of slots:
+ *
+ *   FREE -> FILLED (by the listing) -> BUSY (a compressor) -> DONE -> FREE
+ *                                                     (written in order)
+ *
+ * The listing only waits when every slot is still in flight, i.e. when the
+ * output device is the bottleneck.  Compressor threads keep one codec context
+ * each and reset it per block, so a block costs no allocation.  Blocks are
+ * compressed independently (pigz -i / zstd-mt style), trading a little ratio
+ * for perfect parallelism.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#include "gls.h"
+#include "compress.h"
+
+#define BLOCK_SIZE      (1024 * 1024)
+#define SLOTS_PER_JOB   2
+#define GZIP_LEVEL      6
+#define ZSTD_LEVEL      3
+
+enum { CODEC_GZIP, CODEC_ZSTD };
+enum { SLOT_FREE, SLOT_FILLED, SLOT_BUSY, SLOT_DONE };
+
+typedef struct {
+    unsigned char *in;
+    size_t in_len;
+    unsigned char *out;
+    size_t out_cap;
+    size_t out_len;
+    int state;
+} Slot;
+
+static struct {
+    bool active;
+    int codec;
+    FILE *orig;                 // the real stdout
+    int fd;
+    Slot *slots;
+    int nslots;
+    uint64_t next_fill;         // block the listing is writing into
+    uint64_t next_compress;
+    uint64_t next_write;
+    pthread_mutex_t lock;
+    pthread_cond_t cv;          // any slot changed state
+    pthread_t *threads;
+    int nthreads;
+    pthread_t writer;
+    bool closing;
+    bool failed;
+} cz = { .lock = PTHREAD_MUTEX_INITIALIZER, .cv = PTHREAD_COND_INITIALIZER };
+
+// ========================================
+// Codecs
+// ========================================
+
+// Worst-case output for a full block.
+static size_t out_bound(void) {
+#ifdef HAVE_ZSTD
+    if (cz.codec == CODEC_ZSTD) return ZSTD_compressBound(BLOCK_SIZE);
+#endif
+#ifdef HAVE_ZLIB
+    // deflateBound() plus the gzip header and trailer.
+    return compressBound(BLOCK_SIZE) + 32;
+#else
+    return BLOCK_SIZE;
+#endif
+}
+
+// One context per compressor thread, reused for every block it handles.
+typedef struct {
+#ifdef HAVE_ZLIB
+    z_stream zs;
+    bool zs_ready;
+#endif
+#ifdef HAVE_ZSTD
+    ZSTD_CCtx *zctx;
+#endif
+    char none;                  // keeps the struct non-empty in a codec-less build
+} Codec;
+
+static void codec_free(Codec *c) {
+#ifdef HAVE_ZLIB
+    if (c->zs_ready) deflateEnd(&c->zs);
+#endif
+#ifdef HAVE_ZSTD
+    ZSTD_freeCCtx(c->zctx);
+#endif
+    (void)c;
+}
+
+// Compress `slot->in` into `slot->out` as one gzip member or zstd frame.
+static bool codec_run(Codec *c, Slot *slot) {
+#ifdef HAVE_ZSTD
+    if (cz.codec == CODEC_ZSTD) {
+        if (!c->zctx && !(c->zctx = ZSTD_createCCtx())) return false;
+        size_t n = ZSTD_compressCCtx(c->zctx, slot->out, slot->out_cap, slot->in,
+                                     slot->in_len, ZSTD_LEVEL);
+        if (ZSTD_isError(n)) return false;
+        slot->out_len = n;
+        return true;
+    }
+#endif
+#ifdef HAVE_ZLIB
+    if (!c->zs_ready) {
+        memset(&c->zs, 0, sizeof(c->zs));
+        // windowBits + 16 asks zlib for a gzip header and trailer.
+        if (deflateInit2(&c->zs, GZIP_LEVEL, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            return false;
+        c->zs_ready = true;
+    } else if (deflateReset(&c->zs) != Z_OK) {
+        return false;
+    }
+    c->zs.next_in = slot->in;
+    c->zs.avail_in = (uInt)slot->in_len;
+    c->zs.next_out = slot->out;
+    c->zs.avail_out = (uInt)slot->out_cap;
+    if (deflate(&c->zs, Z_FINISH) != Z_STREAM_END) return false;
+    slot->out_len = slot->out_cap - c->zs.avail_out;
+    return true;
+#else
+    (void)c;
+    (void)slot;
+    return false;
+#endif
+}
+
+// ========================================
+// Compressor and Writer Threads
+// ========================================
+
+static void *compress_main(void *arg) {
+    Codec codec = {0};
+
+    (void)arg;
+    pthread_mutex_lock(&cz.lock);
+    for (;;) {
+        while (cz.next_compress == cz.next_fill && !cz.closing)
+            pthread_cond_wait(&cz.cv, &cz.lock);
+        if (cz.next_compress == cz.next_fill) break;
+
+        Slot *slot = &cz.slots[cz.next_compress++ % (uint64_t)cz.nslots];
+        slot->state = SLOT_BUSY;
+        pthread_mutex_unlock(&cz.lock);
+
+        bool ok = codec_run(&codec, slot);
+
+        pthread_mutex_lock(&cz.lock);
+        if (!ok) {
+            slot->out_len = 0;
+            cz.failed = true;
+        }
+        slot->state = SLOT_DONE;
+        pthread_cond_broadcast(&cz.cv);
+    }
+    pthread_mutex_unlock(&cz.lock);
+    codec_free(&codec);
+    return NULL;
+}
+
+static bool write_all(int fd, const unsigned char *buf, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        buf += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static void *writer_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&cz.lock);
+    for (;;) {
+        Slot *slot = &cz.slots[cz.next_write % (uint64_t)cz.nslots];
+        while (cz.next_write < cz.next_fill ? slot->state != SLOT_DONE : !cz.closing)
+            pthread_cond_wait(&cz.cv, &cz.lock);
+        if (cz.next_write == cz.next_fill) break;
+        pthread_mutex_unlock(&cz.lock);
+
+        bool ok = cz.failed || write_all(cz.fd, slot->out, slot->out_len);
+
+        pthread_mutex_lock(&cz.lock);
+        if (!ok) cz.failed = true;
+        slot->state = SLOT_FREE;
+        slot->in_len = 0;
+        cz.next_write++;
+        pthread_cond_broadcast(&cz.cv);
+    }
+    pthread_mutex_unlock(&cz.lock);
+    return NULL;
+}
+
+// ========================================
+// The stdout Stream
+// ========================================
+
+// Hand the current block over and wait for the next slot to come free.
+// Caller holds the lock.
+static void submit_block(void) {
+    cz.slots[cz.next_fill % (uint64_t)cz.nslots].state = SLOT_FILLED;
+    cz.next_fill++;
+    pthread_cond_broadcast(&cz.cv);
+    Slot *next = &cz.slots[cz.next_fill % (uint64_t)cz.nslots];
+    while (next->state != SLOT_FREE) pthread_cond_wait(&cz.cv, &cz.lock);
+}
+
+static size_t stream_write(const char *buf, size_t size) {
+    size_t done = 0;
+
+    pthread_mutex_lock(&cz.lock);
+    while (done < size) {
+        Slot *slot = &cz.slots[cz.next_fill % (uint64_t)cz.nslots];
+        size_t take = BLOCK_SIZE - slot->in_len;
+        if (take > size - done) take = size - done;
+        memcpy(slot->in + slot->in_len, buf + done, take);
+        slot->in_len += take;
+        done += take;
+        if (slot->in_len == BLOCK_SIZE) submit_block();
+    }
+    pthread_mutex_unlock(&cz.lock);
+    return done;
+}
+
+#ifdef __APPLE__
+static int cookie_write(void *cookie, const char *buf, int size) {
+    (void)cookie;
+    return (int)stream_write(buf, (size_t)size);
+}
+#else
+static ssize_t cookie_write(void *cookie, const char *buf, size_t size) {
+    (void)cookie;
+    return (ssize_t)stream_write(buf, size);
+}
+#endif
+
+static int cookie_close(void *cookie) {
+    (void)cookie;
+    return 0;
+}
+
+// ========================================
+// Public API
+// ========================================
+
+int compress_start(const Options *opts) {
+    if (!opts->compress) return 0;
+
+    if (strcmp(opts->compress, "gzip") == 0) {
+        cz.codec = CODEC_GZIP;
+#ifndef HAVE_ZLIB
+        fprintf(stderr, "Error: --compress=gzip needs zlib, which this build lacks\n");
+        return 1;
+#endif
+    } else if (strcmp(opts->compress, "zstd") == 0) {
+        cz.codec = CODEC_ZSTD;
+#ifndef HAVE_ZSTD
+        fprintf(stderr, "Error: --compress=zstd needs libzstd, which this build lacks\n");
+        return 1;
+#endif
+    } else {
+        fprintf(stderr, "Error: invalid value for --compress: '%s'\n", opts->compress);
+        return 1;
+    }
+
+    fflush(stdout);
+#ifdef __APPLE__
+    FILE *stream = funopen(NULL, NULL, cookie_write, NULL, cookie_close);
+#else
+    cookie_io_functions_t funcs = { .write = cookie_write, .close = cookie_close };
+    FILE *stream = fopencookie(NULL, "w", funcs);
+#endif
+    if (!stream) {
+        perror("compress");
+        return 1;
+    }
+
+    cz.nthreads = opts->jobs > 0 ? opts->jobs : 1;
+    cz.nslots = cz.nthreads * SLOTS_PER_JOB + 1;
+    cz.slots = xcalloc((size_t)cz.nslots, sizeof(Slot));
+    size_t bound = out_bound();
+    for (int i = 0; i < cz.nslots; i++) {
+        cz.slots[i].in = xmalloc(BLOCK_SIZE);
+        cz.slots[i].out = xmalloc(bound);
+        cz.slots[i].out_cap = bound;
+    }
+
+    cz.threads = xcalloc((size_t)cz.nthreads, sizeof(pthread_t));
+    int started = 0;
+    while (started < cz.nthreads &&
+           pthread_create(&cz.threads[started], NULL, compress_main, NULL) == 0)
+        started++;
+    if (started == 0 || pthread_create(&cz.writer, NULL, writer_main, NULL) != 0) {
+        fprintf(stderr, "Fatal: Unable to start compression threads.\n");
+        exit(EXIT_FAILURE);
+    }
+    cz.nthreads = started;
+
+    // Whole blocks go straight through; the stream's own buffer only has to
+    // batch the many small writes of a listing.
+    setvbuf(stream, NULL, _IOFBF, 64 * 1024);
+    cz.orig = stdout;
+    cz.fd = fileno(stdout);
+    stdout = stream;
+    cz.active = true;
+    return 0;
+}
+
+int compress_finish(void) {
+    if (!cz.active) return 0;
+
+    fclose(stdout);
+    stdout = cz.orig;
+
+    pthread_mutex_lock(&cz.lock);
+    if (cz.slots[cz.next_fill % (uint64_t)cz.nslots].in_len > 0) {
+        cz.slots[cz.next_fill % (uint64_t)cz.nslots].state = SLOT_FILLED;
+        cz.next_fill++;
+    }
+    cz.closing = true;
+    pthread_cond_broadcast(&cz.cv);
+    pthread_mutex_unlock(&cz.lock);
+
+    for (int i = 0; i < cz.nthreads; i++) pthread_join(cz.threads[i], NULL);
+    pthread_join(cz.writer, NULL);
+
+    for (int i = 0; i < cz.nslots; i++) {
+        free(cz.slots[i].in);
+        free(cz.slots[i].out);
+    }
+    free(cz.slots);
+    free(cz.threads);
+    cz.active = false;
+    if (cz.failed) fprintf(stderr, "Error: compressed output could not be written\n");
+    return cz.failed ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+/*
+ * compress.h - Threaded output compression for --compress
+ * -------------------------------------------------------
+ * With --compress=gzip (or zstd) everything gls writes to stdout is cut
+ * into blocks that a pool of threads compresses in parallel, and a writer
+ * thread puts the results out in order.  Each block becomes a complete gzip
+ * member or zstd frame, and concatenations of those are valid streams, so
+ * gunzip, zcat and zstd -d read the output like any other file.
+ *
+ * Each codec is available when its library was found at build time
+ * (HAVE_ZLIB, HAVE_ZSTD); asking for a missing one is an error.
+ */
+
+#include "gls.h"
+
+// Put stdout behind the compressor.  Returns non-zero (after printing why)
+// if the codec is unknown or not built in.
+int compress_start(const Options *opts);
+
+// Flush the last block, wait for the writer and restore stdout.  Returns
+// non-zero if anything could not be written.  Safe to call when inactive.
+int compress_finish(void);
+
+#endif
@@ -0,0 +1,252 @@
+/*
+ * dircount.c - Child counts of listed directories for --dir-counts
+ * ----------------------------------------------------------------
+ * A count needs only the names, so on the filesystem each subdirectory is
+ * opened relative to its parent's fd and read with readdir() straight from
+ * the getdents buffer: nothing is copied, sorted or stat'ed.  Counting
+ * subdirectories usually needs no read at all: a directory's link count is
+ * two plus its subdirectories on the classic Unix filesystems.  Some
+ * (btrfs, many network and FUSE filesystems) report 1 instead; such a device
+ * is remembered and falls back to reading, with fstatat() only for entries
+ * whose d_type is unknown.  The link count also covers hidden directories,
+ * so the shortcut is only taken with -a.
+ *
+ * The directories of one listing are counted in parallel: the caller and
+ * any helper threads take the next directory from a shared index.  Helpers
+ * come from a token pool of --jobs - 1 shared by the whole run, so the -R
+ * workers, which count their own listings, never exceed that between them;
+ * when the pool is empty the caller simply counts everything itself.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "gls.h"
+#include "backend.h"
+#include "dircount.h"
+
+#define MAX_NLINK_DEVS  64
+#define DIRS_PER_HELPER 4       // fewer directories than this are not worth a thread
+
+static int mode = DIR_COUNT_OFF;
+static bool show_all = false;
+static atomic_int spare_threads;
+
+// Devices whose directory link counts do not track subdirectories.
+static dev_t nlink_devs[MAX_NLINK_DEVS];
+static int nlink_count = 0;
+static pthread_mutex_t nlink_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void dircount_init(const Options *opts) {
+    mode = opts->dir_counts;
+    show_all = opts->show_all;
+    atomic_init(&spare_threads, opts->jobs > 1 ? opts->jobs - 1 : 0);
+}
+
+bool dircount_enabled(void) {
+    return mode != DIR_COUNT_OFF;
+}
+
+// ========================================
+// Counting One Directory
+// ========================================
+
+static bool nlink_unreliable(dev_t dev) {
+    bool found = false;
+    pthread_mutex_lock(&nlink_lock);
+    for (int i = 0; i < nlink_count && !found; i++) found = nlink_devs[i] == dev;
+    pthread_mutex_unlock(&nlink_lock);
+    return found;
+}
+
+static void mark_nlink_unreliable(dev_t dev) {
+    pthread_mutex_lock(&nlink_lock);
+    bool known = false;
+    for (int i = 0; i < nlink_count && !known; i++) known = nlink_devs[i] == dev;
+    if (!known && nlink_count < MAX_NLINK_DEVS) nlink_devs[nlink_count++] = dev;
+    pthread_mutex_unlock(&nlink_lock);
+}
+
+// The link-count answer for --dir-counts=subdirs, or -1 if it cannot be used.
+static long long count_from_nlink(const struct stat *st) {
+    if (mode != DIR_COUNT_SUBDIRS || !show_all) return -1;
+    if (st->st_nlink < 2) {
+        mark_nlink_unreliable(st->st_dev);
+        return -1;
+    }
+    if (nlink_unreliable(st->st_dev)) return -1;
+    return (long long)st->st_nlink - 2;
+}
+
+static bool counted_name(const char *name) {
+    if (name[0] != '.') return true;
+    if (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')) return false;
+    return show_all;
+}
+
+// Read the directory `name` relative to `pfd` (or the full `path` when
+// `pfd` is -1) from the live filesystem.
+static long long count_fs(int pfd, const char *name, const char *path) {
+    int fd = pfd >= 0 ? openat(pfd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)
+                      : open(path, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd < 0) return -2;
+    DIR *dir = fdopendir(fd);
+    if (!dir) {
+        close(fd);
+        return -2;
+    }
+
+    long long count = 0;
+    struct dirent *entry;
+    errno = 0;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!counted_name(entry->d_name)) continue;
+        if (mode == DIR_COUNT_ENTRIES) {
+            count++;
+            continue;
+        }
+#ifdef DT_UNKNOWN
+        if (entry->d_type != DT_UNKNOWN) {
+            count += entry->d_type == DT_DIR;
+            continue;
+        }
+#endif
+        struct stat st;
+        if (fstatat(dirfd(dir), entry->d_name, &st, AT_SYMLINK_NOFOLLOW) == 0 &&
+            S_ISDIR(st.st_mode))
+            count++;
+    }
+    if (errno != 0) count = -2;
+    closedir(dir);
+    return count;
+}
+
+// Any other source: read the names through the backend and drop them.
+static long long count_backend(const char *path) {
+    BackendDir *dir = backend_open_dir(path);
+    if (!dir) return -2;
+
+    FileEntry batch[BACKEND_BATCH];
+    long long count = 0;
+    int n;
+    while ((n = backend_next_batch(dir, batch, BACKEND_BATCH)) > 0) {
+        for (int i = 0; i < n; i++) {
+            if (counted_name(batch[i].name)) {
+                if (mode == DIR_COUNT_ENTRIES) {
+                    count++;
+                } else if (batch[i].d_type != 0) {
+                    count += batch[i].d_type == DT_DIR;
+                } else {
+                    char child[PATH_MAX];
+                    struct stat st;
+                    join_path(child, sizeof(child), path, batch[i].name);
+                    count += backend_lstat(child, &st) == 0 && S_ISDIR(st.st_mode);
+                }
+            }
+            free(batch[i].name);
+        }
+    }
+    backend_close_dir(dir);
+    return n < 0 ? -2 : count;
+}
+
+static long long count_one(int pfd, const char *dir, const FileEntry *fe, bool fs) {
+    long long count = count_from_nlink(&fe->st);
+    if (count >= 0) return count;
+
+    char path[PATH_MAX];
+    join_path(path, sizeof(path), dir, fe->name);
+    return fs ? count_fs(pfd, fe->name, path) : count_backend(path);
+}
+
+long long dircount_entry(const char *fullpath, const struct stat *st) {
+    if (mode == DIR_COUNT_OFF || !S_ISDIR(st->st_mode)) return -1;
+    long long count = count_from_nlink(st);
+    if (count >= 0) return count;
+    return backend_is_fs() ? count_fs(-1, NULL, fullpath) : count_backend(fullpath);
+}
+
+// ========================================
+// Counting a Listing
+// ========================================
+
+typedef struct {
+    const char *path;
+    int pfd;
+    bool fs;
+    FileEntry *entries;
+    const int *dirs;        // indices of the directory entries
+    int count;
+    atomic_int next;
+} CountJob;
+
+static void run_job(CountJob *job) {
+    int i;
+    while ((i = atomic_fetch_add_explicit(&job->next, 1, memory_order_relaxed)) < job->count) {
+        FileEntry *fe = &job->entries[job->dirs[i]];
+        fe->child_count = count_one(job->pfd, job->path, fe, job->fs);
+    }
+}
+
+static void *helper_main(void *arg) {
+    run_job(arg);
+    return NULL;
+}
+
+// Take up to `want` tokens from the pool; returns how many were granted.
+static int take_threads(int want) {
+    int spare = atomic_load(&spare_threads);
+    while (spare > 0) {
+        int take = spare < want ? spare : want;
+        if (atomic_compare_exchange_weak(&spare_threads, &spare, spare - take)) return take;
+    }
+    return 0;
+}
+
+void dircount_listing(const char *path, DirListing *list) {
+    if (mode == DIR_COUNT_OFF) return;
+
+    int *dirs = xmalloc((size_t)(list->count > 0 ? list->count : 1) * sizeof(int));
+    int ndirs = 0;
+    for (int i = 0; i < list->count; i++) {
+        list->entries[i].child_count = -1;
+        if (S_ISDIR(list->entries[i].st.st_mode)) dirs[ndirs++] = i;
+    }
+    if (ndirs == 0) {
+        free(dirs);
+        return;
+    }
+
+    CountJob job = {
+        .path = path,
+        .pfd = -1,
+        .fs = backend_is_fs(),
+        .entries = list->entries,
+        .dirs = dirs,
+        .count = ndirs,
+    };
+    atomic_init(&job.next, 0);
+    if (job.fs) job.pfd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    pthread_t helpers[64];
+    int want = ndirs / DIRS_PER_HELPER;
+    if (want > 64) want = 64;
+    int granted = want > 0 ? take_threads(want) : 0;
+    int started = 0;
+    while (started < granted &&
+           pthread_create(&helpers[started], NULL, helper_main, &job) == 0)
+        started++;
+
+    run_job(&job);
+    for (int i = 0; i < started; i++) pthread_join(helpers[i], NULL);
+    if (granted > 0) atomic_fetch_add(&spare_threads, granted);
+
+    if (job.pfd >= 0) close(job.pfd);
+    free(dirs);
+}
@@ -0,0 +1,30 @@
+#ifndef DIRCOUNT_H
+#define DIRCOUNT_H
+
+/*
+ * dircount.h - Child counts of listed directories for --dir-counts
+ * ----------------------------------------------------------------
+ * With --dir-counts every directory in a listing shows how many entries it
+ * holds (hidden ones only with -a); --dir-counts=subdirs shows how many
+ * subdirectories instead.  The subdirectories of one listing are counted
+ * concurrently on a pool bounded by --jobs across the whole run, so nested
+ * -R workers never multiply the thread count.
+ */
+
+#include <stdbool.h>
+#include <sys/stat.h>
+#include "gls.h"
+
+enum { DIR_COUNT_OFF, DIR_COUNT_ENTRIES, DIR_COUNT_SUBDIRS };
+
+void dircount_init(const Options *opts);
+bool dircount_enabled(void);
+
+// Fill child_count of every entry: the count for directories, -1 for
+// anything else, -2 for a directory that could not be read.
+void dircount_listing(const char *path, DirListing *list);
+
+// The same for one entry named on its own.
+long long dircount_entry(const char *fullpath, const struct stat *st);
+
+#endif
@@ -4,7 +4,7 @@
  * The routines in this file take the raw metadata gathered by gls.c and turn
  * it into user-friendly terminal output.  This includes:
  *   - Translating struct stat fields into POSIX permission strings.
- *   - Formatting timestamps and sizes so they are easy to scan.
+ *   - Formatting sizes so they are easy to scan (timestamps: timefmt.c).
  *   - Resolving symlink targets and sanitising control characters to avoid
  *     confusing terminal rendering.
  *
@@ -13,34 +13,37 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
 #include <time.h>
 #include <ctype.h>
 #include "gls.h"
 #include "display.h"
+#include "backend.h"
+#include "xattr.h"
+#include "timefmt.h"
+#include "dircount.h"
 
 /**
  * Print a single file entry
  *
+ * @param out       Stream to render into (stdout, or a per-directory buffer
+ *                  when listings are produced by worker threads).
  * @param path      The directory path used to resolve symlink targets.  For
  *                  direct file arguments this is an empty string so the raw
  *                  filename is used.
- * @param filename  The leaf name as returned by readdir()/lstat().
- * @param st        File metadata snapshot, already populated by the caller.
+ * @param fe        The entry: its leaf name as returned by readdir()/lstat(),
+ *                  its metadata and the --xattrs/--time details, already
+ *                  populated by the caller.
  * @param stats     Running totals shared across entries so we can produce a
  *                  summary for single-directory listings.
  */
-void print_file_entry(const char *path, const char *filename,
-                     const struct stat *st, FileStats *stats) {
-    char perms[11];
-    char username[256];
-    char groupname[256];
-    char timestr[64];
+void print_file_entry(FILE *out, const char *path, const FileEntry *fe, FileStats *stats) {
+    const char *filename = fe->name;
+    const struct stat *st = &fe->st;
     char linkbuf[PATH_MAX];
-    char safe_filename[PATH_MAX];
     char fullpath[PATH_MAX];
-    char display_size[32];
 
     if (S_ISLNK(st->st_mode)) {
         struct stat target_st;
@@ -52,7 +55,7 @@ void print_file_entry(const char *path, const char *filename,
         }
         // When a symlink resolves to a directory we count it separately so the
         // summary distinguishes "links to dirs" from regular symlinks.
-        if (stat(fullpath, &target_st) == 0) {
+        if (backend_stat(fullpath, &target_st) == 0) {
             // Avoid recursing into symlink loops
             if (S_ISLNK(target_st.st_mode))
                 stats->symlinks++;
@@ -66,22 +69,7 @@ void print_file_entry(const char *path, const char *filename,
     } else if (S_ISDIR(st->st_mode)) stats->directories++;
     else if (S_ISREG(st->st_mode)) stats->regular_files++;
 
-    get_permissions(st->st_mode, perms);
-    get_username(st->st_uid, username, sizeof(username));
-    get_groupname(st->st_gid, groupname, sizeof(groupname));
-    get_mod_time(st->st_mtime, timestr, sizeof(timestr));
-    sanitize_string(safe_filename, filename, sizeof(safe_filename));
-    human_size((long long)st->st_size, display_size, sizeof(display_size)-1);
-
-    printf("%s %2lu %-8s %-8s %6s %s %s",
-           perms,
-           (unsigned long)st->st_nlink,
-           username,
-           groupname,
-           display_size,
-           timestr,
-           safe_filename);
-
+    const char *target = NULL;
     if (S_ISLNK(st->st_mode)) {
         if (path[0] == '\0') {
             // Fullpath already contains the filename for single file arguments.
@@ -92,24 +80,268 @@ void print_file_entry(const char *path, const char *filename,
         // ensures linkbuf is large enough for most paths.  We still sanitise
         // the output in get_link_target() to guarantee a clean display.
         if (get_link_target(fullpath, linkbuf, sizeof(linkbuf)) == 0)
-            printf(" -> %s", linkbuf);
+            target = linkbuf;
     }
-    printf("\n");
+    print_entry_line(out, fe, target);
 }
 
-// ----------------- Human readable file size -------------------
-// Converts a size in bytes (off_t) to a human-readable string (e.g., 4.5K, 2.1M).
-void human_size(off_t bytes, char *out, size_t outsz){
-    const char *units[] = {"B", "K", "M", "G", "T"};
-    double size = (double)bytes;
+/**
+ * Render the long-format line for one entry from metadata alone.  Nothing is
+ * read from the filesystem, so this also serves entries that come from a
+ * saved snapshot rather than a live directory.
+ *
+ * @param link_target  Symlink target to show after " -> ", or NULL.
+ *
+ * An xattr indicator of '\0' prints as "none" when --xattrs is on.  With
+ * --dir-counts a child count column follows the size: blank for anything
+ * but a directory, "?" for one that could not be read.
+ */
+void print_entry_line(FILE *out, const FileEntry *fe, const char *link_target) {
+    const struct stat *st = &fe->st;
+    char perms[12];
+    char username[256];
+    char groupname[256];
+    char timestr[64];
+    char safe_filename[PATH_MAX];
+    char display_size[32];
+
+    get_permissions(st->st_mode, perms);
+    if (xattr_enabled()) {
+        perms[10] = fe->xattr ? fe->xattr : ' ';
+        perms[11] = '\0';
+    }
+    get_username(st->st_uid, username, sizeof(username));
+    get_groupname(st->st_gid, groupname, sizeof(groupname));
+    timefmt_format(fe->time, timestr, sizeof(timestr));
+    sanitize_string(safe_filename, fe->name, sizeof(safe_filename));
+    format_size(st, display_size, sizeof(display_size));
+
+    if (display_show_blocks()) {
+        char blocks[32];
+        format_blocks((unsigned long long)st->st_blocks, blocks, sizeof(blocks));
+        fprintf(out, "%5s ", blocks);
+    }
+    fprintf(out, "%s %2lu %-8s %-8s %6s",
+           perms,
+           (unsigned long)st->st_nlink,
+           username,
+           groupname,
+           display_size);
+    if (dircount_enabled()) {
+        char count[24] = "";
+        if (fe->child_count >= 0) snprintf(count, sizeof(count), "%lld", fe->child_count);
+        else if (fe->child_count == -2) strcpy(count, "?");
+        fprintf(out, " %6s", count);
+    }
+    fprintf(out, " %s %s", timestr, safe_filename);
+
+    if (link_target) {
+        char safe_target[PATH_MAX];
+        sanitize_string(safe_target, link_target, sizeof(safe_target));
+        fprintf(out, " -> %s", safe_target);
+    }
+    fputc('\n', out);
+}
+
+// ========================================
+// Size Formatting
+// ========================================
+// Every size cell goes through these, so they avoid floating point and
+// printf: digits are produced by integer division straight into the buffer.
+
+#define SIZE_TEXT 32
+
+static const char *const units_1024[] = {"B", "K", "M", "G", "T"};
+static const char *const units_1000[] = {"B", "k", "M", "G", "T"};
+
+static struct {
+    bool scaled;                    // one decimal and a unit letter
+    unsigned base;                  // 1024, or 1000 for --si
+    unsigned long long unit;        // block size otherwise
+    char suffix[8];                 // shown after block counts ("K" for --block-size=K)
+    bool disk_scaled;               // same three, for -s and "total"
+    unsigned long long disk_unit;
+    char disk_suffix[8];
+    bool show_blocks;               // -s column
+} sizes = { .scaled = true, .base = 1024, .unit = 1, .disk_unit = 1024 };
+
+static size_t put_uint(char *out, unsigned long long value) {
+    char rev[24];
+    size_t n = 0, len = 0;
+    do {
+        rev[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    while (n > 0) out[len++] = rev[--n];
+    return len;
+}
+
+static void put_text(char *out, size_t outsz, const char *text, size_t len) {
+    if (outsz == 0) return;
+    if (len >= outsz) len = outsz - 1;
+    memcpy(out, text, len);
+    out[len] = '\0';
+}
+
+// Divide down by `base` while the value allows and a unit is left, then
+// print one decimal, rounded half-to-even like printf("%.1f") would.
+static size_t put_scaled(char *out, unsigned long long value, unsigned base,
+                         const char *const units[]) {
+    unsigned long long div = 1;
     int u = 0;
-    // Loop while size is >= 1024 and we have a unit to move up to
-    while (size >= 1024.0 && u < 4) {
-        size /= 1024.0;
+    while (u < 4 && value / div >= base) {
+        div *= base;
         u++;
     }
-    // Format the output string with 1 decimal place and the unit
-    snprintf(out, outsz, (u == 0) ? "%.0f%s" : "%.1f%s", size, units[u]);
+
+    size_t len;
+    if (u == 0) {
+        len = put_uint(out, value);
+    } else {
+        unsigned long long whole = value / div;
+        unsigned long long scaled_rem = value % div * 10;
+        unsigned long long tenths = scaled_rem / div, rest = scaled_rem % div;
+        if (rest * 2 > div || (rest * 2 == div && (tenths & 1))) tenths++;
+        if (tenths == 10) {
+            whole++;
+            tenths = 0;
+        }
+        len = put_uint(out, whole);
+        out[len++] = '.';
+        out[len++] = (char)('0' + tenths);
+    }
+    for (const char *s = units[u]; *s; s++) out[len++] = *s;
+    return len;
+}
+
+// Converts a size in bytes (off_t) to a human-readable string (e.g., 4.5K, 2.1M).
+void human_size(off_t bytes, char *out, size_t outsz) {
+    char buf[SIZE_TEXT];
+    size_t len = 0;
+    unsigned long long value = (unsigned long long)bytes;
+    if (bytes < 0) {
+        // Never scaled, exactly as before.
+        buf[len++] = '-';
+        len += put_uint(buf + len, 0ULL - value);
+        buf[len++] = 'B';
+    } else {
+        len = put_scaled(buf, value, 1024, units_1024);
+    }
+    put_text(out, outsz, buf, len);
+}
+
+// A count of `unit`-sized blocks, rounded up unless `floor` is set.
+static size_t put_blocks(char *out, unsigned long long bytes, unsigned long long unit,
+                         bool floor, const char *suffix) {
+    unsigned long long count = floor ? bytes / unit : bytes / unit + (bytes % unit != 0);
+    size_t len = put_uint(out, count);
+    for (const char *s = suffix; *s; s++) out[len++] = *s;
+    return len;
+}
+
+// Parse a GNU-style block size: "K", "1K", "KiB", "MB", "4096", "si" or
+// "human-readable".  A bare unit letter keeps the letter on the output.
+static bool parse_block_size(const char *spec) {
+    const char *p = spec;
+    unsigned long long count = 1;
+    bool has_count = false;
+
+    if (strcmp(spec, "human-readable") == 0) return true;
+    if (strcmp(spec, "si") == 0) {
+        sizes.base = 1000;
+        return true;
+    }
+    if (*p >= '0' && *p <= '9') {
+        char *end;
+        count = strtoull(p, &end, 10);
+        p = end;
+        has_count = true;
+    }
+    static const char letters[] = "KMGTPE";
+    const char *letter = *p ? strchr(letters, toupper((unsigned char)*p)) : NULL;
+    unsigned long long mult = 1;
+    if (letter) {
+        const char *unit = p;
+        unsigned base = 1024;
+        p++;
+        if (p[0] == 'i' && p[1] == 'B') p += 2;
+        else if (p[0] == 'B') { base = 1000; p++; }
+        for (const char *l = letters; l <= letter; l++) {
+            if (mult > ~0ULL / base) return false;
+            mult *= base;
+        }
+        if (!has_count) snprintf(sizes.suffix, sizeof(sizes.suffix), "%.*s", (int)(p - unit), unit);
+    }
+    if (*p != '\0' || count == 0 || count > ~0ULL / mult) return false;
+
+    sizes.scaled = false;
+    sizes.unit = sizes.disk_unit = count * mult;
+    memcpy(sizes.disk_suffix, sizes.suffix, sizeof(sizes.suffix));
+    return true;
+}
+
+int display_init(const Options *opts) {
+    const char *spec = opts->block_size;
+    if (!spec) spec = getenv("LS_BLOCK_SIZE");
+    if (!spec) spec = getenv("BLOCK_SIZE");
+
+    if (spec && *spec && !parse_block_size(spec)) {
+        fprintf(stderr, "Error: invalid block size: '%s'\n", spec);
+        return 1;
+    }
+    if (opts->si) {
+        sizes.scaled = true;
+        sizes.base = 1000;
+    }
+    if (sizes.scaled) {
+        // Whole KiB for -s and "total", as before, unless --si asks for
+        // scaled figures everywhere.
+        sizes.disk_scaled = sizes.base == 1000;
+        sizes.disk_unit = 1024;
+        sizes.suffix[0] = sizes.disk_suffix[0] = '\0';
+    }
+    if (opts->kibibytes) {
+        sizes.disk_scaled = false;
+        sizes.disk_unit = 1024;
+        sizes.disk_suffix[0] = '\0';
+    }
+    sizes.show_blocks = opts->show_blocks;
+    return 0;
+}
+
+bool display_show_blocks(void) {
+    return sizes.show_blocks;
+}
+
+// The size column.
+void format_size(const struct stat *st, char *out, size_t outsz) {
+    char buf[SIZE_TEXT];
+    size_t len;
+
+    if (st->st_size < 0) {
+        human_size(st->st_size, out, outsz);
+        return;
+    }
+    unsigned long long bytes = (unsigned long long)st->st_size;
+    if (sizes.scaled)
+        len = put_scaled(buf, bytes, sizes.base, sizes.base == 1000 ? units_1000 : units_1024);
+    else
+        len = put_blocks(buf, bytes, sizes.unit, false, sizes.suffix);
+    put_text(out, outsz, buf, len);
+}
+
+// Allocated space (-s, and the "total" line) from a count of 512-byte
+// blocks.  The default of whole KiB rounds down, as "total" always has.
+void format_blocks(unsigned long long blocks, char *out, size_t outsz) {
+    char buf[SIZE_TEXT];
+    size_t len;
+    unsigned long long bytes = blocks * 512;
+
+    if (sizes.disk_scaled)
+        len = put_scaled(buf, bytes, sizes.base, units_1000);
+    else
+        len = put_blocks(buf, bytes, sizes.disk_unit, sizes.disk_unit == 1024, sizes.disk_suffix);
+    put_text(out, outsz, buf, len);
 }
 
 /**
@@ -150,26 +382,3 @@ void get_permissions(mode_t mode, char *perms) {
     perms[9] = (mode & S_ISVTX) ? ((mode & S_IXOTH) ? 't' : 'T') : ((mode & S_IXOTH) ? 'x' : '-');
     perms[10] = '\0';
 }
-
-/**
- * Format modification time using the same cut-off as BSD/GNU ls: recent files
- * show hours/minutes, while older files show the year.  Negative diffs indicate
- * clock skew and also fall back to the year format.
- */
-void get_mod_time(time_t mtime, char *timestr, size_t len) {
-    struct tm *tm_info;
-    time_t now = time(NULL);
-    double diff = difftime(now, mtime);
-
-    tm_info = localtime(&mtime);
-    if (!tm_info) {
-        strncpy(timestr, "??? ?? ??:??", len);
-        return;
-    }
-
-    if (diff > 15778800 || diff < 0) {
-        strftime(timestr, len, "%b %e  %Y", tm_info);
-    } else {
-        strftime(timestr, len, "%b %e %H:%M", tm_info);
-    }
-}
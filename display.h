@@ -11,10 +11,17 @@
 
 #include "gls.h"
 
-void print_file_entry(const char *path, const char *filename, const struct stat *st, FileStats *stats);
+void print_file_entry(FILE *out, const char *path, const FileEntry *fe, FileStats *stats);
+void print_entry_line(FILE *out, const FileEntry *fe, const char *link_target);
 void human_size(off_t bytes, char *out, size_t outsz);
+
+// Size columns per --block-size, --si, -k and -s; returns non-zero (after
+// printing why) on an invalid block size.
+int display_init(const Options *opts);
+bool display_show_blocks(void);
+void format_size(const struct stat *st, char *out, size_t outsz);
+void format_blocks(unsigned long long blocks, char *out, size_t outsz);
 void sanitize_string(char *dest, const char *src, size_t max_len);
 void get_permissions(mode_t mode, char *perms);
-void get_mod_time(time_t mtime, char *timestr, size_t len);
 
 #endif
@@ -0,0 +1,396 @@
+/*
+ * dupes.c - Duplicate-content finder for --duplicates
+ * ---------------------------------------------------
+ * Reading file contents is by far the most expensive thing gls can do, so
+ * candidates are narrowed down in stages and each stage only reads what the
+ * previous one could not rule out:
+ *
+ *   1. Size.  The walk already lstat'ed every file; only sizes shared by two
+ *      or more distinct inodes go any further.  Hard links (same dev/ino) are
+ *      folded into one inode up front and never read twice.
+ *   2. Head/tail.  A 128-bit hash of the first and last PARTIAL_BLOCK bytes.
+ *      For files no larger than two blocks this already covers every byte.
+ *   3. Full contents, only for inodes still colliding after stage 2.
+ *
+ * Stages 2 and 3 run on a pool of opts->jobs threads handing out work with an
+ * atomic cursor.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "gls.h"
+#include "display.h"
+#include "dupes.h"
+#include "hash.h"
+#include "walk.h"
+
+#define PARTIAL_BLOCK   4096
+#define READ_CHUNK      (1024 * 1024)
+#define HASH_SEED       0x676c73ULL
+
+typedef struct {
+    char *path;
+    off_t size;
+    dev_t dev;
+    ino_t ino;
+} Candidate;
+
+typedef struct {
+    Candidate *items;
+    int count;
+    int capacity;
+} CandidateList;
+
+// One distinct inode: candidates[first .. first + links - 1] share it.
+typedef struct {
+    int first;
+    int links;
+    off_t size;
+    HashValue hash;
+    bool complete;      // hash covers the whole file
+    bool failed;        // unreadable or changed while reading
+} Inode;
+
+typedef struct {
+    const Options *opts;
+    CandidateList all;
+} CollectCtx;
+
+typedef struct {
+    Inode **jobs;
+    int job_count;
+    atomic_int next;
+    bool full;
+    atomic_uint_fast64_t bytes_read;
+    const CandidateList *cands;
+} HashPool;
+
+static void candidate_push(CandidateList *list, const char *path, const struct stat *st) {
+    if (list->count >= list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        list->items = xrealloc(list->items, (size_t)list->capacity * sizeof(Candidate));
+    }
+    Candidate *c = &list->items[list->count++];
+    c->path = xstrdup(path);
+    c->size = st->st_size;
+    c->dev = st->st_dev;
+    c->ino = st->st_ino;
+}
+
+// ========================================
+// Collection (walk visitor)
+// ========================================
+
+static int visit_collect(WalkNode *node, FILE *out, void *ctx) {
+    const Options *opts = ((CollectCtx *)ctx)->opts;
+    const char *path = walk_node_path(node);
+    CandidateList *found = xcalloc(1, sizeof(CandidateList));
+    DirListing list;
+
+    (void)out;
+    if (scan_directory(path, opts, &list) != 0) {
+        walk_node_set_data(node, found, sizeof(CandidateList));
+        return 1;
+    }
+
+    for (int i = 0; i < list.count; i++) {
+        const FileEntry *fe = &list.entries[i];
+        char child[PATH_MAX];
+
+        join_path(child, sizeof(child), path, fe->name);
+        if (S_ISDIR(fe->st.st_mode))
+            walk_add_child(node, child);
+        else if (S_ISREG(fe->st.st_mode) && fe->st.st_size > 0)
+            candidate_push(found, child, &fe->st);
+    }
+    size_t bytes = sizeof(CandidateList) + (size_t)found->capacity * sizeof(Candidate);
+    for (int i = 0; i < found->count; i++) bytes += strlen(found->items[i].path) + 1;
+    walk_node_set_data(node, found, bytes);
+    free_listing(&list);
+    return 0;
+}
+
+// Runs on the walking thread, so appending to the global list needs no lock.
+static void emit_collect(WalkNode *node, const char *buf, size_t len, void *ctx) {
+    CandidateList *all = &((CollectCtx *)ctx)->all;
+    CandidateList *found = walk_node_data(node);
+
+    (void)buf;
+    (void)len;
+    if (!found) return;
+    if (all->count + found->count > all->capacity) {
+        all->capacity = (all->count + found->count) * 2;
+        all->items = xrealloc(all->items, (size_t)all->capacity * sizeof(Candidate));
+    }
+    memcpy(all->items + all->count, found->items, (size_t)found->count * sizeof(Candidate));
+    all->count += found->count;
+    free(found->items);
+    free(found);
+}
+
+// ========================================
+// Hashing Pool
+// ========================================
+
+// Read exactly `len` bytes at `offset` unless the file is shorter.
+static ssize_t read_at(int fd, void *buf, size_t len, off_t offset) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = pread(fd, (char *)buf + done, len - done, offset + (off_t)done);
+        if (n < 0) return -1;
+        if (n == 0) break;
+        done += (size_t)n;
+    }
+    return (ssize_t)done;
+}
+
+static void hash_inode(HashPool *pool, Inode *ino, unsigned char *buf) {
+    const char *path = pool->cands->items[ino->first].path;
+    Hash128 h;
+    uint64_t read_total = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        ino->failed = true;
+        return;
+    }
+    hash128_init(&h, HASH_SEED);
+
+    if (!pool->full) {
+        // Stage 2: head and tail only, or everything for small files.
+        bool whole = ino->size <= 2 * PARTIAL_BLOCK;
+        size_t head = whole ? (size_t)ino->size : PARTIAL_BLOCK;
+        ssize_t n = read_at(fd, buf, head, 0);
+        if (n == (ssize_t)head) {
+            hash128_update(&h, buf, head);
+            read_total += head;
+            if (!whole) {
+                n = read_at(fd, buf, PARTIAL_BLOCK, ino->size - PARTIAL_BLOCK);
+                if (n == PARTIAL_BLOCK) {
+                    hash128_update(&h, buf, PARTIAL_BLOCK);
+                    read_total += PARTIAL_BLOCK;
+                } else {
+                    ino->failed = true;
+                }
+            }
+        } else {
+            ino->failed = true;
+        }
+        ino->complete = whole;
+    } else {
+        // Stage 3: the whole file.
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        ssize_t n;
+        while ((n = read(fd, buf, READ_CHUNK)) > 0) {
+            hash128_update(&h, buf, (size_t)n);
+            read_total += (uint64_t)n;
+        }
+        if (n < 0 || read_total != (uint64_t)ino->size) ino->failed = true;
+        ino->complete = true;
+    }
+    close(fd);
+
+    ino->hash = hash128_final(&h);
+    atomic_fetch_add_explicit(&pool->bytes_read, read_total, memory_order_relaxed);
+}
+
+static void *hash_worker(void *arg) {
+    HashPool *pool = arg;
+    unsigned char *buf = xmalloc(READ_CHUNK);
+    int i;
+
+    while ((i = atomic_fetch_add(&pool->next, 1)) < pool->job_count)
+        hash_inode(pool, pool->jobs[i], buf);
+    free(buf);
+    return NULL;
+}
+
+static void run_pool(HashPool *pool, int threads) {
+    if (pool->job_count == 0) return;
+    if (threads > pool->job_count) threads = pool->job_count;
+    if (threads < 1) threads = 1;
+
+    atomic_store(&pool->next, 0);
+    pthread_t *tids = xcalloc((size_t)threads, sizeof(pthread_t));
+    int started = 0;
+    for (; started < threads; started++) {
+        if (pthread_create(&tids[started], NULL, hash_worker, pool) != 0) break;
+    }
+    if (started == 0) hash_worker(pool);
+    for (int i = 0; i < started; i++) pthread_join(tids[i], NULL);
+    free(tids);
+}
+
+// ========================================
+// Grouping
+// ========================================
+
+static int compare_candidates(const void *a, const void *b) {
+    const Candidate *ca = a, *cb = b;
+    if (ca->size != cb->size) return ca->size > cb->size ? -1 : 1;
+    if (ca->dev != cb->dev) return ca->dev < cb->dev ? -1 : 1;
+    if (ca->ino != cb->ino) return ca->ino < cb->ino ? -1 : 1;
+    return strcmp(ca->path, cb->path);
+}
+
+static int compare_inodes(const void *a, const void *b) {
+    const Inode *ia = *(Inode *const *)a, *ib = *(Inode *const *)b;
+    if (ia->size != ib->size) return ia->size > ib->size ? -1 : 1;
+    if (ia->hash.hi != ib->hash.hi) return ia->hash.hi < ib->hash.hi ? -1 : 1;
+    if (ia->hash.lo != ib->hash.lo) return ia->hash.lo < ib->hash.lo ? -1 : 1;
+    return ia->first - ib->first;
+}
+
+static bool same_content(const Inode *a, const Inode *b) {
+    return a->size == b->size && a->hash.hi == b->hash.hi && a->hash.lo == b->hash.lo;
+}
+
+// Keep only inodes that still share a (size, hash) key with another one.
+static int keep_colliding(Inode **set, int n) {
+    int kept = 0;
+    for (int i = 0; i < n;) {
+        int j = i + 1;
+        while (j < n && same_content(set[i], set[j])) j++;
+        if (j - i > 1) {
+            for (int k = i; k < j; k++) set[kept++] = set[k];
+        }
+        i = j;
+    }
+    return kept;
+}
+
+static int drop_failed(Inode **set, int n) {
+    int kept = 0;
+    for (int i = 0; i < n; i++) {
+        if (!set[i]->failed) set[kept++] = set[i];
+    }
+    return kept;
+}
+
+// ========================================
+// Public Entry Point
+// ========================================
+
+int find_duplicates(char **roots, int root_count, const Options *opts) {
+    CollectCtx ctx = { .opts = opts };
+    int result = 0;
+
+    WalkConfig cfg = {
+        .visit = visit_collect,
+        .emit = emit_collect,
+        .ctx = &ctx,
+        .jobs = opts->jobs,
+        .mem_limit = opts->buffer_mem,
+    };
+    for (int r = 0; r < root_count; r++) {
+        struct stat st;
+        if (lstat(roots[r], &st) != 0) {
+            perror(roots[r]);
+            result = 1;
+        } else if (S_ISDIR(st.st_mode)) {
+            if (walk_tree(roots[r], &cfg) != 0) result = 1;
+        } else if (S_ISREG(st.st_mode) && st.st_size > 0) {
+            candidate_push(&ctx.all, roots[r], &st);
+        }
+    }
+
+    CandidateList cands = ctx.all;
+
+    // Stage 1: fold hard links and keep sizes shared by distinct inodes.
+    qsort(cands.items, (size_t)cands.count, sizeof(Candidate), compare_candidates);
+    Inode *inodes = xcalloc(cands.count > 0 ? (size_t)cands.count : 1, sizeof(Inode));
+    int inode_count = 0;
+    for (int i = 0; i < cands.count;) {
+        int j = i + 1;
+        while (j < cands.count && cands.items[j].dev == cands.items[i].dev &&
+               cands.items[j].ino == cands.items[i].ino)
+            j++;
+        inodes[inode_count++] = (Inode){ .first = i, .links = j - i, .size = cands.items[i].size };
+        i = j;
+    }
+
+    Inode **set = xcalloc(inode_count > 0 ? (size_t)inode_count : 1, sizeof(Inode *));
+    int n = 0;
+    for (int i = 0; i < inode_count;) {
+        int j = i + 1;
+        while (j < inode_count && inodes[j].size == inodes[i].size) j++;
+        if (j - i > 1) {
+            for (int k = i; k < j; k++) set[n++] = &inodes[k];
+        }
+        i = j;
+    }
+
+    // Stage 2: head/tail hash.
+    HashPool pool = { .jobs = set, .job_count = n, .full = false, .cands = &cands };
+    atomic_init(&pool.bytes_read, 0);
+    run_pool(&pool, opts->jobs);
+    n = drop_failed(set, n);
+    qsort(set, (size_t)n, sizeof(Inode *), compare_inodes);
+    n = keep_colliding(set, n);
+
+    // Stage 3: full hash for whatever the head/tail could not settle.
+    Inode **full = xcalloc(n > 0 ? (size_t)n : 1, sizeof(Inode *));
+    int full_count = 0;
+    for (int i = 0; i < n; i++) {
+        if (!set[i]->complete) full[full_count++] = set[i];
+    }
+    pool.jobs = full;
+    pool.job_count = full_count;
+    pool.full = true;
+    run_pool(&pool, opts->jobs);
+    n = drop_failed(set, n);
+    qsort(set, (size_t)n, sizeof(Inode *), compare_inodes);
+    n = keep_colliding(set, n);
+
+    // Report, largest files first.
+    int sets = 0;
+    unsigned long long reclaimable = 0;
+    for (int i = 0; i < n;) {
+        int j = i + 1;
+        while (j < n && same_content(set[i], set[j])) j++;
+
+        char size[32], saving[32];
+        human_size(set[i]->size, size, sizeof(size));
+        human_size(set[i]->size * (j - i - 1), saving, sizeof(saving));
+        printf("%sDuplicate set %d: %d copies of %s (%s reclaimable)\n",
+               sets > 0 ? "\n" : "", sets + 1, j - i, size, saving);
+        for (int k = i; k < j; k++) {
+            const Inode *ino = set[k];
+            char safe[PATH_MAX];
+            sanitize_string(safe, cands.items[ino->first].path, sizeof(safe));
+            printf("  %s\n", safe);
+            for (int l = 1; l < ino->links; l++) {
+                sanitize_string(safe, cands.items[ino->first + l].path, sizeof(safe));
+                printf("    = %s (hard link)\n", safe);
+            }
+        }
+        reclaimable += (unsigned long long)set[i]->size * (unsigned long long)(j - i - 1);
+        sets++;
+        i = j;
+    }
+
+    char saved[32], read_bytes[32];
+    human_size((off_t)reclaimable, saved, sizeof(saved));
+    human_size((off_t)atomic_load(&pool.bytes_read), read_bytes, sizeof(read_bytes));
+    printf("%sSummary:\n", sets > 0 ? "\n" : "");
+    printf("  Files examined:     %d\n", cands.count);
+    printf("  Duplicate sets:     %d\n", sets);
+    printf("  Reclaimable:        %s\n", saved);
+    printf("  Data read:          %s\n", read_bytes);
+
+    for (int i = 0; i < cands.count; i++) free(cands.items[i].path);
+    free(cands.items);
+    free(inodes);
+    free(set);
+    free(full);
+    return result;
+}
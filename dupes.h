@@ -0,0 +1,15 @@
+#ifndef DUPES_H
+#define DUPES_H
+
+/*
+ * dupes.h - Duplicate-content finder for --duplicates
+ * ---------------------------------------------------
+ * Walks the given trees and reports sets of regular files with identical
+ * contents.
+ */
+
+#include "gls.h"
+
+int find_duplicates(char **roots, int root_count, const Options *opts);
+
+#endif
@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Generate unifold_table.h for unifold.c.
+
+Usage: python3 gen_unifold.py > unifold_table.h
+
+For every code point the fold key is NFD(casefold(NFD(c))), i.e. case
+folded and fully decomposed.  Only code points whose key differs from
+themselves are emitted.  Canonical combining classes are emitted as ranges
+so combining marks can be put into canonical order.  Hangul syllables are
+decomposed algorithmically by unifold.c and are skipped here.
+"""
+import unicodedata
+
+def key(c):
+    return unicodedata.normalize("NFD", unicodedata.normalize("NFD", c).casefold())
+
+folds, pool = [], []
+for cp in range(0x80, 0x110000):
+    if 0xD800 <= cp <= 0xDFFF or 0xAC00 <= cp <= 0xD7A3:
+        continue
+    c = chr(cp)
+    k = key(c)
+    if k != c:
+        folds.append((cp, len(pool), len(k)))
+        pool.extend(ord(x) for x in k)
+
+ranges = []
+for cp in range(0x300, 0x110000):
+    if 0xD800 <= cp <= 0xDFFF:
+        continue
+    ccc = unicodedata.combining(chr(cp))
+    if ccc:
+        if ranges and ranges[-1][1] == cp - 1 and ranges[-1][2] == ccc:
+            ranges[-1][1] = cp
+        else:
+            ranges.append([cp, cp, ccc])
+
+print("/*")
+print(" * unifold_table.h - Generated by gen_unifold.py from Unicode %s data." % unicodedata.unidata_version)
+print(" * Do not edit by hand.")
+print(" */")
+print()
+print("static const uint32_t fold_pool[%d] = {" % len(pool))
+for i in range(0, len(pool), 8):
+    print("    " + ", ".join("0x%04X" % v for v in pool[i:i + 8]) + ",")
+assert len(pool) < 0x10000, "fold_pool offsets are 16-bit"
+print("};")
+print()
+print("static const FoldEntry fold_table[%d] = {" % len(folds))
+for cp, off, n in folds:
+    print("    { 0x%04X, %d, %d }," % (cp, off, n))
+print("};")
+print()
+print("static const CccRange ccc_table[%d] = {" % len(ranges))
+for lo, hi, ccc in ranges:
+    print("    { 0x%04X, 0x%04X, %d }," % (lo, hi, ccc))
+print("};")
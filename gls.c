@@ -7,15 +7,38 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <dirent.h>
 #include <sys/stat.h>
 #include <pwd.h>
 #include <grp.h>
 #include <unistd.h>
 #include <locale.h>
+#include <pthread.h>
+#include <stdatomic.h>
 #include "gls.h"
 #include "display.h"
 #include "long_opt.h"
+#include "walk.h"
+#include "timing.h"
+#include "progress.h"
+#include "dupes.h"
+#include "collisions.h"
+#include "checknames.h"
+#include "compare.h"
+#include "snapshot.h"
+#include "backend.h"
+#include "capture.h"
+#include "idcache.h"
+#include "numa.h"
+#include "xattr.h"
+#include "timefmt.h"
+#include "dircount.h"
+#include "tree.h"
+#include "compress.h"
+#include "operands.h"
+#include "merge.h"
+#include "ring.h"
+#include "renderer.h"
+#include "where.h"
 
 // ========================================
 // Memory-Safe Allocation Helpers
@@ -83,6 +106,10 @@ static GidCache gid_cache[CACHE_SIZE];
 static int next_uid_slot = 0;
 static int next_gid_slot = 0;
 
+// getpwuid()/getgrgid() return static storage and the slots above are shared,
+// so lookups are serialised when listings are rendered on worker threads.
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
 void init_caches(void) {
     for (int i = 0; i < CACHE_SIZE; i++) {
         uid_cache[i].valid = false;
@@ -99,9 +126,15 @@ static const char *get_cached_username(uid_t uid, char *buf, size_t len) {
         }
     }
 
-    struct passwd *pw = getpwuid(uid);
-    if (pw && pw->pw_name) sanitize_string(buf, pw->pw_name, len);
-    else snprintf(buf, len, "%d", uid);
+    if (!idcache_lookup(ID_USER, uid, buf, len)) {
+        struct passwd *pw = getpwuid(uid);
+        if (pw && pw->pw_name) {
+            sanitize_string(buf, pw->pw_name, len);
+            idcache_store(ID_USER, uid, buf);
+        } else {
+            snprintf(buf, len, "%d", uid);
+        }
+    }
 
     uid_cache[next_uid_slot].uid = uid;
     strncpy(uid_cache[next_uid_slot].name, buf,
@@ -121,9 +154,15 @@ static const char *get_cached_groupname(gid_t gid, char *buf, size_t len) {
         }
     }
 
-    struct group *gr = getgrgid(gid);
-    if (gr && gr->gr_name) sanitize_string(buf, gr->gr_name, len);
-    else snprintf(buf, len, "%d", gid);
+    if (!idcache_lookup(ID_GROUP, gid, buf, len)) {
+        struct group *gr = getgrgid(gid);
+        if (gr && gr->gr_name) {
+            sanitize_string(buf, gr->gr_name, len);
+            idcache_store(ID_GROUP, gid, buf);
+        } else {
+            snprintf(buf, len, "%d", gid);
+        }
+    }
 
     gid_cache[next_gid_slot].gid = gid;
     strncpy(gid_cache[next_gid_slot].name, buf,
@@ -135,10 +174,14 @@ static const char *get_cached_groupname(gid_t gid, char *buf, size_t len) {
 }
 
 void get_username(uid_t uid, char *username, size_t len) {
+    pthread_mutex_lock(&cache_lock);
     get_cached_username(uid, username, len);
+    pthread_mutex_unlock(&cache_lock);
 }
 void get_groupname(gid_t gid, char *groupname, size_t len) {
+    pthread_mutex_lock(&cache_lock);
     get_cached_groupname(gid, groupname, len);
+    pthread_mutex_unlock(&cache_lock);
 }
 
 // ========================================
@@ -146,7 +189,7 @@ void get_groupname(gid_t gid, char *groupname, size_t len) {
 // ========================================
 
 int get_link_target(const char *path, char *target, size_t len) {
-    ssize_t ret = readlink(path, target, len - 1);
+    ssize_t ret = backend_readlink(path, target, len - 1);
     if (ret == -1) return -1;
     target[ret] = '\0';
     char temp[PATH_MAX];
@@ -156,19 +199,32 @@ int get_link_target(const char *path, char *target, size_t len) {
     return 0;
 }
 
+// Join a directory and a leaf name without doubling a trailing slash.
+void join_path(char *dest, size_t len, const char *dir, const char *name) {
+    size_t dlen = strlen(dir);
+    if (dlen > 0 && dir[dlen - 1] == '/')
+        snprintf(dest, len, "%s%s", dir, name);
+    else
+        snprintf(dest, len, "%s/%s", dir, name);
+}
+
 // ========================================
 // Sorting
 // ========================================
 
+// Set once in main() before any listing starts; listings may be sorted
+// concurrently on worker threads, so it is never reset.
 static const Options *sort_options_ptr = NULL;
 
 int compare_entries(const void *a, const void *b) {
     const FileEntry *ea = (const FileEntry *)a;
     const FileEntry *eb = (const FileEntry *)b;
 
+    if (sort_options_ptr->sort_by_count && ea->child_count != eb->child_count)
+        return ea->child_count > eb->child_count ? -1 : 1;
     if (sort_options_ptr->sort_by_time) {
-        if (ea->mtime > eb->mtime) return -1;
-        if (ea->mtime < eb->mtime) return 1;
+        if (ea->time.tv_sec > eb->time.tv_sec) return -1;
+        if (ea->time.tv_sec < eb->time.tv_sec) return 1;
     }
     return strcoll(ea->name, eb->name);
 }
@@ -177,117 +233,468 @@ int compare_entries(const void *a, const void *b) {
 // Directory Listing
 // ========================================
 
-int list_directory(const char *path, const Options *opts, bool show_header) {
-    DIR *dir;
-    struct dirent *entry;
-    FileEntry *entries = NULL;
-    int count = 0, capacity = 128;
-    FileStats stats = {0};
+// Read the visible names of `path` (and their d_type, where the source
+// reports one) without stat'ing anything.
+int enumerate_directory(const char *path, const Options *opts, DirListing *list) {
+    uint64_t t0 = timing_now();
 
-    dir = opendir(path);
+    memset(list, 0, sizeof(*list));
+    progress_enter(path);
+    BackendDir *dir = backend_open_dir(path);
     if (!dir) {
         perror(path);
         return 1;
     }
 
-    entries = xmalloc(capacity * sizeof(FileEntry));
-    while ((entry = readdir(dir)) != NULL) {
-        struct stat st;
-        char fullpath[PATH_MAX];
-
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
-            continue;
-        if (!opts->show_all && entry->d_name[0] == '.')
-            continue;
+    list->capacity = 128;
+    list->entries = arena_grow(NULL, 0, list->capacity * sizeof(FileEntry));
+    for (;;) {
+        if (list->count + BACKEND_BATCH > list->capacity) {
+            list->entries = arena_grow(list->entries, list->capacity * sizeof(FileEntry),
+                                       list->capacity * 2 * sizeof(FileEntry));
+            list->capacity *= 2;
+        }
+        FileEntry *batch = list->entries + list->count;
+        int n = backend_next_batch(dir, batch, BACKEND_BATCH);
+        if (n <= 0) break;
 
-        snprintf(fullpath, sizeof(fullpath), "%s/%s", path, entry->d_name);
-        if (lstat(fullpath, &st) == -1) continue;
+        for (int i = 0; i < n; i++) {
+            if (!opts->show_all && batch[i].name[0] == '.') free(batch[i].name);
+            else list->entries[list->count++] = batch[i];
+        }
+    }
+    backend_close_dir(dir);
+    list->enum_ns = timing_now() - t0;
+    return 0;
+}
 
-        stats.total_blocks += st.st_blocks;
-        if (count >= capacity) {
-            capacity *= 2;
-            entries = xrealloc(entries, capacity * sizeof(FileEntry));
+// lstat() every named entry, dropping any that vanished since enumeration.
+int stat_listing(const char *path, DirListing *list) {
+    uint64_t t1 = timing_now();
+
+    list->total_blocks = 0;
+    int kept = 0;
+    uint64_t pending_bytes = 0;
+    for (int base = 0; base < list->count; base += BACKEND_BATCH) {
+        bool ok[BACKEND_BATCH];
+        int n = list->count - base < BACKEND_BATCH ? list->count - base : BACKEND_BATCH;
+
+        backend_stat_batch(path, list->entries + base, n, ok);
+        timefmt_batch(path, list->entries + base, ok, n);
+        if (xattr_enabled()) xattr_batch(path, list->entries + base, ok, n);
+        for (int i = 0; i < n; i++) {
+            FileEntry *fe = &list->entries[base + i];
+            if (!ok[i]) {
+                free(fe->name);
+                continue;
+            }
+            list->total_blocks += fe->st.st_blocks;
+            list->entries[kept++] = *fe;
+
+            pending_bytes += (uint64_t)fe->st.st_size;
+            if (kept % PROGRESS_CHUNK == 0) {
+                progress_add(PROGRESS_CHUNK, pending_bytes);
+                pending_bytes = 0;
+            }
         }
+    }
+    list->count = kept;
+    progress_add((uint64_t)(kept % PROGRESS_CHUNK), pending_bytes);
+    progress_dir_done();
+    uint64_t t2 = timing_now();
+
+    list->stat_ns = t2 - t1;
+    return 0;
+}
+
+// The --xattrs, --time and --dir-counts details of one entry named on its
+// own (a file operand, a --check-names hit), which no stat batch covers.
+void load_entry_details(FileEntry *fe, const char *fullpath) {
+    fe->xattr = xattr_indicator(fullpath, &fe->st);
+    fe->time = timefmt_entry_time(fullpath, &fe->st);
+    fe->child_count = dircount_entry(fullpath, &fe->st);
+}
+
+// Huge directories are sorted in partitions across the workers' nodes.
+void sort_listing(DirListing *list) {
+    if (list->count >= SORT_PARTITION_MIN && sort_options_ptr->jobs > 1)
+        numa_sort(list->entries, list->count, sizeof(FileEntry), compare_entries,
+                  sort_options_ptr->jobs);
+    else
+        qsort(list->entries, list->count, sizeof(FileEntry), compare_entries);
+}
+
+// Enumerate first, then stat: keeping the two phases apart lets --slowest
+// tell a slow readdir() from a slow lstat() with a handful of clock reads.
+// The entries are left in directory order, for callers with their own.
+int scan_directory_unsorted(const char *path, const Options *opts, DirListing *list) {
+    if (enumerate_directory(path, opts, list) != 0) return 1;
+    // --incremental records whole directories, so nothing is skipped there.
+    if (!opts->incremental) where_prefilter(list, opts->recursive);
+    stat_listing(path, list);
+    dircount_listing(path, list);
+    return 0;
+}
+
+int scan_directory(const char *path, const Options *opts, DirListing *list) {
+    if (scan_directory_unsorted(path, opts, list) != 0) return 1;
+    sort_listing(list);
+    return 0;
+}
+
+void free_listing(DirListing *list) {
+    for (int i = 0; i < list->count; i++) free(list->entries[i].name);
+    arena_free(list->entries, (size_t)list->capacity * sizeof(FileEntry));
+    memset(list, 0, sizeof(*list));
+}
+
+// Headers, totals and blank separators belong to the long format only.
+static bool text_output(void) {
+    return !ring_active() && !renderer_active();
+}
+
+static void render_listing(FILE *out, const char *path, const DirListing *list,
+                           bool show_summary) {
+    FileStats stats = {0};
 
-        entries[count].name = xstrdup(entry->d_name);
-        entries[count].mtime = st.st_mtime;
-        entries[count].st = st;
-        count++;
+    if (ring_active()) {
+        ring_encode_listing(out, path, list->entries, list->count);
+        return;
+    }
+    if (renderer_active()) {
+        renderer_listing(out, path, list->entries, list->count);
+        return;
     }
-    closedir(dir);
 
-    if (show_header) printf("%s:\n", path);
-    printf("total %ld\n", stats.total_blocks / 2);
+    char total[32];
+    format_blocks((unsigned long long)list->total_blocks, total, sizeof(total));
+    fprintf(out, "total %s\n", total);
+    for (int i = 0; i < list->count; i++)
+        print_file_entry(out, path, &list->entries[i], &stats);
+
+    if (show_summary) {
+        fprintf(out, "\nSummary:\n");
+        fprintf(out, "  Regular files:      %d\n", stats.regular_files);
+        fprintf(out, "  Directories:        %d\n", stats.directories);
+        fprintf(out, "  Symlinks:           %d\n", stats.symlinks);
+        fprintf(out, "  Directory symlinks: %d\n", stats.dir_symlinks);
+    }
+}
 
-    sort_options_ptr = opts;
-    qsort(entries, count, sizeof(FileEntry), compare_entries);
-    sort_options_ptr = NULL;
+int list_directory(const char *path, const Options *opts, bool show_header) {
+    DirListing list;
+    uint64_t start = timing_now();
+
+    if (scan_directory(path, opts, &list) != 0) return 1;
+    where_apply(&list);
 
-    for (int i = 0; i < count; i++) {
-        print_file_entry(path, entries[i].name, &entries[i].st, &stats);
-        free(entries[i].name);
+    if (ring_active()) {
+        ring_put_listing(path, list.entries, list.count);
+    } else {
+        if (show_header && text_output()) printf("%s:\n", path);
+        render_listing(stdout, path, &list, !show_header);
     }
-    free(entries);
+    timing_record(path, list.enum_ns, list.stat_ns, timing_now() - start, list.count);
+    free_listing(&list);
+    return 0;
+}
+
+// ========================================
+// Recursive Listing
+// ========================================
+
+// State shared by every recursive walk of one run.
+typedef struct {
+    const Options *opts;
+    Snapshot *prev;             // --incremental: last run's snapshot (may be NULL)
+    SnapshotWriter *next;       // --incremental: snapshot being written
+    atomic_long reused;
+    atomic_long rescanned;
+} RecurseCtx;
+
+// A directory's snapshot record, handed from its worker to emit_recursive().
+typedef struct {
+    char *data;
+    size_t len;
+} SnapRecord;
+
+static RecurseCtx recurse_ctx;
+
+// With --incremental, a directory whose own mtime/ctime match the previous
+// snapshot cannot have gained, lost or renamed entries, so its recorded entry
+// list is reused instead of reading the directory again.
+static int load_listing(RecurseCtx *rc, WalkNode *node, DirListing *list) {
+    const char *path = walk_node_path(node);
+    struct stat dir_st;
+
+    if (!rc->next) return scan_directory(path, rc->opts, list);
 
-    if (!show_header) {
-        printf("\nSummary:\n");
-        printf("  Regular files:      %d\n", stats.regular_files);
-        printf("  Directories:        %d\n", stats.directories);
-        printf("  Symlinks:           %d\n", stats.symlinks);
-        printf("  Directory symlinks: %d\n", stats.dir_symlinks);
+    if (backend_lstat(path, &dir_st) != 0) {
+        perror(path);
+        return 1;
+    }
+    if (snapshot_reuse(rc->prev, path, &dir_st, list)) {
+        progress_enter(path);
+        if (rc->opts->refresh_stats) {
+            stat_listing(path, list);
+        } else {
+            timefmt_batch(path, list->entries, NULL, list->count);
+            if (xattr_enabled()) xattr_batch(path, list->entries, NULL, list->count);
+            progress_add((uint64_t)list->count, 0);
+            progress_dir_done();
+        }
+        dircount_listing(path, list);
+        sort_listing(list);
+        atomic_fetch_add_explicit(&rc->reused, 1, memory_order_relaxed);
+    } else {
+        if (scan_directory(path, rc->opts, list) != 0) return 1;
+        atomic_fetch_add_explicit(&rc->rescanned, 1, memory_order_relaxed);
+    }
+
+    SnapRecord *rec = xmalloc(sizeof(SnapRecord));
+    rec->data = snapshot_encode_dir(path, &dir_st, list, &rec->len);
+    walk_node_set_data(node, rec, sizeof(SnapRecord) + rec->len);
+    return 0;
+}
+
+// Worker-side visit: render one directory and queue its subdirectories.
+// Real directories only (lstat data), so symlinked directories are listed
+// but never descended into.
+static int visit_recursive(WalkNode *node, FILE *out, void *ctx) {
+    RecurseCtx *rc = ctx;
+    const char *path = walk_node_path(node);
+    DirListing list;
+    uint64_t start = timing_now();
+
+    if (text_output()) {
+        if (walk_node_depth(node) > 0) fputc('\n', out);
+        fprintf(out, "%s:\n", path);
     }
+    if (load_listing(rc, node, &list) != 0) return 1;
+
+    // Subdirectories are queued before --where drops any from the listing.
+    int max_depth = rc->opts->max_depth;
+    bool descend = max_depth == 0 || walk_node_depth(node) + 1 < max_depth;
+    for (int i = 0; i < list.count && descend; i++) {
+        if (S_ISDIR(list.entries[i].st.st_mode)) {
+            char child[PATH_MAX];
+            join_path(child, sizeof(child), path, list.entries[i].name);
+            walk_add_child(node, child);
+        }
+    }
+    where_apply(&list);
+    render_listing(out, path, &list, false);
+    timing_record(path, list.enum_ns, list.stat_ns, timing_now() - start, list.count);
+    free_listing(&list);
     return 0;
 }
 
+// Snapshot records are written here, in listing order, on the main thread.
+static void emit_recursive(WalkNode *node, const char *buf, size_t len, void *ctx) {
+    RecurseCtx *rc = ctx;
+    SnapRecord *rec = walk_node_data(node);
+
+    if (ring_active()) ring_put(buf, len);
+    else fwrite(buf, 1, len, stdout);
+    if (rec) {
+        snapshot_writer_add(rc->next, rec->data, rec->len);
+        free(rec->data);
+        free(rec);
+    }
+}
+
+int list_recursive(const char *path, const Options *opts) {
+    recurse_ctx.opts = opts;
+    snapshot_writer_begin_root(recurse_ctx.next);
+    WalkConfig cfg = {
+        .visit = visit_recursive,
+        .emit = recurse_ctx.next || ring_active() ? emit_recursive : NULL,
+        .ctx = &recurse_ctx,
+        .jobs = opts->jobs,
+        .mem_limit = opts->buffer_mem,
+    };
+    return walk_tree(path, &cfg);
+}
+
+// Open the previous snapshot and start the next one for --incremental.
+static int incremental_begin(const Options *opts) {
+    recurse_ctx.prev = snapshot_open(opts->incremental, opts);
+    recurse_ctx.next = snapshot_writer_open(opts->incremental, opts);
+    return recurse_ctx.next ? 0 : 1;
+}
+
+static int incremental_end(void) {
+    int result = snapshot_writer_close(recurse_ctx.next);
+    snapshot_close(recurse_ctx.prev);
+    fprintf(stderr, "Incremental: %ld directories reused, %ld rescanned\n",
+            atomic_load(&recurse_ctx.reused), atomic_load(&recurse_ctx.rescanned));
+    recurse_ctx.prev = NULL;
+    recurse_ctx.next = NULL;
+    return result;
+}
+
 // ========================================
 // Main
 // ========================================
 
+// Options that cannot be used together.  Checked before anything is set up
+// or any operand is looked at.
+static int check_conflicts(const Options *opts) {
+    if (opts->tree && opts->incremental) {
+        fprintf(stderr, "Error: --tree cannot be combined with --incremental\n");
+        return 1;
+    }
+    if (opts->ring && (opts->tree || opts->merge)) {
+        fprintf(stderr, "Error: --ring carries plain and -R listings only\n");
+        return 1;
+    }
+    if (opts->renderer && (opts->tree || opts->merge || opts->ring)) {
+        fprintf(stderr, "Error: --renderer formats plain and -R listings only\n");
+        return 1;
+    }
+    if (opts->merge && (opts->recursive || opts->tree)) {
+        fprintf(stderr, "Error: --merge cannot be combined with -R or --tree\n");
+        return 1;
+    }
+    return 0;
+}
+
 int main(int argc, char *argv[]) {
     int result = 0;
+    OperandSet operands = {0};
 
     setlocale(LC_ALL, "");
     init_caches();
 
     Options *opts = parse_loptions(argc, argv);
     // (Help/version handled internally by long_opt)
+    sort_options_ptr = opts;
+    numa_init(opts);
+    xattr_init(opts);
+    dircount_init(opts);
+    if (timefmt_init(opts) != 0 || display_init(opts) != 0 || where_init(opts) != 0) {
+        free_options(opts);
+        return 1;
+    }
+    timing_init(opts->slowest);
+    // Optional and best effort: without it names are cached per process.
+    const char *id_cache = opts->id_cache ? opts->id_cache : getenv("GLS_ID_CACHE");
+    if (id_cache && *id_cache) idcache_open(id_cache);
+    if (opts->progress) progress_start();
+    if (check_conflicts(opts) != 0 || renderer_load(opts) != 0 || compress_start(opts) != 0 ||
+        ring_open(opts) != 0) {
+        result = 1;
+        goto cleanup;
+    }
 
-    char **file_paths = xcalloc(opts->operand_count, sizeof(char *));
-    char **dir_paths  = xcalloc(opts->operand_count, sizeof(char *));
-    int file_count = 0, dir_count = 0;
-
-    for (int i = 0; i < opts->operand_count; i++) {
-        struct stat st;
-        if (lstat(opts->operands[i], &st) == 0) {
-            if (S_ISDIR(st.st_mode))
-                dir_paths[dir_count++] = opts->operands[i];
-            else
-                file_paths[file_count++] = opts->operands[i];
-        } else {
-            perror(opts->operands[i]);
+    // Queries name recorded paths, which need not exist any more.
+    if (opts->query) {
+        result = snapshot_query(opts->query, opts->operands, opts->operand_count);
+        goto cleanup;
+    }
+
+    if (backend_init(opts) != 0) {
+        result = 1;
+        goto cleanup;
+    }
+    // These modes read file contents or the live tree directly.
+    if (!backend_is_fs() && (opts->duplicates || opts->collisions || opts->compare ||
+                             opts->check_names || opts->incremental)) {
+        fprintf(stderr, "Error: --source only supports plain listings\n");
+        result = 1;
+        goto cleanup;
+    }
+    if (opts->capture && capture_start(opts) != 0) {
+        result = 1;
+        goto cleanup;
+    }
+
+    // Each operand is lstat'ed once here; files keep that stat for display.
+    if (operands_collect(opts, &operands) != 0) result = 1;
+    FileEntry *files = operands.files;
+    char **dir_paths = operands.dirs;
+    int file_count = operands.file_count, dir_count = operands.dir_count;
+
+    if (opts->duplicates) {
+        // Duplicate search replaces the listing and covers every operand.
+        if (find_duplicates(operands.paths, operands.path_count, opts) != 0) result = 1;
+        file_count = dir_count = 0;
+    } else if (opts->collisions) {
+        if (find_collisions(dir_paths, dir_count, opts) != 0) result = 1;
+        file_count = dir_count = 0;
+    } else if (opts->compare) {
+        if (dir_count != 2 || file_count != 0) {
+            fprintf(stderr, "Error: --compare needs exactly two directories\n");
             result = 1;
+        } else if (compare_trees(dir_paths[0], dir_paths[1], opts) != 0) {
+            result = 1;
+        }
+        file_count = dir_count = 0;
+    } else if (opts->check_names) {
+        NameSet *names = dir_count > 0 ? check_names_load(opts->check_names) : NULL;
+        if (dir_count > 0 && !names) result = 1;
+        for (int i = 0; i < dir_count && names; i++) {
+            if (i > 0) printf("\n");
+            if (dir_count > 1) printf("%s:\n", dir_paths[i]);
+            if (check_names(names, dir_paths[i], opts) != 0) result = 1;
         }
+        check_names_free(names);
+        for (int i = 0; i < file_count; i++) {
+            fprintf(stderr, "%s: Not a directory\n", files[i].name);
+            result = 1;
+        }
+        file_count = dir_count = 0;
+    }
+
+    if (opts->incremental && dir_count > 0 && incremental_begin(opts) != 0) {
+        result = 1;
+        dir_count = 0;
     }
 
+    int matched = 0;
+    for (int i = 0; i < file_count; i++)
+        if (where_match(&files[i])) files[matched++] = files[i];
+    file_count = matched;
+
     // Print files first
     for (int i = 0; i < file_count; i++) {
-        struct stat lst;
-        if (lstat(file_paths[i], &lst) == 0) {
-            FileStats dummy = {0};
-            print_file_entry("", file_paths[i], &lst, &dummy);
-        }
+        FileStats dummy = {0};
+        load_entry_details(&files[i], files[i].name);
+        if (text_output()) print_file_entry(stdout, "", &files[i], &dummy);
     }
+    if (ring_active() && file_count > 0) ring_put_listing("", files, file_count);
+    if (renderer_active() && file_count > 0) renderer_listing(stdout, "", files, file_count);
 
     // Then directories
+    if (opts->merge && dir_count > 0) {
+        if (file_count > 0) printf("\n");
+        if (list_merged(dir_paths, dir_count, opts) != 0) result = 1;
+        dir_count = 0;
+    }
     bool show_headers = (dir_count > 1 || file_count > 0);
     for (int i = 0; i < dir_count; i++) {
-        if (file_count > 0 || i > 0) printf("\n");
-        int ret = list_directory(dir_paths[i], opts, show_headers);
+        if ((file_count > 0 || i > 0) && text_output()) printf("\n");
+        int ret = opts->tree      ? list_tree(dir_paths[i], opts)
+                : opts->recursive ? list_recursive(dir_paths[i], opts)
+                                  : list_directory(dir_paths[i], opts, show_headers);
         if (ret != 0) result = ret;
     }
 
-    free(file_paths);
-    free(dir_paths);
+    if (recurse_ctx.next && incremental_end() != 0) result = 1;
+
+cleanup:
+    // Each step below does nothing if it was never started.
+    if (opts->progress) progress_stop();
+    timing_report(stderr);
+    if (capture_finish() != 0) result = 1;
+    renderer_finish();
+    if (compress_finish() != 0) result = 1;
+    ring_close();
+    backend_shutdown();
+    idcache_close();
+    numa_shutdown();
+
+    operands_free(&operands);
     free_options(opts);
     return result;
 }
@@ -10,14 +10,27 @@
  */
 
 #include <stdbool.h>
+#include <stdio.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <time.h>
 #include <limits.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "long_opt.h"   // <-- Options now comes from here
 
+// Timestamps with nanoseconds; the struct stat field names differ on macOS.
+#ifdef __APPLE__
+#define ST_ATIM(st) ((st)->st_atimespec)
+#define ST_MTIM(st) ((st)->st_mtimespec)
+#define ST_CTIM(st) ((st)->st_ctimespec)
+#else
+#define ST_ATIM(st) ((st)->st_atim)
+#define ST_MTIM(st) ((st)->st_mtim)
+#define ST_CTIM(st) ((st)->st_ctim)
+#endif
+
 // ========================================
 // Shared Structures (except Options)
 // ========================================
@@ -32,17 +45,40 @@ typedef struct {
 
 typedef struct {
     char *name;
-    time_t mtime;
+    struct timespec time;   // the --time field, for -t and display
     struct stat st;
+    unsigned char d_type;   // from readdir(); DT_UNKNOWN (0) if not reported
+    char xattr;             // --xattrs indicator, filled with the stat batch
+    long long child_count;  // --dir-counts: -1 not a directory, -2 unreadable
 } FileEntry;
 
+// The entries of one directory, as collected by scan_directory().
+typedef struct {
+    FileEntry *entries;
+    int count;
+    int capacity;
+    long total_blocks;
+    uint64_t enum_ns;       // time spent in readdir()
+    uint64_t stat_ns;       // time spent in lstat()
+} DirListing;
+
 // ========================================
 // Shared Prototypes
 // ========================================
 
 int get_link_target(const char *path, char *target, size_t len);
-void print_file_entry(const char *path, const char *filename, const struct stat *st, FileStats *stats);
+void print_file_entry(FILE *out, const char *path, const FileEntry *fe, FileStats *stats);
+void load_entry_details(FileEntry *fe, const char *fullpath);
+int enumerate_directory(const char *path, const Options *opts, DirListing *list);
+int scan_directory(const char *path, const Options *opts, DirListing *list);
+int scan_directory_unsorted(const char *path, const Options *opts, DirListing *list);
+int stat_listing(const char *path, DirListing *list);
+void sort_listing(DirListing *list);
+int compare_entries(const void *a, const void *b);     // the listing order, for qsort()
+void free_listing(DirListing *list);
 int list_directory(const char *path, const Options *opts, bool show_header);
+int list_recursive(const char *path, const Options *opts);
+void join_path(char *dest, size_t len, const char *dir, const char *name);
 
 void init_caches(void);
 void get_username(uid_t uid, char *username, size_t len);
@@ -0,0 +1,71 @@
+#ifndef GLSRENDER_H
+#define GLSRENDER_H
+
+/*
+ * glsrender.h - Renderer plugin interface for --renderer
+ * -------------------------------------------------------
+ * A renderer is a shared object that formats listings in place of the long
+ * format.  It exports
+ *
+ *     const GlsRenderer *gls_renderer(uint32_t abi);
+ *
+ * which returns its callbacks, or NULL if it cannot serve `abi`.  gls only
+ * calls plugins built for the GLS_RENDER_ABI it was built with; any layout
+ * change bumps it.  This header is all a plugin needs (see jsonrender.c).
+ *
+ * Each listing arrives as begin_dir(), one or more entries() calls with up
+ * to GLS_RENDER_BATCH entries each, and end_dir(), all on one thread and
+ * all writing to the same `out`.  With -R several directories are rendered
+ * at once on worker threads, each into its own buffer that gls prints in
+ * order, so the callbacks must not keep per-listing state in `ctx`.  init()
+ * runs before the first listing and finish() after the last, on the main
+ * thread; finish() may write to `out` (stdout) too.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define GLS_RENDER_ABI      1
+#define GLS_RENDER_BATCH    256
+
+// One entry, with only what a listing shows.  Valid during the call only.
+typedef struct {
+    const char *name;               // leaf name; the path as given for file operands
+    uint32_t name_len;
+    uint32_t mode;                  // st_mode: type and permissions
+    uint32_t nlink;
+    uint32_t uid;
+    uint32_t gid;
+    uint8_t d_type;                 // DT_* from readdir(), 0 if unknown
+    int8_t xattr;                   // --xattrs indicator ('@', '+'), 0 when off
+    uint16_t reserved;
+    uint64_t ino;
+    uint64_t dev;
+    int64_t size;
+    int64_t blocks;                 // 512-byte units
+    int64_t time_sec;               // the --time field
+    int32_t time_nsec;              // -1 when unknown (birth time)
+    int32_t reserved2;
+    int64_t child_count;            // --dir-counts, -1 when off/not a directory
+} GlsEntry;
+
+typedef struct {
+    uint32_t abi;                   // GLS_RENDER_ABI
+    const char *name;
+
+    // Set up `*ctx` (shared, read-only afterwards); non-zero aborts the run.
+    // May be NULL.
+    int (*init)(void **ctx);
+    // `path` is the directory ("" for the file operands), `count` the
+    // number of entries to come and `total_blocks` their 512-byte blocks.
+    void (*begin_dir)(void *ctx, FILE *out, const char *path, int count, int64_t total_blocks);
+    void (*entries)(void *ctx, FILE *out, const char *path, const GlsEntry *entries, int count);
+    void (*end_dir)(void *ctx, FILE *out, const char *path);
+    // Last output, then release `ctx`.  May be NULL.
+    void (*finish)(void *ctx, FILE *out);
+} GlsRenderer;
+
+typedef const GlsRenderer *(*GlsRendererEntry)(uint32_t abi);
+#define GLS_RENDERER_SYMBOL "gls_renderer"
+
+#endif
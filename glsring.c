@@ -0,0 +1,244 @@
+/*
+ * glsring.c - Reference consumer for gls --ring
+ * ---------------------------------------------
+ * Reads the binary entry records gls writes into a shared-memory ring
+ * (format in ringproto.h) and prints them as tab-separated text, or just
+ * counts them with -c.  Records are read in place in the mapping: nothing is
+ * copied out of the ring before use.
+ *
+ *   glsring [-c] [-s SIZE] -- gls [ARGS...]
+ *       Create an anonymous memory file, run gls with it as fd 3 and
+ *       --ring=fd:3, and consume while it runs.  Nothing is left behind.
+ *   glsring [-c] shm:/NAME
+ *       Attach to the ring of a gls started with --ring=shm:/NAME, and
+ *       remove the name when done.
+ *
+ * Output lines: directory/name, type/mode (octal), size, time (seconds).
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "ringproto.h"
+
+#define DEFAULT_SIZE    (16UL * 1024 * 1024)
+#define RING_FD         3
+
+static bool count_only = false;
+static pid_t child = -1;
+static int child_status = 0;
+
+// True while the producer may still appear or write (always for shm).
+static bool producer_alive(void) {
+    if (child < 0) return true;
+    if (waitpid(child, &child_status, WNOHANG) == child) {
+        child = -1;
+        return false;
+    }
+    return true;
+}
+
+static void backoff(unsigned *round) {
+    if (*round < 64) {
+        sched_yield();
+    } else {
+        long ns = 1000L << (*round - 64 < 10 ? *round - 64 : 10);
+        struct timespec ts = { 0, ns };
+        nanosleep(&ts, NULL);
+    }
+    (*round)++;
+}
+
+// ========================================
+// Setting Up the Segment
+// ========================================
+
+static int make_memory_file(size_t size) {
+#ifdef __linux__
+    int fd = memfd_create("gls-ring", 0);
+#else
+    char name[64];
+    snprintf(name, sizeof(name), "/glsring.%ld", (long)getpid());
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0) shm_unlink(name);
+#endif
+    if (fd < 0 || ftruncate(fd, (off_t)size) != 0) {
+        perror("glsring: memory file");
+        exit(EXIT_FAILURE);
+    }
+    return fd;
+}
+
+static void spawn_gls(int fd, char **argv, int argc) {
+    char **args = calloc((size_t)argc + 2, sizeof(char *));
+    char opt[32];
+    snprintf(opt, sizeof(opt), "--ring=fd:%d", RING_FD);
+    args[0] = argv[0];
+    args[1] = opt;
+    for (int i = 1; i < argc; i++) args[i + 1] = argv[i];
+
+    child = fork();
+    if (child < 0) {
+        perror("glsring: fork");
+        exit(EXIT_FAILURE);
+    }
+    if (child == 0) {
+        if (fd != RING_FD) {
+            dup2(fd, RING_FD);
+            close(fd);
+        }
+        execvp(args[0], args);
+        perror(args[0]);
+        _exit(127);
+    }
+    free(args);
+}
+
+// Map the segment once gls has initialised its header.
+static RingHeader *attach(int fd) {
+    unsigned round = 0;
+    struct stat st;
+    for (;;) {
+        if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(RingHeader)) {
+            RingHeader *h = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                 fd, 0);
+            if (h == MAP_FAILED) {
+                perror("glsring: mmap");
+                exit(EXIT_FAILURE);
+            }
+            if (atomic_load_explicit(&h->magic, memory_order_acquire) == RING_MAGIC &&
+                h->header_size + h->capacity <= (uint64_t)st.st_size)
+                return h;
+            munmap(h, (size_t)st.st_size);
+        }
+        if (!producer_alive()) return NULL;
+        backoff(&round);
+    }
+}
+
+// ========================================
+// Consuming
+// ========================================
+
+static void consume(RingHeader *h) {
+    const unsigned char *data = (const unsigned char *)h + h->header_size;
+    uint64_t capacity = h->capacity;
+    uint64_t tail = atomic_load_explicit(&h->tail, memory_order_relaxed);
+    unsigned long long entries = 0, dirs = 0, bytes = 0;
+    char dir[PATH_MAX] = "";        // outlives its record, so copied
+    unsigned round = 0;
+
+    for (;;) {
+        uint64_t head = atomic_load_explicit(&h->head, memory_order_acquire);
+        if (tail == head) {
+            if (atomic_load_explicit(&h->closed, memory_order_acquire) &&
+                atomic_load_explicit(&h->head, memory_order_acquire) == tail)
+                break;
+            if (!producer_alive() &&
+                atomic_load_explicit(&h->head, memory_order_acquire) == tail) {
+                fprintf(stderr, "glsring: gls exited without closing the ring\n");
+                break;
+            }
+            backoff(&round);
+            continue;
+        }
+        round = 0;
+
+        while (tail != head) {
+            const RingRecord *rec = (const RingRecord *)(data + tail % capacity);
+            if (rec->type == RING_DIR) {
+                snprintf(dir, sizeof(dir), "%s", (const char *)(rec + 1));
+                dirs++;
+            } else if (rec->type == RING_ENTRY) {
+                const RingEntry *e = (const RingEntry *)rec;
+                const char *name = (const char *)(e + 1);
+                entries++;
+                bytes += (unsigned long long)e->size;
+                if (!count_only)
+                    printf("%s%s%s\t%o\t%lld\t%lld\n", dir, *dir ? "/" : "", name,
+                           (unsigned)e->mode, (long long)e->size, (long long)e->time_sec);
+            }
+            tail += rec->length;
+        }
+        // The names just printed live in the ring; release them only now.
+        atomic_store_explicit(&h->tail, tail, memory_order_release);
+    }
+    if (count_only) printf("%llu entries in %llu listings, %llu bytes\n", entries, dirs, bytes);
+}
+
+int main(int argc, char *argv[]) {
+    size_t size = DEFAULT_SIZE;
+    int argi = 1;
+
+    for (; argi < argc && argv[argi][0] == '-'; argi++) {
+        if (strcmp(argv[argi], "-c") == 0) {
+            count_only = true;
+        } else if (strcmp(argv[argi], "-s") == 0 && argi + 1 < argc) {
+            size = strtoull(argv[++argi], NULL, 10);
+        } else if (strcmp(argv[argi], "--") == 0) {
+            break;
+        } else {
+            argi = argc;
+        }
+    }
+    if (argi >= argc) {
+        fprintf(stderr, "usage: %s [-c] [-s BYTES] -- gls [ARGS...]\n"
+                        "       %s [-c] shm:/NAME\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    int fd;
+    const char *shm_name = NULL;
+    if (strcmp(argv[argi], "--") == 0) {
+        if (argi + 1 >= argc) {
+            fprintf(stderr, "glsring: no command after --\n");
+            return 2;
+        }
+        fd = make_memory_file(size);
+        spawn_gls(fd, argv + argi + 1, argc - argi - 1);
+    } else if (strncmp(argv[argi], "shm:", 4) == 0) {
+        shm_name = argv[argi] + 4;
+        unsigned round = 0;
+        while ((fd = shm_open(shm_name, O_RDWR, 0)) < 0) {
+            if (errno != ENOENT) {
+                perror(argv[argi]);
+                return 1;
+            }
+            backoff(&round);
+        }
+    } else {
+        fprintf(stderr, "glsring: expected -- or shm:/NAME, got '%s'\n", argv[argi]);
+        return 2;
+    }
+
+    RingHeader *h = attach(fd);
+    if (!h) {
+        fprintf(stderr, "glsring: gls exited before setting up the ring\n");
+    } else {
+        atomic_store_explicit(&h->consumer_pid, (int32_t)getpid(), memory_order_relaxed);
+        atomic_store_explicit(&h->consumer, RING_ATTACHED, memory_order_release);
+        consume(h);
+        atomic_store_explicit(&h->consumer, RING_DETACHED, memory_order_release);
+    }
+    if (shm_name) shm_unlink(shm_name);
+    close(fd);
+
+    while (child > 0 && waitpid(child, &child_status, 0) < 0 && errno == EINTR) {
+    }
+    if (!h) return 1;
+    return WIFEXITED(child_status) ? WEXITSTATUS(child_status) : 1;
+}
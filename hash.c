@@ -0,0 +1,111 @@
+/*
+ * hash.c - Streaming 128-bit content hash
+ * ---------------------------------------
+ * MurmurHash3_x64_128 by Austin Appleby (public domain), reshaped to accept
+ * input in pieces: whole 16-byte blocks are mixed immediately and any
+ * remainder waits in `tail` for the next update or the final call.
+ */
+
+#include <string.h>
+#include "hash.h"
+
+#define C1 0x87c37b91114253d5ULL
+#define C2 0x4cf5ad432745937fULL
+
+static inline uint64_t rotl64(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+static inline uint64_t load64(const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void mix_block(Hash128 *h, const uint8_t *block) {
+    uint64_t k1 = load64(block);
+    uint64_t k2 = load64(block + 8);
+
+    k1 *= C1; k1 = rotl64(k1, 31); k1 *= C2; h->h1 ^= k1;
+    h->h1 = rotl64(h->h1, 27); h->h1 += h->h2; h->h1 = h->h1 * 5 + 0x52dce729;
+    k2 *= C2; k2 = rotl64(k2, 33); k2 *= C1; h->h2 ^= k2;
+    h->h2 = rotl64(h->h2, 31); h->h2 += h->h1; h->h2 = h->h2 * 5 + 0x38495ab5;
+}
+
+void hash128_init(Hash128 *h, uint64_t seed) {
+    h->h1 = seed;
+    h->h2 = seed;
+    h->tail_len = 0;
+    h->total = 0;
+}
+
+void hash128_update(Hash128 *h, const void *data, size_t len) {
+    const uint8_t *p = data;
+    h->total += len;
+
+    if (h->tail_len > 0) {
+        size_t take = 16 - h->tail_len;
+        if (take > len) take = len;
+        memcpy(h->tail + h->tail_len, p, take);
+        h->tail_len += take;
+        p += take;
+        len -= take;
+        if (h->tail_len < 16) return;
+        mix_block(h, h->tail);
+        h->tail_len = 0;
+    }
+    for (; len >= 16; p += 16, len -= 16) mix_block(h, p);
+    if (len > 0) {
+        memcpy(h->tail, p, len);
+        h->tail_len = len;
+    }
+}
+
+HashValue hash128_final(Hash128 *h) {
+    uint64_t k1 = 0, k2 = 0;
+    const uint8_t *tail = h->tail;
+
+    switch (h->tail_len) {
+        case 15: k2 ^= (uint64_t)tail[14] << 48; // fall through
+        case 14: k2 ^= (uint64_t)tail[13] << 40; // fall through
+        case 13: k2 ^= (uint64_t)tail[12] << 32; // fall through
+        case 12: k2 ^= (uint64_t)tail[11] << 24; // fall through
+        case 11: k2 ^= (uint64_t)tail[10] << 16; // fall through
+        case 10: k2 ^= (uint64_t)tail[9] << 8;   // fall through
+        case 9:  k2 ^= (uint64_t)tail[8];
+                 k2 *= C2; k2 = rotl64(k2, 33); k2 *= C1; h->h2 ^= k2;
+                 // fall through
+        case 8:  k1 ^= (uint64_t)tail[7] << 56;  // fall through
+        case 7:  k1 ^= (uint64_t)tail[6] << 48;  // fall through
+        case 6:  k1 ^= (uint64_t)tail[5] << 40;  // fall through
+        case 5:  k1 ^= (uint64_t)tail[4] << 32;  // fall through
+        case 4:  k1 ^= (uint64_t)tail[3] << 24;  // fall through
+        case 3:  k1 ^= (uint64_t)tail[2] << 16;  // fall through
+        case 2:  k1 ^= (uint64_t)tail[1] << 8;   // fall through
+        case 1:  k1 ^= (uint64_t)tail[0];
+                 k1 *= C1; k1 = rotl64(k1, 31); k1 *= C2; h->h1 ^= k1;
+                 break;
+        default: break;
+    }
+
+    h->h1 ^= h->total;
+    h->h2 ^= h->total;
+    h->h1 += h->h2;
+    h->h2 += h->h1;
+    h->h1 = fmix64(h->h1);
+    h->h2 = fmix64(h->h2);
+    h->h1 += h->h2;
+    h->h2 += h->h1;
+
+    HashValue v = { h->h1, h->h2 };
+    return v;
+}
@@ -0,0 +1,30 @@
+#ifndef HASH_H
+#define HASH_H
+
+/*
+ * hash.h - Streaming 128-bit content hash
+ * ---------------------------------------
+ * MurmurHash3 (x64, 128-bit variant) fed incrementally, so file contents can
+ * be hashed in fixed-size reads.  Not cryptographic: it is used to tell
+ * different files apart, never to defend against crafted collisions.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint64_t h1, h2;
+    uint8_t tail[16];
+    size_t tail_len;
+    uint64_t total;
+} Hash128;
+
+typedef struct {
+    uint64_t lo, hi;
+} HashValue;
+
+void hash128_init(Hash128 *h, uint64_t seed);
+void hash128_update(Hash128 *h, const void *data, size_t len);
+HashValue hash128_final(Hash128 *h);
+
+#endif
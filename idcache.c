@@ -0,0 +1,203 @@
+/*
+ * idcache.c - Host-wide uid/gid name cache for --id-cache
+ * -------------------------------------------------------
+ * The file is a header followed by an open-addressing table of fixed slots.
+ * A slot is claimed by compare-and-swapping its key from 0, and its payload
+ * is guarded by a per-slot sequence counter (a seqlock): a writer makes the
+ * counter odd, writes, then makes it even again; a reader copies the payload
+ * and only trusts the copy if the counter was even and unchanged around it.
+ * Nobody ever waits: a reader that races a writer treats it as a miss, and a
+ * writer that finds another writer active leaves the slot to it.
+ *
+ * Slots are never freed.  An entry older than ID_CACHE_TTL is re-resolved
+ * and rewritten in place, which also picks up renamed users.  A process that
+ * dies mid-write leaves its slot odd for good; that id then always misses.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "gls.h"
+#include "display.h"
+#include "idcache.h"
+
+#define ID_CACHE_MAGIC   0x31434449534c47ULL     // "GLSIDC1"
+#define ID_CACHE_SLOTS   4096
+#define ID_CACHE_PROBES  16
+#define ID_NAME_MAX      72
+
+typedef struct {
+    uint64_t magic;
+    uint32_t slot_count;
+    uint32_t slot_size;
+} IdHeader;
+
+typedef struct {
+    _Atomic uint64_t key;       // (kind << 32 | id) + 1; 0 = free
+    _Atomic uint32_t seq;       // odd while the payload is being written
+    uint32_t name_len;
+    int64_t stamp;              // when the name was resolved
+    char name[ID_NAME_MAX];
+} IdSlot;
+
+static IdSlot *slots = NULL;
+static void *map = NULL;
+static size_t map_size = 0;
+static bool writable = false;
+
+static uint64_t slot_key(int kind, unsigned id) {
+    return (((uint64_t)kind << 32) | id) + 1;
+}
+
+// splitmix64 finaliser: uids are dense, so spread them over the table.
+static size_t slot_hash(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return (size_t)(key & (ID_CACHE_SLOTS - 1));
+}
+
+// ========================================
+// Mapping
+// ========================================
+
+// Size and stamp a new, empty file.  The lock only orders creators against
+// each other; the magic is written last, so a half-made file never passes.
+static bool init_file(int fd) {
+    struct stat st;
+    bool ok = false;
+
+    if (flock(fd, LOCK_EX) != 0) return false;
+    if (fstat(fd, &st) == 0) {
+        if (st.st_size == (off_t)map_size) {
+            ok = true;
+        } else if (st.st_size == 0 && ftruncate(fd, (off_t)map_size) == 0) {
+            IdHeader hdr = { ID_CACHE_MAGIC, ID_CACHE_SLOTS, sizeof(IdSlot) };
+            ok = pwrite(fd, &hdr, sizeof(hdr), 0) == (ssize_t)sizeof(hdr);
+        }
+    }
+    flock(fd, LOCK_UN);
+    return ok;
+}
+
+bool idcache_open(const char *file) {
+    map_size = sizeof(IdHeader) + (size_t)ID_CACHE_SLOTS * sizeof(IdSlot);
+
+    int fd = open(file, O_RDWR | O_CREAT | O_NOFOLLOW, 0644);
+    writable = fd >= 0;
+    // A cache owned by root can still be read by everyone else.
+    if (fd < 0) fd = open(file, O_RDONLY | O_NOFOLLOW);
+    if (fd < 0) return false;
+
+    // Whoever can write the file can put any name in any slot, or truncate
+    // it under our mapping (SIGBUS), so only we or root may own it.
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+        (st.st_uid != geteuid() && st.st_uid != 0) || (st.st_mode & (S_IWGRP | S_IWOTH))) {
+        close(fd);
+        return false;
+    }
+    bool ok = writable ? init_file(fd) : st.st_size == (off_t)map_size;
+    if (ok) {
+        map = mmap(NULL, map_size, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                   MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED) map = NULL;
+    }
+    close(fd);
+
+    const IdHeader *hdr = map;
+    if (!hdr || hdr->magic != ID_CACHE_MAGIC || hdr->slot_count != ID_CACHE_SLOTS ||
+        hdr->slot_size != sizeof(IdSlot)) {
+        idcache_close();
+        return false;
+    }
+    slots = (IdSlot *)((char *)map + sizeof(IdHeader));
+    return true;
+}
+
+void idcache_close(void) {
+    if (map) munmap(map, map_size);
+    map = NULL;
+    slots = NULL;
+}
+
+// ========================================
+// Lookup and Insert
+// ========================================
+
+bool idcache_lookup(int kind, unsigned id, char *buf, size_t len) {
+    if (!slots) return false;
+
+    uint64_t key = slot_key(kind, id);
+    size_t i = slot_hash(key);
+    for (int probe = 0; probe < ID_CACHE_PROBES; probe++, i = (i + 1) & (ID_CACHE_SLOTS - 1)) {
+        IdSlot *s = &slots[i];
+        uint64_t k = atomic_load_explicit(&s->key, memory_order_acquire);
+        if (k == 0) return false;
+        if (k != key) continue;
+
+        uint32_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+        if (seq & 1) return false;
+        char name[ID_NAME_MAX];
+        uint32_t name_len = s->name_len;
+        int64_t stamp = s->stamp;
+        memcpy(name, s->name, sizeof(name));
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&s->seq, memory_order_relaxed) != seq) return false;
+
+        // seq 0 means claimed but never written.
+        if (seq == 0 || name_len == 0 || name_len >= ID_NAME_MAX) return false;
+        if (time(NULL) - stamp > ID_CACHE_TTL) return false;
+        name[name_len] = '\0';
+        // The file is shared: never print what another process put there
+        // without cleaning it first.
+        sanitize_string(buf, name, len);
+        return true;
+    }
+    return false;
+}
+
+void idcache_store(int kind, unsigned id, const char *name) {
+    size_t name_len = strlen(name);
+    if (!slots || !writable || name_len == 0 || name_len >= ID_NAME_MAX) return;
+
+    uint64_t key = slot_key(kind, id);
+    size_t i = slot_hash(key);
+    for (int probe = 0; probe < ID_CACHE_PROBES; probe++, i = (i + 1) & (ID_CACHE_SLOTS - 1)) {
+        IdSlot *s = &slots[i];
+        uint64_t k = atomic_load_explicit(&s->key, memory_order_acquire);
+        if (k == 0) {
+            uint64_t expected = 0;
+            if (!atomic_compare_exchange_strong_explicit(&s->key, &expected, key,
+                                                         memory_order_acq_rel,
+                                                         memory_order_acquire))
+                k = expected;
+            else
+                k = key;
+        }
+        if (k != key) continue;
+
+        uint32_t seq = atomic_load_explicit(&s->seq, memory_order_relaxed);
+        if ((seq & 1) ||
+            !atomic_compare_exchange_strong_explicit(&s->seq, &seq, seq + 1,
+                                                     memory_order_acquire,
+                                                     memory_order_relaxed))
+            return;             // another process is writing this slot
+        atomic_thread_fence(memory_order_release);
+        memset(s->name, 0, sizeof(s->name));
+        memcpy(s->name, name, name_len);
+        s->name_len = (uint32_t)name_len;
+        s->stamp = time(NULL);
+        atomic_store_explicit(&s->seq, seq + 2, memory_order_release);
+        return;
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef IDCACHE_H
+#define IDCACHE_H
+
+/*
+ * idcache.h - Host-wide uid/gid name cache for --id-cache
+ * -------------------------------------------------------
+ * A fixed-size table in a file that every gls process on the host maps, so
+ * a user or group name is resolved through NSS once per host per TTL rather
+ * than once per process.  Lookups and inserts are lock-free.  Anything wrong
+ * with the file (missing, a symlink, damaged, or writable by anyone but us
+ * or root) simply disables it and gls falls back to its per-process cache.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#define ID_CACHE_TTL 600        // seconds a shared name stays valid
+
+enum { ID_USER = 0, ID_GROUP = 1 };
+
+// Map `file` (creating it if needed).  Returns false if the cache is off.
+bool idcache_open(const char *file);
+void idcache_close(void);
+
+// Copy a fresh cached name for (kind, id) into `buf`; false on a miss.
+bool idcache_lookup(int kind, unsigned id, char *buf, size_t len);
+// Publish a resolved name for other processes.
+void idcache_store(int kind, unsigned id, const char *name);
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ * jsonrender.c - Example --renderer plugin: one JSON object per entry
+ * -------------------------------------------------------------------
+ * Build with -shared -fPIC (the makefile's jsonrender.so target), then
+ * `gls --renderer=./jsonrender.so -R DIR`.  Each batch is formatted into a
+ * local buffer and written with one fwrite(), so the cost per entry is the
+ * formatting alone.  Needs nothing from gls but glsrender.h.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "glsrender.h"
+
+#define LINE_MAX_BYTES  (6 * 4096 + 512)    // worst-case escaped path + fields
+
+typedef struct {
+    char *p;
+    char *end;
+} Buf;
+
+static void put_escaped(Buf *b, const char *s) {
+    static const char hex[] = "0123456789abcdef";
+    for (; *s && b->end - b->p > 6; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            *b->p++ = '\\';
+            *b->p++ = (char)c;
+        } else if (c < 0x20) {
+            memcpy(b->p, "\\u00", 4);
+            b->p[4] = hex[c >> 4];
+            b->p[5] = hex[c & 15];
+            b->p += 6;
+        } else {
+            *b->p++ = (char)c;
+        }
+    }
+}
+
+static const char *type_name(uint32_t mode) {
+    if (S_ISDIR(mode)) return "dir";
+    if (S_ISLNK(mode)) return "link";
+    if (S_ISREG(mode)) return "file";
+    if (S_ISFIFO(mode)) return "fifo";
+    if (S_ISSOCK(mode)) return "socket";
+    if (S_ISCHR(mode)) return "char";
+    if (S_ISBLK(mode)) return "block";
+    return "unknown";
+}
+
+static void begin_dir(void *ctx, FILE *out, const char *path, int count, int64_t total_blocks) {
+    (void)ctx, (void)out, (void)path, (void)count, (void)total_blocks;
+}
+
+static void entries(void *ctx, FILE *out, const char *path, const GlsEntry *e, int count) {
+    static _Thread_local char buf[GLS_RENDER_BATCH * 256];
+    Buf b = { buf, buf + sizeof(buf) };
+    (void)ctx;
+
+    for (int i = 0; i < count; i++) {
+        if (b.end - b.p < LINE_MAX_BYTES) {
+            fwrite(buf, 1, (size_t)(b.p - buf), out);
+            b.p = buf;
+        }
+        b.p += sprintf(b.p, "{\"path\":\"");
+        if (*path) {
+            put_escaped(&b, path);
+            *b.p++ = '/';
+        }
+        put_escaped(&b, e[i].name);
+        b.p += snprintf(b.p, (size_t)(b.end - b.p),
+                        "\",\"type\":\"%s\",\"mode\":%u,\"size\":%lld,\"mtime\":%lld",
+                        type_name(e[i].mode), (unsigned)(e[i].mode & 07777),
+                        (long long)e[i].size, (long long)e[i].time_sec);
+        if (e[i].child_count >= 0)
+            b.p += snprintf(b.p, (size_t)(b.end - b.p), ",\"children\":%lld",
+                            (long long)e[i].child_count);
+        *b.p++ = '}';
+        *b.p++ = '\n';
+    }
+    fwrite(buf, 1, (size_t)(b.p - buf), out);
+}
+
+static void end_dir(void *ctx, FILE *out, const char *path) {
+    (void)ctx, (void)out, (void)path;
+}
+
+static const GlsRenderer renderer = {
+    .abi = GLS_RENDER_ABI,
+    .name = "json",
+    .begin_dir = begin_dir,
+    .entries = entries,
+    .end_dir = end_dir,
+};
+
+const GlsRenderer *gls_renderer(uint32_t abi) {
+    return abi == GLS_RENDER_ABI ? &renderer : NULL;
+}
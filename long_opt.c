@@ -1,5 +1,8 @@
 #define _POSIX_C_SOURCE 200809L
 #include "long_opt.h"
+#include "resources.h"
+#include "timefmt.h"
+#include "dircount.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -7,6 +10,45 @@
 #include <getopt.h>
 #include <stdbool.h>
 #include <errno.h>
+#include <unistd.h>
+
+// ids for options that only have a long form
+enum {
+	OPT_BUFFER_MEM = 256,
+	OPT_SLOWEST,
+	OPT_PROGRESS,
+	OPT_DUPLICATES,
+	OPT_COLLISIONS,
+	OPT_CHECK_NAMES,
+	OPT_SHOW_FOUND,
+	OPT_COMPARE,
+	OPT_INCREMENTAL,
+	OPT_REFRESH_STATS,
+	OPT_QUERY,
+	OPT_SOURCE,
+	OPT_CAPTURE,
+	OPT_HASH_NAMES,
+	OPT_REPLAY_LATENCY,
+	OPT_ID_CACHE,
+	OPT_SHOW_LIMITS,
+	OPT_NO_NUMA,
+	OPT_HUGE_PAGES,
+	OPT_XATTRS,
+	OPT_TIME,
+	OPT_TIME_STYLE,
+	OPT_BLOCK_SIZE,
+	OPT_SI,
+	OPT_DIR_COUNTS,
+	OPT_SORT,
+	OPT_TREE,
+	OPT_MAX_DEPTH,
+	OPT_COMPRESS,
+	OPT_MERGE,
+	OPT_RING,
+	OPT_RING_SIZE,
+	OPT_RENDERER,
+	OPT_WHERE,
+};
 
 
 // ===============================
@@ -18,13 +60,50 @@ static struct option long_options[] = {
 	{"help",    no_argument, 0, 'h'},
 	{"version", no_argument, 0, 'v'},
 	{"all",     no_argument, 0, 'a'},
-	{"time",    no_argument, 0, 't'},
+	{"time",    optional_argument, 0, OPT_TIME},
+	{"recursive", no_argument, 0, 'R'},
+	{"jobs",    required_argument, 0, 'j'},
+	{"buffer-mem", required_argument, 0, OPT_BUFFER_MEM},
+	{"slowest", required_argument, 0, OPT_SLOWEST},
+	{"progress", no_argument, 0, OPT_PROGRESS},
+	{"duplicates", no_argument, 0, OPT_DUPLICATES},
+	{"collisions", no_argument, 0, OPT_COLLISIONS},
+	{"check-names", required_argument, 0, OPT_CHECK_NAMES},
+	{"show-found", no_argument, 0, OPT_SHOW_FOUND},
+	{"compare", no_argument, 0, OPT_COMPARE},
+	{"incremental", required_argument, 0, OPT_INCREMENTAL},
+	{"refresh-stats", no_argument, 0, OPT_REFRESH_STATS},
+	{"query", required_argument, 0, OPT_QUERY},
+	{"source", required_argument, 0, OPT_SOURCE},
+	{"capture", required_argument, 0, OPT_CAPTURE},
+	{"hash-names", no_argument, 0, OPT_HASH_NAMES},
+	{"replay-latency", no_argument, 0, OPT_REPLAY_LATENCY},
+	{"id-cache", required_argument, 0, OPT_ID_CACHE},
+	{"show-limits", no_argument, 0, OPT_SHOW_LIMITS},
+	{"no-numa", no_argument, 0, OPT_NO_NUMA},
+	{"huge-pages", no_argument, 0, OPT_HUGE_PAGES},
+	{"xattrs", no_argument, 0, OPT_XATTRS},
+	{"time-style", required_argument, 0, OPT_TIME_STYLE},
+	{"block-size", required_argument, 0, OPT_BLOCK_SIZE},
+	{"si", no_argument, 0, OPT_SI},
+	{"kibibytes", no_argument, 0, 'k'},
+	{"size", no_argument, 0, 's'},
+	{"dir-counts", optional_argument, 0, OPT_DIR_COUNTS},
+	{"sort", required_argument, 0, OPT_SORT},
+	{"tree", no_argument, 0, OPT_TREE},
+	{"max-depth", required_argument, 0, OPT_MAX_DEPTH},
+	{"compress", required_argument, 0, OPT_COMPRESS},
+	{"merge", no_argument, 0, OPT_MERGE},
+	{"ring", required_argument, 0, OPT_RING},
+	{"ring-size", required_argument, 0, OPT_RING_SIZE},
+	{"renderer", required_argument, 0, OPT_RENDERER},
+	{"where", required_argument, 0, OPT_WHERE},
 	{0, 0, 0, 0}
 };
 
 //set short options
 //NOTE: short options that need an argument must be followed by a :
-static const char short_options[] = "hvat"; // 
+static const char short_options[] = "hvatRksj:"; // 
     
 // ===============================
 // Internal Functions
@@ -37,7 +116,71 @@ static void print_help(Options* opts, const char *prog_name) {
     printf("  -v, --version           Show version and exit\n");
     printf("  -a, --all               Show All (include files starting with .)\n");
     printf("  -t, --time              Sort by time (default is alphabetical)\n");
-    printf("\nIf no target is specified, default will be current directory\n");
+    printf("  -s, --size              Show allocated space before each entry (in KiB)\n");
+    printf("  -k, --kibibytes         Show allocated space and totals in KiB whatever the\n");
+    printf("                          --block-size\n");
+    printf("      --block-size=SIZE   Show sizes in units of SIZE (K, 1K, KiB, MB, 4096...);\n");
+    printf("                          --block-size=1 gives exact byte counts\n");
+    printf("      --si                Scale sizes by powers of 1000 (k, M, G)\n");
+    printf("      --time=WORD         Show and sort by mtime (default), atime, ctime or birth\n");
+    printf("      --sort=WORD         Sort by name (default), time (-t) or count: directories\n");
+    printf("                          first, by --dir-counts, largest first\n");
+    printf("      --time-style=STYLE  full-iso, long-iso, iso, locale (default) or +FORMAT,\n");
+    printf("                          where FORMAT is strftime's plus %%N for nanoseconds\n");
+    printf("  -R, --recursive         List subdirectories recursively\n");
+    printf("      --tree              Draw the hierarchy with connectors, closing each\n");
+    printf("                          directory with its file count and size\n");
+    printf("      --max-depth=N       With -R or --tree, show only N levels below each target\n");
+    printf("      --merge             List all directory targets as one sorted listing,\n");
+    printf("                          naming entries by target and name\n");
+    printf("      --dir-counts[=WHAT] Show how many entries (default) or subdirs each\n");
+    printf("                          directory holds; hidden ones count only with -a\n");
+    printf("      --xattrs            Mark entries with ACLs (+), security labels (.) or\n");
+    printf("                          other extended attributes (@)\n");
+    printf("  -j, --jobs=N            Worker threads for recursive listings (default: usable CPUs)\n");
+    printf("      --buffer-mem=SIZE   Cap on buffered -R output awaiting its turn (default 64M or\n");
+    printf("                          1/16 of the memory limit)\n");
+    printf("      --no-numa           Do not pin workers to NUMA nodes\n");
+    printf("      --huge-pages        Back very large directory listings with huge pages\n");
+    printf("      --slowest=N         Report the N slowest directories on stderr at the end\n");
+    printf("      --progress          Show a live progress line on stderr\n");
+    printf("      --duplicates        Recursively find files with identical contents\n");
+    printf("      --collisions        Recursively find names equal ignoring case/normalisation\n");
+    printf("      --check-names=FILE  Report names in FILE (one per line, - for stdin)\n");
+    printf("                          missing from each directory, and unexpected extras\n");
+    printf("                          (not when a short list is probed name by name)\n");
+    printf("      --show-found        With --check-names, also list the names that exist\n");
+    printf("      --compare A B       Compare two trees: - only in A, + only in B, ! differs\n");
+    printf("      --incremental=SNAP  Recursive listing that reuses unchanged directories\n");
+    printf("                          from SNAP, then saves a new snapshot there\n");
+    printf("      --refresh-stats     With --incremental, re-stat entries of reused directories\n");
+    printf("      --query=SNAP PATH   Look up PATH in a saved snapshot; PATH ending in *\n");
+    printf("                          lists every recorded entry starting with it\n");
+    printf("      --source=SRC        List from SRC instead of the filesystem: fs,\n");
+    printf("                          snapshot:FILE, tar:FILE (- for stdin) or\n");
+    printf("                          mock:DEPTH,FANOUT,FILES (a synthetic tree at .) or\n");
+    printf("                          replay:FILE (a --capture recording)\n");
+    printf("      --capture=FILE      Record every directory read, stat and readlink with\n");
+    printf("                          its result and duration to FILE\n");
+    printf("      --hash-names        With --capture, store salted hashes instead of names\n");
+    printf("      --replay-latency    With replay:FILE, wait the recorded time on each call\n");
+    printf("      --id-cache=FILE     Share user/group names with other gls processes\n");
+    printf("                          through FILE (default: $GLS_ID_CACHE, if set)\n");
+    printf("      --compress=CODEC    Write stdout compressed with gzip or zstd, on --jobs\n");
+    printf("                          threads (codecs as available at build time)\n");
+    printf("      --ring=fd:N|shm:/NAME  Write listings as binary records into a shared-\n");
+    printf("                          memory ring (an inherited fd or a new shm object)\n");
+    printf("                          for a local consumer such as glsring\n");
+    printf("      --ring-size=SIZE    Size of a ring gls creates (default 16M)\n");
+    printf("      --renderer=PATH.so  Format plain and -R listings with a plugin\n");
+    printf("                          (see glsrender.h and jsonrender.c)\n");
+    printf("      --where=EXPR        List only entries matching EXPR, e.g.\n");
+    printf("                          \"size > 1G and mtime < -30d and not name ~ '*.keep'\"\n");
+    printf("                          (fields name type size mtime atime ctime links\n");
+    printf("                          uid gid; see where.h)\n");
+    printf("      --show-limits       Show detected CPU, memory and open-file limits\n");
+    printf("\nIf no target is specified, default will be current directory.  A quoted\n");
+    printf("target such as 'logs/*.gz' is expanded by gls itself (*, ?, [...]).\n");
 	free_options(opts);
 	exit(EXIT_SUCCESS);
 }
@@ -48,6 +191,54 @@ static void print_version(Options* opts) {
 	exit(EXIT_SUCCESS);
 }
 
+// Parse a positive integer option value, exiting with a message on error.
+static long parse_count(Options *opts, const char *name, const char *arg) {
+	char *end;
+	errno = 0;
+	long val = strtol(arg, &end, 10);
+	if (errno != 0 || end == arg || *end != '\0' || val <= 0 || val > 4096) {
+		fprintf(stderr, "Error: invalid value for --%s: '%s'\n", name, arg);
+		free_options(opts);
+		exit(EXIT_FAILURE);
+	}
+	return val;
+}
+
+// Parse a byte count with an optional K/M/G/T suffix (powers of 1024).
+static size_t parse_size(Options *opts, const char *name, const char *arg) {
+	char *end;
+	errno = 0;
+	unsigned long long val = strtoull(arg, &end, 10);
+	int shift = 0;
+	switch (*end) {
+		case 'k': case 'K': shift = 10; end++; break;
+		case 'm': case 'M': shift = 20; end++; break;
+		case 'g': case 'G': shift = 30; end++; break;
+		case 't': case 'T': shift = 40; end++; break;
+		default: break;
+	}
+	if (shift && *end == 'i') end++;
+	if (shift && (*end == 'B' || *end == 'b')) end++;
+	if (errno != 0 || end == arg || *end != '\0' || arg[0] == '-' || val == 0 ||
+	    val > (~0ULL >> shift)) {
+		fprintf(stderr, "Error: invalid size for --%s: '%s'\n", name, arg);
+		free_options(opts);
+		exit(EXIT_FAILURE);
+	}
+	return (size_t)(val << shift);
+}
+
+// Copy a string option value, exiting on allocation failure.
+static char *dup_arg(Options *opts, const char *arg) {
+	char *copy = strdup(arg);
+	if (!copy) {
+		fprintf(stderr, "Error: Memory allocation failed\n");
+		free_options(opts);
+		exit(EXIT_FAILURE);
+	}
+	return copy;
+}
+
 static void free_string_array(char **array, int count) {
     if (array) {
         for (int i = 0; i < count; i++) {
@@ -70,6 +261,10 @@ Options* parse_loptions(int argc, char *argv[]) {
         fprintf(stderr, "Error: Memory allocation failed\n");
         exit(EXIT_FAILURE);
     }
+    // Sized to what this process may use, not the host (see resources.c).
+    const Resources *res = resources_get();
+    opts->jobs = res->jobs;
+    opts->buffer_mem = res->buffer_mem;
     
     int opt; // iterator as we parse the options
     int option_index = 0; // used by getopt_long - ignored by us unless we want to know which option is being processed
@@ -79,10 +274,121 @@ Options* parse_loptions(int argc, char *argv[]) {
 			// ------ standard help & version options --------
             case 'h': print_help(opts, argv[0]); break;
             case 'v': print_version(opts); break;
+            case OPT_SHOW_LIMITS:
+                resources_print(stdout);
+                free_options(opts);
+                exit(EXIT_SUCCESS);
 
 			// ------ simple bool options --------
             case 'a':  opts->show_all = true; break;
             case 't':  opts->sort_by_time = true; break;
+            case 'R':  opts->recursive = true; break;
+            case OPT_PROGRESS: opts->progress = true; break;
+            case OPT_DUPLICATES: opts->duplicates = opts->recursive = true; break;
+            case OPT_COLLISIONS: opts->collisions = opts->recursive = true; break;
+            case OPT_SHOW_FOUND: opts->check_show_found = true; break;
+            case OPT_COMPARE: opts->compare = opts->recursive = true; break;
+            case OPT_TREE: opts->tree = true; break;
+            case OPT_MERGE: opts->merge = true; break;
+            case OPT_REFRESH_STATS: opts->refresh_stats = true; break;
+            case OPT_INCREMENTAL:
+                free(opts->incremental);
+                opts->incremental = dup_arg(opts, optarg);
+                opts->recursive = true;
+                break;
+            case OPT_QUERY:
+                free(opts->query);
+                opts->query = dup_arg(opts, optarg);
+                break;
+            case OPT_SOURCE:
+                free(opts->source);
+                opts->source = dup_arg(opts, optarg);
+                break;
+            case OPT_CAPTURE:
+                free(opts->capture);
+                opts->capture = dup_arg(opts, optarg);
+                break;
+            case OPT_ID_CACHE:
+                free(opts->id_cache);
+                opts->id_cache = dup_arg(opts, optarg);
+                break;
+            case OPT_COMPRESS:
+                free(opts->compress);
+                opts->compress = dup_arg(opts, optarg);
+                break;
+            case OPT_RING:
+                free(opts->ring);
+                opts->ring = dup_arg(opts, optarg);
+                break;
+            case OPT_RENDERER:
+                free(opts->renderer);
+                opts->renderer = dup_arg(opts, optarg);
+                break;
+            case OPT_WHERE:
+                free(opts->where);
+                opts->where = dup_arg(opts, optarg);
+                break;
+            case OPT_HASH_NAMES: opts->hash_names = true; break;
+            case OPT_REPLAY_LATENCY: opts->replay_latency = true; break;
+            case OPT_NO_NUMA: opts->no_numa = true; break;
+            case OPT_HUGE_PAGES: opts->huge_pages = true; break;
+            case OPT_XATTRS: opts->xattrs = true; break;
+            case OPT_TIME:
+                // Bare --time is the long form of -t.
+                if (!optarg) {
+                    opts->sort_by_time = true;
+                } else if ((opts->time_field = timefmt_parse_field(optarg)) < 0) {
+                    fprintf(stderr, "Error: invalid value for --time: '%s'\n", optarg);
+                    free_options(opts);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case OPT_BLOCK_SIZE:
+                free(opts->block_size);
+                opts->block_size = dup_arg(opts, optarg);
+                break;
+            case OPT_SI: opts->si = true; break;
+            case 'k': opts->kibibytes = true; break;
+            case 's': opts->show_blocks = true; break;
+            case OPT_DIR_COUNTS:
+                if (!optarg || strcmp(optarg, "entries") == 0) {
+                    opts->dir_counts = DIR_COUNT_ENTRIES;
+                } else if (strcmp(optarg, "subdirs") == 0) {
+                    opts->dir_counts = DIR_COUNT_SUBDIRS;
+                } else {
+                    fprintf(stderr, "Error: invalid value for --dir-counts: '%s'\n", optarg);
+                    free_options(opts);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case OPT_SORT:
+                opts->sort_by_time = strcmp(optarg, "time") == 0;
+                opts->sort_by_count = strcmp(optarg, "count") == 0;
+                if (!opts->sort_by_time && !opts->sort_by_count && strcmp(optarg, "name") != 0) {
+                    fprintf(stderr, "Error: invalid value for --sort: '%s'\n", optarg);
+                    free_options(opts);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case OPT_TIME_STYLE:
+                free(opts->time_style);
+                opts->time_style = dup_arg(opts, optarg);
+                break;
+            case OPT_CHECK_NAMES:
+                free(opts->check_names);
+                opts->check_names = dup_arg(opts, optarg);
+                break;
+
+			// ------ options with values --------
+            case 'j':  opts->jobs = (int)parse_count(opts, "jobs", optarg); break;
+            case OPT_BUFFER_MEM:
+                opts->buffer_mem = parse_size(opts, "buffer-mem", optarg); break;
+            case OPT_SLOWEST:
+                opts->slowest = (int)parse_count(opts, "slowest", optarg); break;
+            case OPT_RING_SIZE:
+                opts->ring_size = parse_size(opts, "ring-size", optarg); break;
+            case OPT_MAX_DEPTH:
+                opts->max_depth = (int)parse_count(opts, "max-depth", optarg); break;
                                 
 			// ------ standard handler options --------
             case '?':
@@ -96,6 +402,13 @@ Options* parse_loptions(int argc, char *argv[]) {
                 exit(EXIT_FAILURE);
         }
     }
+
+    // Each worker holds directory fds open; more than the limit allows
+    // would just fail with EMFILE partway through.
+    if (opts->jobs > res->max_jobs) opts->jobs = res->max_jobs;
+    // Sorting by count needs the counts.
+    if (opts->sort_by_count && opts->dir_counts == DIR_COUNT_OFF)
+        opts->dir_counts = DIR_COUNT_ENTRIES;
     
 	// optind tells us where the first non-option argument is (i.e., the first operand)
 	// If there are no operands, optind == argc
@@ -109,12 +422,7 @@ Options* parse_loptions(int argc, char *argv[]) {
 	// *.c was originally at argv[3] on the command line
 
     
-    // Collect operands    
-    if (opts->operand_count > MAX_OPERANDS) {
-        fprintf(stderr, "Error: too many operands (max %d)\n", MAX_OPERANDS);
-        free_options(opts);
-        exit(EXIT_FAILURE);
-    }
+    // Collect operands (quoted patterns among them are expanded later)
 	
 	// flag to use a default if there's no target specified 
 	bool use_default = false;
@@ -148,6 +456,18 @@ Options* parse_loptions(int argc, char *argv[]) {
 void free_options(Options *opts) {
     if (opts) {
         free_string_array(opts->operands, opts->operand_count);
+        free(opts->check_names);
+        free(opts->incremental);
+        free(opts->query);
+        free(opts->source);
+        free(opts->capture);
+        free(opts->id_cache);
+        free(opts->compress);
+        free(opts->ring);
+        free(opts->renderer);
+        free(opts->where);
+        free(opts->time_style);
+        free(opts->block_size);
         free(opts);
     }
 }
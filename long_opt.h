@@ -2,12 +2,13 @@
 #define OPTIONS_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
 // ===============================
 // Constants
 // ===============================
-#define MAX_OPERANDS    256
 #define GLS_VERSION	"1.3.0"
+#define DEFAULT_BUFFER_MEM  (64UL * 1024 * 1024)   // reorder buffer cap for -R
 
 // ===============================
 // Structs
@@ -20,6 +21,43 @@ typedef struct {
     // options
     bool show_all;
     bool sort_by_time;
+    bool sort_by_count;     // directories first, by --dir-counts
+    bool recursive;
+    bool tree;              // --tree: indented hierarchy with subtree totals
+    int max_depth;          // levels shown below each operand (0 = all)
+    bool merge;             // one sorted listing across all directory operands
+    bool progress;          // live status line on stderr
+    bool duplicates;        // report duplicate-content files instead of listing
+    bool collisions;        // report case/normalisation name collisions
+    bool compare;           // diff two trees instead of listing
+    char *incremental;      // snapshot file reused and rewritten by -R
+    bool refresh_stats;     // re-lstat entries of reused directories
+    char *query;            // snapshot to look operands up in (NULL = off)
+    char *source;           // --source spec (NULL = the filesystem)
+    char *capture;          // record listing I/O to this file (NULL = off)
+    bool hash_names;        // anonymise names in the capture
+    bool replay_latency;    // replay recorded call durations
+    char *id_cache;         // host-wide uid/gid name cache file (NULL = off)
+    char *compress;         // --compress codec for stdout (NULL = off)
+    char *ring;             // --ring=fd:N|shm:/NAME binary sink (NULL = off)
+    size_t ring_size;       // bytes for a ring gls creates (0 = default)
+    char *renderer;         // --renderer plugin to dlopen (NULL = long format)
+    char *where;            // --where filter expression (NULL = list everything)
+    char *check_names;      // file of expected names (NULL = off)
+    bool check_show_found;  // list found names in long format
+    int jobs;               // worker threads for recursive listings
+    size_t buffer_mem;      // bytes of finished output held for ordering
+    bool no_numa;           // leave workers unpinned on multi-node machines
+    bool huge_pages;        // back large entry arrays with huge pages
+    bool xattrs;            // show the ACL/xattr indicator column
+    int time_field;         // TIME_* timestamp shown and sorted by
+    char *time_style;       // --time-style (NULL = $TIME_STYLE or locale)
+    char *block_size;       // --block-size (NULL = $LS_BLOCK_SIZE, $BLOCK_SIZE or human)
+    bool si;                // scale sizes by powers of 1000
+    bool kibibytes;         // -k: allocated space in KiB regardless
+    bool show_blocks;       // -s: allocated space column
+    int dir_counts;         // DIR_COUNT_* column (0 = off)
+    int slowest;            // report the N slowest directories (0 = off)
     // operands
     char **operands;
     int operand_count;
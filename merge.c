@@ -0,0 +1,148 @@
+/*
+ * merge.c - One combined listing of several directories for --merge
+ * -----------------------------------------------------------------
+ * Every operand is read and sorted on its own, in parallel on up to --jobs
+ * threads, exactly as a plain listing would be.  The sorted listings are then
+ * merged through a binary heap of cursors: k listings of n entries in total
+ * cost n log k comparisons, against n log n for sorting the concatenation,
+ * and the per-operand sorts are the part that runs in parallel.
+ *
+ * Ties between operands go to the earlier operand, so entries that compare
+ * equal keep the command-line order.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "gls.h"
+#include "display.h"
+#include "merge.h"
+#include "where.h"
+#include "timing.h"
+
+typedef struct {
+    char **dirs;
+    DirListing *lists;
+    int *status;
+    int count;
+    const Options *opts;
+    atomic_int next;
+} ScanPool;
+
+typedef struct {
+    int list;                   // operand index
+    int pos;                    // next entry of that listing
+} Cursor;
+
+// ========================================
+// Parallel Collection
+// ========================================
+
+static void *scan_worker(void *arg) {
+    ScanPool *pool = arg;
+    int i;
+
+    while ((i = atomic_fetch_add(&pool->next, 1)) < pool->count) {
+        uint64_t start = timing_now();
+        DirListing *list = &pool->lists[i];
+        pool->status[i] = scan_directory(pool->dirs[i], pool->opts, list);
+        where_apply(list);
+        if (pool->status[i] == 0)
+            timing_record(pool->dirs[i], list->enum_ns, list->stat_ns,
+                          timing_now() - start, list->count);
+    }
+    return NULL;
+}
+
+static void scan_all(ScanPool *pool, int threads) {
+    if (threads > pool->count) threads = pool->count;
+    if (threads < 1) threads = 1;
+
+    atomic_store(&pool->next, 0);
+    pthread_t *tids = xcalloc((size_t)threads, sizeof(pthread_t));
+    int started = 0;
+    for (; started < threads; started++) {
+        if (pthread_create(&tids[started], NULL, scan_worker, pool) != 0) break;
+    }
+    if (started == 0) scan_worker(pool);
+    for (int i = 0; i < started; i++) pthread_join(tids[i], NULL);
+    free(tids);
+}
+
+// ========================================
+// K-way Merge
+// ========================================
+
+static const FileEntry *cursor_entry(const DirListing *lists, const Cursor *c) {
+    return &lists[c->list].entries[c->pos];
+}
+
+static bool cursor_before(const DirListing *lists, const Cursor *a, const Cursor *b) {
+    int cmp = compare_entries(cursor_entry(lists, a), cursor_entry(lists, b));
+    return cmp < 0 || (cmp == 0 && a->list < b->list);
+}
+
+static void sift_down(const DirListing *lists, Cursor *heap, int n, int i) {
+    for (;;) {
+        int best = i, l = 2 * i + 1, r = l + 1;
+        if (l < n && cursor_before(lists, &heap[l], &heap[best])) best = l;
+        if (r < n && cursor_before(lists, &heap[r], &heap[best])) best = r;
+        if (best == i) return;
+        Cursor tmp = heap[i];
+        heap[i] = heap[best];
+        heap[best] = tmp;
+        i = best;
+    }
+}
+
+int list_merged(char **dirs, int dir_count, const Options *opts) {
+    int result = 0;
+    ScanPool pool = {
+        .dirs = dirs,
+        .lists = xcalloc((size_t)dir_count, sizeof(DirListing)),
+        .status = xcalloc((size_t)dir_count, sizeof(int)),
+        .count = dir_count,
+        .opts = opts,
+    };
+    scan_all(&pool, opts->jobs);
+
+    Cursor *heap = xmalloc((size_t)(dir_count > 0 ? dir_count : 1) * sizeof(Cursor));
+    int n = 0;
+    long total_blocks = 0;
+    for (int i = 0; i < dir_count; i++) {
+        if (pool.status[i] != 0) {
+            result = 1;
+            continue;
+        }
+        total_blocks += pool.lists[i].total_blocks;
+        if (pool.lists[i].count > 0) heap[n++] = (Cursor){ i, 0 };
+    }
+    for (int i = n / 2 - 1; i >= 0; i--) sift_down(pool.lists, heap, n, i);
+
+    char total[32];
+    format_blocks((unsigned long long)total_blocks, total, sizeof(total));
+    printf("total %s\n", total);
+
+    FileStats stats = {0};
+    while (n > 0) {
+        Cursor *top = &heap[0];
+        FileEntry fe = *cursor_entry(pool.lists, top);
+        char path[PATH_MAX];
+        join_path(path, sizeof(path), dirs[top->list], fe.name);
+        fe.name = path;
+        // An empty directory argument makes the display name the full path,
+        // which also resolves symlink targets relative to the operand.
+        print_file_entry(stdout, "", &fe, &stats);
+
+        if (++top->pos == pool.lists[top->list].count) heap[0] = heap[--n];
+        sift_down(pool.lists, heap, n, 0);
+    }
+
+    for (int i = 0; i < dir_count; i++) free_listing(&pool.lists[i]);
+    free(heap);
+    free(pool.lists);
+    free(pool.status);
+    return result;
+}
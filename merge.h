@@ -0,0 +1,16 @@
+#ifndef MERGE_H
+#define MERGE_H
+
+/*
+ * merge.h - One combined listing of several directories for --merge
+ * -----------------------------------------------------------------
+ * Instead of one section per directory operand, --merge prints a single
+ * listing of all their entries, sorted as one (by name, or by time with -t),
+ * each named by its operand and leaf name, under one "total" line.
+ */
+
+#include "gls.h"
+
+int list_merged(char **dirs, int dir_count, const Options *opts);
+
+#endif
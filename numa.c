@@ -0,0 +1,310 @@
+/*
+ * numa.c - NUMA-aware worker placement and entry arenas
+ * -----------------------------------------------------
+ * Nodes are read from /sys/devices/system/node and intersected with the
+ * process's affinity mask, so a container confined to one socket sees one
+ * node and nothing is pinned.  Memory placement relies on the kernel's
+ * first-touch policy: an array allocated and filled by a pinned worker lands
+ * on that worker's node without any explicit binding.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include "gls.h"
+#include "numa.h"
+
+#define MAX_NODES           64
+#define ARENA_CACHE_SLOTS   4
+#define HUGE_PAGE           (2UL * 1024 * 1024)
+#define MAX_SORT_PARTS      16
+
+static int node_count = 1;
+static bool huge_pages = false;
+#ifdef __linux__
+static cpu_set_t node_cpus[MAX_NODES];
+#endif
+
+static _Thread_local int current_node = -1;
+
+// ========================================
+// Topology
+// ========================================
+
+#ifdef __linux__
+// Parse a sysfs CPU list such as "0-3,8-11" into `set`.
+static bool parse_cpulist(const char *path, cpu_set_t *set) {
+    FILE *fp = fopen(path, "r");
+    char buf[4096];
+
+    CPU_ZERO(set);
+    if (!fp) return false;
+    bool ok = fgets(buf, sizeof(buf), fp) != NULL;
+    fclose(fp);
+    if (!ok) return false;
+
+    for (char *tok = strtok(buf, ",\n"); tok; tok = strtok(NULL, ",\n")) {
+        char *end;
+        long lo = strtol(tok, &end, 10), hi = lo;
+        if (*end == '-') hi = strtol(end + 1, NULL, 10);
+        for (long cpu = lo; cpu <= hi && cpu < CPU_SETSIZE; cpu++)
+            if (cpu >= 0) CPU_SET((int)cpu, set);
+    }
+    return true;
+}
+
+static void detect_nodes(void) {
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return;
+
+    int found = 0;
+    for (int node = 0; node < 1024 && found < MAX_NODES; node++) {
+        char path[128];
+        cpu_set_t cpus;
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        if (!parse_cpulist(path, &cpus)) continue;
+        // Memory-only nodes and nodes outside our mask cannot run workers.
+        CPU_AND(&node_cpus[found], &cpus, &allowed);
+        if (CPU_COUNT(&node_cpus[found]) > 0) found++;
+    }
+    if (found > 1) node_count = found;
+}
+#endif
+
+void numa_init(const Options *opts) {
+    huge_pages = opts->huge_pages;
+#ifdef __linux__
+    if (!opts->no_numa) detect_nodes();
+#endif
+}
+
+int numa_node_count(void) {
+    return node_count;
+}
+
+int numa_bind_worker(int index) {
+    if (node_count <= 1 || index < 0) return -1;
+#ifdef __linux__
+    int node = index % node_count;
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &node_cpus[node]) != 0)
+        return -1;
+    current_node = node;
+    return node;
+#else
+    return -1;
+#endif
+}
+
+// ========================================
+// Arenas
+// ========================================
+
+// Freed huge blocks, kept per node for the next directory of the same size
+// (arrays grow by doubling, so sizes repeat).
+typedef struct {
+    void *ptr[ARENA_CACHE_SLOTS];
+    size_t bytes[ARENA_CACHE_SLOTS];
+} ArenaCache;
+
+static ArenaCache arena_cache[MAX_NODES];
+static pthread_mutex_t arena_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static bool is_huge(size_t bytes) {
+    return huge_pages && bytes >= ARENA_HUGE_MIN;
+}
+
+static size_t huge_round(size_t bytes) {
+    return (bytes + HUGE_PAGE - 1) & ~(HUGE_PAGE - 1);
+}
+
+static ArenaCache *local_cache(void) {
+    return &arena_cache[current_node < 0 ? 0 : current_node];
+}
+
+static void *huge_map(size_t bytes, bool zero) {
+    size_t len = huge_round(bytes);
+
+    pthread_mutex_lock(&arena_lock);
+    ArenaCache *cache = local_cache();
+    for (int i = 0; i < ARENA_CACHE_SLOTS; i++) {
+        if (cache->ptr[i] && cache->bytes[i] == len) {
+            void *ptr = cache->ptr[i];
+            cache->ptr[i] = NULL;
+            pthread_mutex_unlock(&arena_lock);
+            if (zero) memset(ptr, 0, len);
+            return ptr;
+        }
+    }
+    pthread_mutex_unlock(&arena_lock);
+
+    void *ptr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) {
+        fprintf(stderr, "Fatal: Out of memory (mmap %zu bytes).\n", len);
+        exit(EXIT_FAILURE);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(ptr, len, MADV_HUGEPAGE);
+#endif
+    return ptr;
+}
+
+static void huge_unmap(void *ptr, size_t bytes) {
+    size_t len = huge_round(bytes);
+
+    pthread_mutex_lock(&arena_lock);
+    ArenaCache *cache = local_cache();
+    for (int i = 0; i < ARENA_CACHE_SLOTS; i++) {
+        if (!cache->ptr[i]) {
+            cache->ptr[i] = ptr;
+            cache->bytes[i] = len;
+            ptr = NULL;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&arena_lock);
+    if (ptr) munmap(ptr, len);
+}
+
+void *arena_alloc(size_t bytes) {
+    return is_huge(bytes) ? huge_map(bytes, true) : xcalloc(1, bytes);
+}
+
+void *arena_grow(void *ptr, size_t old_bytes, size_t new_bytes) {
+    if (!ptr) return is_huge(new_bytes) ? huge_map(new_bytes, false) : xmalloc(new_bytes);
+    if (!is_huge(new_bytes)) return xrealloc(ptr, new_bytes);
+    // Still inside the mapping we already have.
+    if (is_huge(old_bytes) && huge_round(old_bytes) >= new_bytes) return ptr;
+
+    void *grown = huge_map(new_bytes, false);
+    memcpy(grown, ptr, old_bytes < new_bytes ? old_bytes : new_bytes);
+    arena_free(ptr, old_bytes);
+    return grown;
+}
+
+void arena_free(void *ptr, size_t bytes) {
+    if (!ptr) return;
+    if (is_huge(bytes)) huge_unmap(ptr, bytes);
+    else free(ptr);
+}
+
+void numa_shutdown(void) {
+    pthread_mutex_lock(&arena_lock);
+    for (int n = 0; n < MAX_NODES; n++) {
+        for (int i = 0; i < ARENA_CACHE_SLOTS; i++) {
+            if (arena_cache[n].ptr[i]) munmap(arena_cache[n].ptr[i], arena_cache[n].bytes[i]);
+            arena_cache[n].ptr[i] = NULL;
+        }
+    }
+    pthread_mutex_unlock(&arena_lock);
+}
+
+// ========================================
+// Partitioned Sort
+// ========================================
+
+// One partition sort, or one merge of two adjacent sorted runs into `dst`.
+typedef struct {
+    char *src, *dst;
+    size_t left, right;         // run lengths; right == 0 means sort `src`
+    size_t size;
+    int (*cmp)(const void *, const void *);
+    int worker;                 // decides the node the task runs on
+} SortTask;
+
+static void *sort_task(void *arg) {
+    SortTask *t = arg;
+    numa_bind_worker(t->worker);
+
+    if (t->right == 0 && t->dst == NULL) {
+        qsort(t->src, t->left, t->size, t->cmp);
+        return NULL;
+    }
+    const char *a = t->src, *a_end = a + t->left * t->size;
+    const char *b = a_end, *b_end = b + t->right * t->size;
+    char *out = t->dst;
+    while (a < a_end && b < b_end) {
+        // Ties take the left run.
+        if (t->cmp(b, a) < 0) { memcpy(out, b, t->size); b += t->size; }
+        else { memcpy(out, a, t->size); a += t->size; }
+        out += t->size;
+    }
+    memcpy(out, a, (size_t)(a_end - a));
+    out += a_end - a;
+    memcpy(out, b, (size_t)(b_end - b));
+    return NULL;
+}
+
+// Run tasks on their own threads; any that cannot start run here instead.
+static void run_tasks(SortTask *tasks, int count) {
+    pthread_t threads[MAX_SORT_PARTS];
+    bool started[MAX_SORT_PARTS];
+
+    for (int i = 0; i < count; i++)
+        started[i] = pthread_create(&threads[i], NULL, sort_task, &tasks[i]) == 0;
+    for (int i = 0; i < count; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            // Inline on the caller, which keeps its own placement.
+            SortTask t = tasks[i];
+            t.worker = -1;
+            sort_task(&t);
+        }
+    }
+}
+
+void numa_sort(void *base, size_t count, size_t size,
+               int (*cmp)(const void *, const void *), int parts) {
+    if (parts > MAX_SORT_PARTS) parts = MAX_SORT_PARTS;
+    if ((size_t)parts > count / (SORT_PARTITION_MIN / 4)) parts = (int)(count / (SORT_PARTITION_MIN / 4));
+    if (parts < 2) {
+        qsort(base, count, size, cmp);
+        return;
+    }
+
+    // Phase 1: each partition sorted on its own node.
+    size_t run_start[MAX_SORT_PARTS + 1];
+    SortTask tasks[MAX_SORT_PARTS];
+    for (int i = 0; i <= parts; i++) run_start[i] = count * (size_t)i / (size_t)parts;
+    for (int i = 0; i < parts; i++) {
+        tasks[i] = (SortTask){ (char *)base + run_start[i] * size, NULL,
+                               run_start[i + 1] - run_start[i], 0, size, cmp, i };
+    }
+    run_tasks(tasks, parts);
+
+    // Phase 2: pairwise merges, ping-ponging between the array and a scratch
+    // copy; each pass halves the number of runs.
+    size_t bytes = count * size;
+    char *src = base, *dst = arena_grow(NULL, 0, bytes);
+    char *scratch = dst;
+    int runs = parts;
+    while (runs > 1) {
+        int n = 0, next = 0;
+        for (int i = 0; i < runs; i += 2) {
+            size_t lo = run_start[i];
+            size_t mid = run_start[i + 1];
+            size_t hi = i + 1 < runs ? run_start[i + 2] : mid;
+            if (i + 1 < runs) {
+                tasks[n] = (SortTask){ src + lo * size, dst + lo * size,
+                                       mid - lo, hi - mid, size, cmp, n };
+                n++;
+            } else {
+                memcpy(dst + lo * size, src + lo * size, (mid - lo) * size);
+            }
+            run_start[next++] = lo;
+        }
+        run_start[next] = count;
+        run_tasks(tasks, n);
+        runs = next;
+        char *swap = src; src = dst; dst = swap;
+    }
+    if (src != base) memcpy(base, src, bytes);
+    arena_free(scratch, bytes);
+}
@@ -0,0 +1,49 @@
+#ifndef NUMA_H
+#define NUMA_H
+
+/*
+ * numa.h - NUMA-aware worker placement and entry arenas
+ * -----------------------------------------------------
+ * On a multi-socket machine the walker's workers are spread round-robin over
+ * the NUMA nodes this process may run on and pinned there, so a directory's
+ * entries are read, stat'ed, sorted and rendered on one node.  Very large
+ * directories are sorted in partitions, each on its own node, and merged.
+ *
+ * With --huge-pages, entry arrays above ARENA_HUGE_MIN come from anonymous
+ * mappings advised for transparent huge pages instead of malloc, and are
+ * recycled through a small per-node cache so their pages stay local.
+ *
+ * Everything here degrades to plain malloc/qsort on one node or off Linux.
+ */
+
+#include <stddef.h>
+#include "long_opt.h"
+
+#define ARENA_HUGE_MIN      (4UL * 1024 * 1024)    // smaller arrays use malloc
+#define SORT_PARTITION_MIN  (128 * 1024)           // entries before sorting in parallel
+
+// Detect the topology and read --no-numa / --huge-pages.  Call once, before
+// any worker starts.
+void numa_init(const Options *opts);
+// Release cached arenas.
+void numa_shutdown(void);
+
+// Usable NUMA nodes (1 when disabled or unknown).
+int numa_node_count(void);
+
+// Pin the calling thread to node `index % nodes`.  Returns that node, or -1
+// if the thread was left where it was.
+int numa_bind_worker(int index);
+
+// Entry arrays.  `bytes` must be the size the block was allocated or last
+// grown to: it decides which allocator the block came from.
+void *arena_alloc(size_t bytes);                    // zero-filled
+void *arena_grow(void *ptr, size_t old_bytes, size_t new_bytes);
+void arena_free(void *ptr, size_t bytes);
+
+// qsort() in up to `parts` partitions on separate threads (each pinned to
+// its own node), then merged.  Not stable, like qsort().
+void numa_sort(void *base, size_t count, size_t size,
+               int (*cmp)(const void *, const void *), int parts);
+
+#endif
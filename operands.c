@@ -0,0 +1,180 @@
+/*
+ * operands.c - Operand classification and quoted-glob expansion
+ * -------------------------------------------------------------
+ * A pattern is compiled once (pattern.c) and matched against the names
+ * that one pass of the active backend returns, with their d_type.
+ * Directories are classified from d_type alone (the listing reads them
+ * anyway); only the other matches are stat'ed, in backend batches, and
+ * that stat is what gets displayed.  Only the last path component may
+ * contain wildcards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include "gls.h"
+#include "backend.h"
+#include "operands.h"
+#include "pattern.h"
+
+// ========================================
+// Collecting Operands
+// ========================================
+
+static void add_path(OperandSet *set, char *path) {
+    if (set->path_count == set->path_cap) {
+        set->path_cap = set->path_cap ? set->path_cap * 2 : 16;
+        set->paths = xrealloc(set->paths, (size_t)set->path_cap * sizeof(char *));
+    }
+    set->paths[set->path_count++] = path;
+}
+
+static void add_dir(OperandSet *set, char *path) {
+    if (set->dir_count == set->dir_cap) {
+        set->dir_cap = set->dir_cap ? set->dir_cap * 2 : 16;
+        set->dirs = xrealloc(set->dirs, (size_t)set->dir_cap * sizeof(char *));
+    }
+    set->dirs[set->dir_count++] = path;
+    add_path(set, path);
+}
+
+static void add_file(OperandSet *set, char *path, const struct stat *st) {
+    if (set->file_count == set->file_cap) {
+        set->file_cap = set->file_cap ? set->file_cap * 2 : 16;
+        set->files = xrealloc(set->files, (size_t)set->file_cap * sizeof(FileEntry));
+    }
+    set->files[set->file_count++] = (FileEntry){ .name = path, .st = *st };
+    add_path(set, path);
+}
+
+static int compare_names(const void *a, const void *b) {
+    return strcoll(((const FileEntry *)a)->name, ((const FileEntry *)b)->name);
+}
+
+// Split `operand` into the directory to read and the display prefix.
+static const char *split_pattern(const char *operand, char *dir, size_t len) {
+    const char *slash = strrchr(operand, '/');
+    if (!slash) {
+        snprintf(dir, len, ".");
+        return operand;
+    }
+    size_t dlen = (size_t)(slash - operand);
+    if (dlen == 0) dlen = 1;        // "/x*" reads "/"
+    if (dlen >= len) dlen = len - 1;
+    memcpy(dir, operand, dlen);
+    dir[dlen] = '\0';
+    return slash + 1;
+}
+
+static int expand_pattern(const char *operand, OperandSet *set) {
+    char dir[PATH_MAX];
+    const char *pattern = split_pattern(operand, dir, sizeof(dir));
+    bool show_dir = pattern != operand;
+
+    BackendDir *bd = backend_open_dir(dir);
+    if (!bd) {
+        perror(operand);
+        return 1;
+    }
+    Pattern *g = pattern_compile(pattern, true);
+
+    FileEntry *matches = NULL;
+    int count = 0, capacity = 0;
+    FileEntry batch[BACKEND_BATCH];
+    int n;
+    while ((n = backend_next_batch(bd, batch, BACKEND_BATCH)) > 0) {
+        for (int i = 0; i < n; i++) {
+            if (!pattern_match(g, batch[i].name)) {
+                free(batch[i].name);
+                continue;
+            }
+            if (count == capacity) {
+                capacity = capacity ? capacity * 2 : 64;
+                matches = xrealloc(matches, (size_t)capacity * sizeof(FileEntry));
+            }
+            matches[count++] = batch[i];
+        }
+    }
+    backend_close_dir(bd);
+    pattern_free(g);
+
+    if (count == 0) {
+        errno = ENOENT;
+        perror(operand);
+        free(matches);
+        return 1;
+    }
+    qsort(matches, (size_t)count, sizeof(FileEntry), compare_names);
+
+    // Only non-directories need their stat, for display; d_type settles the
+    // rest.  Unknown types are stat'ed too.
+    FileEntry *pending = xmalloc((size_t)count * sizeof(FileEntry));
+    int *slot = xmalloc((size_t)count * sizeof(int));
+    int npending = 0;
+    for (int i = 0; i < count; i++) {
+        if (matches[i].d_type != DT_DIR) {
+            pending[npending] = matches[i];
+            slot[npending++] = i;
+        }
+    }
+    bool *ok = xcalloc((size_t)(count > 0 ? count : 1), sizeof(bool));
+    bool *is_ok = xmalloc((size_t)count * sizeof(bool));
+    for (int i = 0; i < count; i++) is_ok[i] = true;
+    for (int base = 0; base < npending; base += BACKEND_BATCH) {
+        int m = npending - base < BACKEND_BATCH ? npending - base : BACKEND_BATCH;
+        backend_stat_batch(dir, pending + base, m, ok + base);
+    }
+    for (int j = 0; j < npending; j++) {
+        matches[slot[j]].st = pending[j].st;
+        is_ok[slot[j]] = ok[j];
+    }
+
+    for (int i = 0; i < count; i++) {
+        FileEntry *fe = &matches[i];
+        char path[PATH_MAX];
+        if (show_dir) join_path(path, sizeof(path), dir, fe->name);
+        else snprintf(path, sizeof(path), "%s", fe->name);
+        free(fe->name);
+        if (!is_ok[i]) continue;        // vanished since it was read
+        if (fe->d_type == DT_DIR || S_ISDIR(fe->st.st_mode)) add_dir(set, xstrdup(path));
+        else add_file(set, xstrdup(path), &fe->st);
+    }
+    free(is_ok);
+    free(ok);
+    free(slot);
+    free(pending);
+    free(matches);
+    return 0;
+}
+
+int operands_collect(const Options *opts, OperandSet *set) {
+    int result = 0;
+
+    memset(set, 0, sizeof(*set));
+    for (int i = 0; i < opts->operand_count; i++) {
+        const char *operand = opts->operands[i];
+        struct stat st;
+        if (backend_lstat(operand, &st) == 0) {
+            if (S_ISDIR(st.st_mode)) add_dir(set, xstrdup(operand));
+            else add_file(set, xstrdup(operand), &st);
+        } else if (errno == ENOENT && pattern_has_wildcard(strrchr(operand, '/') ? strrchr(operand, '/') + 1
+                                                                         : operand)) {
+            if (expand_pattern(operand, set) != 0) result = 1;
+        } else {
+            perror(operand);
+            result = 1;
+        }
+    }
+    return result;
+}
+
+void operands_free(OperandSet *set) {
+    // Every name is owned once, through paths.
+    for (int i = 0; i < set->path_count; i++) free(set->paths[i]);
+    free(set->paths);
+    free(set->dirs);
+    free(set->files);
+    memset(set, 0, sizeof(*set));
+}
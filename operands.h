@@ -0,0 +1,34 @@
+#ifndef OPERANDS_H
+#define OPERANDS_H
+
+/*
+ * operands.h - Operand classification and quoted-glob expansion
+ * -------------------------------------------------------------
+ * Each operand is lstat'ed once and sorted into files (kept with their stat
+ * for display) and directories.  An operand that does not exist as named
+ * and has *, ? or [...] in its last component is a pattern: gls reads the
+ * parent directory once and takes the matching names, so a quoted '*.gz'
+ * is not limited by ARG_MAX and the shell never sorts or passes the names.
+ * As in the shell, a leading '.' must be matched explicitly, matches are
+ * sorted, and a backslash quotes the next character.
+ */
+
+#include <stdbool.h>
+#include "gls.h"
+
+typedef struct {
+    FileEntry *files;       // non-directories, name = path as given/matched
+    int file_count;
+    char **dirs;
+    int dir_count;
+    char **paths;           // everything, in operand order
+    int path_count;
+    int file_cap, dir_cap, path_cap;
+} OperandSet;
+
+// Classify (and expand) opts->operands.  Operands that cannot be found are
+// reported and skipped; returns non-zero if there were any.
+int operands_collect(const Options *opts, OperandSet *set);
+void operands_free(OperandSet *set);
+
+#endif
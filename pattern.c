@@ -0,0 +1,156 @@
+/*
+ * pattern.c - Compiled shell wildcard patterns
+ * --------------------------------------------
+ * A pattern is compiled once into a list of ops (literal byte, ?, *, or a
+ * 256-bit class), plus the literal text it must start and end with.  Most
+ * names in a big directory are rejected by those two memcmp()s; the rest
+ * run a greedy matcher that backtracks only to the last *, so matching is
+ * linear in practice and never exponential.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "gls.h"
+#include "pattern.h"
+
+enum { OP_LITERAL, OP_ANY, OP_STAR, OP_CLASS };
+
+typedef struct {
+    int kind;
+    unsigned char ch;               // OP_LITERAL
+    unsigned char set[32];          // OP_CLASS: bit per byte value
+} GlobOp;
+
+struct Pattern {
+    GlobOp *ops;
+    int count;
+    char *prefix;                   // literal text every match starts with
+    size_t prefix_len;
+    char *suffix;                   // and ends with (after the last *)
+    size_t suffix_len;
+    size_t min_len;                 // bytes matched by the non-* ops
+    bool hide_dot;                  // names starting with '.' never match
+};
+
+bool pattern_has_wildcard(const char *s) {
+    for (; *s; s++) {
+        if (*s == '\\' && s[1]) s++;
+        else if (*s == '*' || *s == '?' || *s == '[') return true;
+    }
+    return false;
+}
+
+static void class_set(unsigned char *set, unsigned char c) {
+    set[c >> 3] |= (unsigned char)(1u << (c & 7));
+}
+
+// Parse a bracket expression starting after '['; returns the byte after
+// the closing ']', or NULL if there is none (the '[' is then literal).
+static const char *parse_class(const char *p, GlobOp *op) {
+    bool negate = *p == '!' || *p == '^';
+    if (negate) p++;
+    memset(op->set, 0, sizeof(op->set));
+    const char *start = p;
+    while (*p && (*p != ']' || p == start)) {
+        unsigned char lo = (unsigned char)*p++;
+        if (lo == '\\' && *p) lo = (unsigned char)*p++;
+        unsigned char hi = lo;
+        if (*p == '-' && p[1] && p[1] != ']') {
+            p++;
+            hi = (unsigned char)*p++;
+            if (hi == '\\' && *p) hi = (unsigned char)*p++;
+        }
+        for (unsigned c = lo; c <= hi; c++) class_set(op->set, (unsigned char)c);
+    }
+    if (*p != ']') return NULL;
+    if (negate)
+        for (size_t i = 0; i < sizeof(op->set); i++) op->set[i] = (unsigned char)~op->set[i];
+    op->kind = OP_CLASS;
+    return p + 1;
+}
+
+Pattern *pattern_compile(const char *text, bool explicit_dot) {
+    Pattern *g = xcalloc(1, sizeof(Pattern));
+    g->ops = xmalloc((strlen(text) + 1) * sizeof(GlobOp));
+    for (const char *p = text; *p;) {
+        GlobOp *op = &g->ops[g->count];
+        const char *next;
+        if (*p == '*') {
+            op->kind = OP_STAR;
+            while (*p == '*') p++;
+        } else if (*p == '?') {
+            op->kind = OP_ANY;
+            p++;
+        } else if (*p == '[' && (next = parse_class(p + 1, op)) != NULL) {
+            p = next;
+        } else {
+            if (*p == '\\' && p[1]) p++;
+            op->kind = OP_LITERAL;
+            op->ch = (unsigned char)*p++;
+        }
+        if (op->kind != OP_STAR) g->min_len++;
+        g->count++;
+    }
+
+    int first = 0, last = g->count, last_star = -1;
+    while (first < g->count && g->ops[first].kind == OP_LITERAL) first++;
+    for (int i = 0; i < g->count; i++)
+        if (g->ops[i].kind == OP_STAR) last_star = i;
+    g->prefix = xmalloc((size_t)first + 1);
+    for (int i = 0; i < first; i++) g->prefix[i] = (char)g->ops[i].ch;
+    g->prefix_len = (size_t)first;
+    // A suffix only helps after a *; without one the length is fixed anyway.
+    if (last_star >= 0) {
+        while (last > last_star + 1 && g->ops[last - 1].kind == OP_LITERAL) last--;
+    }
+    g->suffix = xmalloc((size_t)(g->count - last) + 1);
+    g->suffix_len = last_star >= 0 ? (size_t)(g->count - last) : 0;
+    for (size_t i = 0; i < g->suffix_len; i++) g->suffix[i] = (char)g->ops[last + (int)i].ch;
+    g->hide_dot = explicit_dot &&
+                  !(g->count > 0 && g->ops[0].kind == OP_LITERAL && g->ops[0].ch == '.');
+    return g;
+}
+
+void pattern_free(Pattern *g) {
+    if (!g) return;
+    free(g->ops);
+    free(g->prefix);
+    free(g->suffix);
+    free(g);
+}
+
+static bool op_accepts(const GlobOp *op, unsigned char c) {
+    switch (op->kind) {
+        case OP_LITERAL: return op->ch == c;
+        case OP_ANY:     return true;
+        default:         return (op->set[c >> 3] >> (c & 7)) & 1;
+    }
+}
+
+bool pattern_match(const Pattern *g, const char *name) {
+    size_t len = strlen(name);
+    if (name[0] == '.' && g->hide_dot) return false;
+    if (len < g->min_len) return false;
+    if (memcmp(name, g->prefix, g->prefix_len) != 0) return false;
+    if (g->suffix_len && memcmp(name + len - g->suffix_len, g->suffix, g->suffix_len) != 0)
+        return false;
+
+    int i = 0, star = -1;
+    size_t p = 0, star_p = 0;
+    while (p < len) {
+        if (i < g->count && g->ops[i].kind == OP_STAR) {
+            star = i++;
+            star_p = p;
+        } else if (i < g->count && op_accepts(&g->ops[i], (unsigned char)name[p])) {
+            i++;
+            p++;
+        } else if (star >= 0) {
+            i = star + 1;
+            p = ++star_p;
+        } else {
+            return false;
+        }
+    }
+    while (i < g->count && g->ops[i].kind == OP_STAR) i++;
+    return i == g->count;
+}
@@ -0,0 +1,25 @@
+#ifndef PATTERN_H
+#define PATTERN_H
+
+/*
+ * pattern.h - Compiled shell wildcard patterns
+ * --------------------------------------------
+ * *, ? and [...] (with ! or ^ to negate and a-z ranges), matched bytewise
+ * against a whole name; a backslash quotes the next character.  Used for
+ * quoted operands and for `name ~ PATTERN` in --where.
+ */
+
+#include <stdbool.h>
+
+typedef struct Pattern Pattern;
+
+// `explicit_dot`: like the shell, a leading '.' in a name only matches a
+// literal '.' in the pattern.
+Pattern *pattern_compile(const char *text, bool explicit_dot);
+bool pattern_match(const Pattern *p, const char *name);
+void pattern_free(Pattern *p);
+
+// Whether `s` has an unquoted *, ? or [.
+bool pattern_has_wildcard(const char *s);
+
+#endif
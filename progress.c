@@ -0,0 +1,144 @@
+/*
+ * progress.c - Live progress line for --progress
+ * ----------------------------------------------
+ * The counters are plain relaxed atomics: the timer only needs a recent
+ * value, never a consistent snapshot.  The "current path" is the one piece of
+ * shared text, so it is copied under a mutex once per directory.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <limits.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "gls.h"
+#include "display.h"
+#include "progress.h"
+#include "timing.h"
+
+#define PROGRESS_INTERVAL_MS 500
+
+static bool enabled = false;
+static atomic_uint_fast64_t dirs_done;
+static atomic_uint_fast64_t entries_seen;
+static atomic_uint_fast64_t bytes_seen;
+
+static pthread_mutex_t path_lock = PTHREAD_MUTEX_INITIALIZER;
+static char current_path[PATH_MAX];
+
+static pthread_t timer_thread;
+static pthread_mutex_t timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t timer_cv = PTHREAD_COND_INITIALIZER;
+static bool stopping = false;
+static bool is_tty = false;
+static uint64_t start_time;
+
+// ========================================
+// Scanner Side
+// ========================================
+
+void progress_enter(const char *path) {
+    if (!enabled) return;
+    pthread_mutex_lock(&path_lock);
+    strncpy(current_path, path, sizeof(current_path) - 1);
+    current_path[sizeof(current_path) - 1] = '\0';
+    pthread_mutex_unlock(&path_lock);
+}
+
+void progress_add(uint64_t entries, uint64_t bytes) {
+    if (!enabled) return;
+    atomic_fetch_add_explicit(&entries_seen, entries, memory_order_relaxed);
+    atomic_fetch_add_explicit(&bytes_seen, bytes, memory_order_relaxed);
+}
+
+void progress_dir_done(void) {
+    if (!enabled) return;
+    atomic_fetch_add_explicit(&dirs_done, 1, memory_order_relaxed);
+}
+
+// ========================================
+// Timer Thread
+// ========================================
+
+static void draw(uint64_t entries, uint64_t rate, bool final) {
+    char size[32];
+    char path[PATH_MAX];
+    char safe_path[PATH_MAX];
+
+    human_size((off_t)atomic_load_explicit(&bytes_seen, memory_order_relaxed),
+               size, sizeof(size));
+    pthread_mutex_lock(&path_lock);
+    memcpy(path, current_path, sizeof(path));
+    pthread_mutex_unlock(&path_lock);
+    sanitize_string(safe_path, path, sizeof(safe_path));
+
+    fprintf(stderr, "%s%llu dirs, %llu entries, %s, %llu entries/s  %s%s",
+            is_tty ? "\r" : "",
+            (unsigned long long)atomic_load_explicit(&dirs_done, memory_order_relaxed),
+            (unsigned long long)entries, size, (unsigned long long)rate,
+            final ? "done" : safe_path,
+            is_tty ? "\033[K" : "\n");
+    if (final && is_tty) fputc('\n', stderr);
+    fflush(stderr);
+}
+
+static void *timer_main(void *arg) {
+    (void)arg;
+    uint64_t last_entries = 0;
+    uint64_t last_time = timing_now();
+
+    pthread_mutex_lock(&timer_lock);
+    while (!stopping) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += PROGRESS_INTERVAL_MS * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        int rc = 0;
+        while (!stopping && rc != ETIMEDOUT)
+            rc = pthread_cond_timedwait(&timer_cv, &timer_lock, &deadline);
+        if (stopping) break;
+
+        uint64_t now = timing_now();
+        uint64_t entries = atomic_load_explicit(&entries_seen, memory_order_relaxed);
+        uint64_t elapsed = now - last_time;
+        uint64_t rate = elapsed ? (entries - last_entries) * 1000000000ULL / elapsed : 0;
+        last_entries = entries;
+        last_time = now;
+        draw(entries, rate, false);
+    }
+    pthread_mutex_unlock(&timer_lock);
+    return NULL;
+}
+
+void progress_start(void) {
+    is_tty = isatty(STDERR_FILENO);
+    start_time = timing_now();
+    enabled = true;
+    if (pthread_create(&timer_thread, NULL, timer_main, NULL) != 0) {
+        fprintf(stderr, "Warning: unable to start progress thread.\n");
+        enabled = false;
+    }
+}
+
+void progress_stop(void) {
+    if (!enabled) return;
+    pthread_mutex_lock(&timer_lock);
+    stopping = true;
+    pthread_cond_signal(&timer_cv);
+    pthread_mutex_unlock(&timer_lock);
+    pthread_join(timer_thread, NULL);
+
+    // The closing line reports the average rate over the whole run.
+    uint64_t entries = atomic_load_explicit(&entries_seen, memory_order_relaxed);
+    uint64_t elapsed = timing_now() - start_time;
+    draw(entries, elapsed ? entries * 1000000000ULL / elapsed : 0, true);
+    enabled = false;
+}
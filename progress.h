@@ -0,0 +1,26 @@
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+/*
+ * progress.h - Live progress line for --progress
+ * ----------------------------------------------
+ * Scanners publish their counts in chunks through relaxed atomics; a timer
+ * thread samples them a couple of times a second and redraws one status line
+ * on stderr.  Nothing here is touched per entry.
+ */
+
+#include <stdint.h>
+
+// Entries stat'ed between two publications from a single scan.
+#define PROGRESS_CHUNK 4096
+
+void progress_start(void);
+void progress_stop(void);
+
+// Called by scanners: once when entering a directory, then with the counts
+// gathered so far (at most every PROGRESS_CHUNK entries and at the end).
+void progress_enter(const char *path);
+void progress_add(uint64_t entries, uint64_t bytes);
+void progress_dir_done(void);
+
+#endif
@@ -0,0 +1,107 @@
+/*
+ * renderer.c - Loading and driving a --renderer plugin
+ * ----------------------------------------------------
+ * Entries are converted from FileEntry (which carries a whole struct stat)
+ * into GlsEntry batches on the stack, so a plugin sees one contiguous array
+ * of small records per call rather than one call per entry.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <dlfcn.h>
+#include "gls.h"
+#include "glsrender.h"
+#include "renderer.h"
+#include "xattr.h"
+#include "dircount.h"
+
+static struct {
+    void *handle;
+    const GlsRenderer *r;
+    void *ctx;
+} plugin;
+
+bool renderer_active(void) {
+    return plugin.r != NULL;
+}
+
+int renderer_load(const Options *opts) {
+    if (!opts->renderer) return 0;
+
+    // dlopen() searches the library path for names without a slash; a
+    // renderer named on the command line is meant as a file.
+    char path[PATH_MAX];
+    if (strchr(opts->renderer, '/')) snprintf(path, sizeof(path), "%s", opts->renderer);
+    else snprintf(path, sizeof(path), "./%s", opts->renderer);
+
+    void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        fprintf(stderr, "Error: --renderer: %s\n", dlerror());
+        return 1;
+    }
+    GlsRendererEntry entry;
+    // The POSIX idiom for taking a function from dlsym() without a cast.
+    *(void **)&entry = dlsym(handle, GLS_RENDERER_SYMBOL);
+    const GlsRenderer *r = entry ? entry(GLS_RENDER_ABI) : NULL;
+    if (!r || r->abi != GLS_RENDER_ABI || !r->begin_dir || !r->entries || !r->end_dir) {
+        fprintf(stderr, "Error: --renderer: %s is not a gls renderer for ABI %d\n",
+                opts->renderer, GLS_RENDER_ABI);
+        dlclose(handle);
+        return 1;
+    }
+    void *ctx = NULL;
+    if (r->init && r->init(&ctx) != 0) {
+        fprintf(stderr, "Error: --renderer: %s failed to initialise\n", opts->renderer);
+        dlclose(handle);
+        return 1;
+    }
+    plugin.handle = handle;
+    plugin.r = r;
+    plugin.ctx = ctx;
+    return 0;
+}
+
+static void convert(GlsEntry *dst, const FileEntry *fe) {
+    const struct stat *st = &fe->st;
+    size_t len = strlen(fe->name);
+
+    memset(dst, 0, sizeof(*dst));
+    dst->name = fe->name;
+    dst->name_len = (uint32_t)len;
+    dst->mode = (uint32_t)st->st_mode;
+    dst->nlink = (uint32_t)st->st_nlink;
+    dst->uid = (uint32_t)st->st_uid;
+    dst->gid = (uint32_t)st->st_gid;
+    dst->d_type = fe->d_type;
+    dst->xattr = xattr_enabled() ? (int8_t)fe->xattr : 0;
+    dst->ino = (uint64_t)st->st_ino;
+    dst->dev = (uint64_t)st->st_dev;
+    dst->size = (int64_t)st->st_size;
+    dst->blocks = (int64_t)st->st_blocks;
+    dst->time_sec = (int64_t)fe->time.tv_sec;
+    dst->time_nsec = (int32_t)fe->time.tv_nsec;
+    dst->child_count = dircount_enabled() ? fe->child_count : -1;
+}
+
+void renderer_listing(FILE *out, const char *path, const FileEntry *entries, int count) {
+    const GlsRenderer *r = plugin.r;
+    GlsEntry batch[GLS_RENDER_BATCH];
+    int64_t total_blocks = 0;
+
+    for (int i = 0; i < count; i++) total_blocks += (int64_t)entries[i].st.st_blocks;
+    r->begin_dir(plugin.ctx, out, path, count, total_blocks);
+    for (int base = 0; base < count; base += GLS_RENDER_BATCH) {
+        int n = count - base < GLS_RENDER_BATCH ? count - base : GLS_RENDER_BATCH;
+        for (int i = 0; i < n; i++) convert(&batch[i], &entries[base + i]);
+        r->entries(plugin.ctx, out, path, batch, n);
+    }
+    r->end_dir(plugin.ctx, out, path);
+}
+
+void renderer_finish(void) {
+    if (!plugin.r) return;
+    if (plugin.r->finish) plugin.r->finish(plugin.ctx, stdout);
+    fflush(stdout);
+    dlclose(plugin.handle);
+    memset(&plugin, 0, sizeof(plugin));
+}
@@ -0,0 +1,27 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+/*
+ * renderer.h - Loading and driving a --renderer plugin
+ * ----------------------------------------------------
+ * With --renderer=PATH.so, plain and -R listings and file operands are
+ * handed to the plugin (glsrender.h) in batches of compact entries instead
+ * of being printed in the long format.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "gls.h"
+
+// dlopen() the plugin and run its init().  Returns non-zero (after printing
+// why) if it cannot be used.  Does nothing without --renderer.
+int renderer_load(const Options *opts);
+bool renderer_active(void);
+
+// Render one listing into `out`; safe to call from several threads.
+void renderer_listing(FILE *out, const char *path, const FileEntry *entries, int count);
+
+// Run the plugin's finish() on stdout and unload it.
+void renderer_finish(void);
+
+#endif
@@ -0,0 +1,246 @@
+/*
+ * resources.c - Container-aware defaults for --jobs and --buffer-mem
+ * ------------------------------------------------------------------
+ * On Linux the process's cgroup is read from /proc/self/cgroup and its
+ * limits from the unified hierarchy (cpu.max, memory.max), falling back to
+ * the v1 cpu and memory controllers.  Limits are checked on every ancestor,
+ * since a parent's limit binds its children.  Elsewhere only the CPU count,
+ * physical memory and rlimit are used.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "resources.h"
+#include "long_opt.h"
+#include "display.h"
+
+#define CGROUP_ROOT "/sys/fs/cgroup"
+
+static Resources res;
+static int detected = 0;
+
+// ========================================
+// cgroup Limits (Linux)
+// ========================================
+
+#ifdef __linux__
+// Read the first line of a file; false if it cannot be read.
+static int read_line(const char *path, char *buf, size_t len) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) return 0;
+    int ok = fgets(buf, (int)len, fp) != NULL;
+    fclose(fp);
+    if (ok) buf[strcspn(buf, "\n")] = '\0';
+    return ok;
+}
+
+// The cgroup path for a hierarchy: "" for v2, else the v1 controller name.
+static int cgroup_path(const char *controller, char *out, size_t len) {
+    FILE *fp = fopen("/proc/self/cgroup", "r");
+    char line[4096];
+    int found = 0;
+
+    if (!fp) return 0;
+    while (!found && fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\n")] = '\0';
+        char *controllers = strchr(line, ':');
+        char *path = controllers ? strchr(controllers + 1, ':') : NULL;
+        if (!path) continue;
+        *path++ = '\0';
+        controllers++;
+        if (controller[0] == '\0') {
+            found = strcmp(line, "0") == 0 && controllers[0] == '\0';
+        } else {
+            for (char *tok = strtok(controllers, ","); tok && !found; tok = strtok(NULL, ","))
+                found = strcmp(tok, controller) == 0;
+        }
+        if (found) snprintf(out, len, "%s", path);
+    }
+    fclose(fp);
+    return found;
+}
+
+// Apply `visit` to FILE in `dir` and each ancestor up to the mount root.
+static void for_each_level(const char *mount, const char *cg, const char *file,
+                           void (*visit)(const char *value, const char *dir_path)) {
+    char rel[4096], path[8192], value[256];
+
+    snprintf(rel, sizeof(rel), "%s", cg);
+    for (;;) {
+        snprintf(path, sizeof(path), "%s%s/%s", mount, strcmp(rel, "/") == 0 ? "" : rel, file);
+        if (read_line(path, value, sizeof(value))) visit(value, path);
+        char *slash = strrchr(rel, '/');
+        if (!slash || slash == rel) {
+            if (strcmp(rel, "/") == 0 || rel[0] == '\0') break;
+            snprintf(rel, sizeof(rel), "/");
+        } else {
+            *slash = '\0';
+        }
+    }
+}
+
+static void take_cpu_quota(double cpus) {
+    if (cpus > 0 && (res.quota_cpus == 0 || cpus < res.quota_cpus)) res.quota_cpus = cpus;
+}
+
+static void take_mem_limit(unsigned long long bytes) {
+    if (bytes > 0 && (res.cgroup_mem == 0 || bytes < res.cgroup_mem)) res.cgroup_mem = bytes;
+}
+
+// cpu.max is "QUOTA PERIOD" or "max PERIOD".
+static void visit_cpu_max(const char *value, const char *path) {
+    long long quota, period;
+    (void)path;
+    if (sscanf(value, "%lld %lld", &quota, &period) == 2 && quota > 0 && period > 0)
+        take_cpu_quota((double)quota / (double)period);
+}
+
+// memory.max is a byte count or "max".
+static void visit_mem_max(const char *value, const char *path) {
+    (void)path;
+    if (strcmp(value, "max") != 0) take_mem_limit(strtoull(value, NULL, 10));
+}
+
+static void visit_v1_quota(const char *value, const char *path) {
+    char period_path[8192], period[64];
+    long long quota = atoll(value);
+    snprintf(period_path, sizeof(period_path), "%s", path);
+    char *slash = strrchr(period_path, '/');
+    if (quota <= 0 || !slash) return;
+    snprintf(slash + 1, sizeof(period_path) - (size_t)(slash + 1 - period_path), "cpu.cfs_period_us");
+    if (read_line(period_path, period, sizeof(period)) && atoll(period) > 0)
+        take_cpu_quota((double)quota / (double)atoll(period));
+}
+
+static void visit_v1_mem(const char *value, const char *path) {
+    (void)path;
+    // v1 reports "no limit" as a huge page-rounded number.
+    unsigned long long bytes = strtoull(value, NULL, 10);
+    if (bytes < (1ULL << 60)) take_mem_limit(bytes);
+}
+
+static void detect_cgroup(void) {
+    char cg[4096];
+
+    if (cgroup_path("", cg, sizeof(cg))) {
+        char probe[8192];
+        snprintf(probe, sizeof(probe), "%s/cgroup.controllers", CGROUP_ROOT);
+        if (access(probe, R_OK) == 0) {
+            res.cgroup_version = "v2";
+            for_each_level(CGROUP_ROOT, cg, "cpu.max", visit_cpu_max);
+            for_each_level(CGROUP_ROOT, cg, "memory.max", visit_mem_max);
+            return;
+        }
+    }
+    if (cgroup_path("cpu", cg, sizeof(cg))) {
+        res.cgroup_version = "v1";
+        for_each_level(CGROUP_ROOT "/cpu", cg, "cpu.cfs_quota_us", visit_v1_quota);
+    }
+    if (cgroup_path("memory", cg, sizeof(cg))) {
+        res.cgroup_version = "v1";
+        for_each_level(CGROUP_ROOT "/memory", cg, "memory.limit_in_bytes", visit_v1_mem);
+    }
+}
+#endif
+
+// ========================================
+// Detection
+// ========================================
+
+static void detect(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    if (online > 0) res.online_cpus = online;
+#endif
+#if defined(_SC_PHYS_PAGES) && defined(_SC_PAGESIZE)
+    long pages = sysconf(_SC_PHYS_PAGES), page_size = sysconf(_SC_PAGESIZE);
+    if (pages > 0 && page_size > 0) res.phys_mem = (unsigned long long)pages * (unsigned long long)page_size;
+#endif
+#ifdef __linux__
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) res.affinity_cpus = CPU_COUNT(&set);
+    detect_cgroup();
+#endif
+
+    struct rlimit rl;
+    res.fd_soft = res.fd_hard = -1;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0) {
+        if (rl.rlim_cur != RLIM_INFINITY) res.fd_soft = (long long)rl.rlim_cur;
+        if (rl.rlim_max != RLIM_INFINITY) res.fd_hard = (long long)rl.rlim_max;
+    }
+
+    // Workers: the tightest of online CPUs, affinity and quota (rounded up,
+    // so a 1.5-CPU pod still gets two).
+    long cpus = res.online_cpus > 0 ? res.online_cpus : 1;
+    if (res.affinity_cpus > 0 && res.affinity_cpus < cpus) cpus = res.affinity_cpus;
+    if (res.quota_cpus > 0) {
+        long quota = (long)res.quota_cpus;
+        if (quota < res.quota_cpus) quota++;
+        if (quota < cpus) cpus = quota;
+    }
+
+    res.max_jobs = 4096;
+    if (res.fd_soft > 0) {
+        long long by_fds = (res.fd_soft - FD_RESERVE) / FDS_PER_JOB;
+        res.max_jobs = by_fds < 1 ? 1 : by_fds < res.max_jobs ? (int)by_fds : res.max_jobs;
+    }
+    res.jobs = cpus < res.max_jobs ? (int)cpus : res.max_jobs;
+
+    // Reorder buffer: at most 1/16 of the memory we may use.
+    unsigned long long mem = res.phys_mem;
+    if (res.cgroup_mem > 0 && (mem == 0 || res.cgroup_mem < mem)) mem = res.cgroup_mem;
+    res.buffer_mem = DEFAULT_BUFFER_MEM;
+    if (mem > 0 && mem / 16 < res.buffer_mem) res.buffer_mem = (size_t)(mem / 16);
+    if (res.buffer_mem < MIN_BUFFER_MEM) res.buffer_mem = MIN_BUFFER_MEM;
+}
+
+const Resources *resources_get(void) {
+    if (!detected) {
+        detect();
+        detected = 1;
+    }
+    return &res;
+}
+
+// ========================================
+// --show-limits
+// ========================================
+
+static void print_bytes(FILE *out, unsigned long long bytes) {
+    char text[32];
+    human_size((off_t)bytes, text, sizeof(text));
+    fputs(text, out);
+}
+
+void resources_print(FILE *out) {
+    const Resources *r = resources_get();
+
+    fprintf(out, "CPUs:         %ld online", r->online_cpus);
+    if (r->affinity_cpus > 0) fprintf(out, ", %ld in affinity mask", r->affinity_cpus);
+    if (r->quota_cpus > 0) fprintf(out, ", cgroup quota %.2f", r->quota_cpus);
+    fprintf(out, "\nMemory:       ");
+    if (r->phys_mem > 0) print_bytes(out, r->phys_mem);
+    else fprintf(out, "unknown");
+    fprintf(out, " physical");
+    if (r->cgroup_mem > 0) {
+        fprintf(out, ", cgroup limit ");
+        print_bytes(out, r->cgroup_mem);
+    }
+    fprintf(out, "\nOpen files:   ");
+    if (r->fd_soft >= 0) fprintf(out, "%lld", r->fd_soft);
+    else fprintf(out, "unlimited");
+    fprintf(out, " soft, ");
+    if (r->fd_hard >= 0) fprintf(out, "%lld", r->fd_hard);
+    else fprintf(out, "unlimited");
+    fprintf(out, " hard\ncgroup:       %s\n", r->cgroup_version ? r->cgroup_version : "not found");
+    fprintf(out, "\nDefaults:     --jobs=%d --buffer-mem=", r->jobs);
+    print_bytes(out, r->buffer_mem);
+    fprintf(out, "\n              at most %d jobs (open-file limit)\n", r->max_jobs);
+}
@@ -0,0 +1,39 @@
+#ifndef RESOURCES_H
+#define RESOURCES_H
+
+/*
+ * resources.h - Container-aware defaults for --jobs and --buffer-mem
+ * ------------------------------------------------------------------
+ * Host-wide figures oversubscribe inside a container, so the defaults are
+ * derived from what this process may actually use: its CPU affinity and
+ * cgroup CPU quota, its cgroup memory limit and its open-file limit.
+ * --show-limits prints what was found.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+
+#define MIN_BUFFER_MEM  (4UL * 1024 * 1024)
+#define FD_RESERVE      16      // descriptors kept back for stdio, output files...
+#define FDS_PER_JOB     2       // a worker holds a directory stream and a stat fd
+
+typedef struct {
+    long online_cpus;               // 0 = unknown
+    long affinity_cpus;             // 0 = unknown
+    double quota_cpus;              // cgroup CPU quota; 0 = none
+    unsigned long long phys_mem;    // 0 = unknown
+    unsigned long long cgroup_mem;  // 0 = no limit
+    long long fd_soft, fd_hard;     // -1 = unlimited
+    const char *cgroup_version;     // "v2", "v1" or NULL
+
+    // Derived defaults
+    int jobs;
+    size_t buffer_mem;
+    int max_jobs;                   // what the fd limit allows
+} Resources;
+
+// Detected once, on first use.
+const Resources *resources_get(void);
+void resources_print(FILE *out);
+
+#endif
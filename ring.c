@@ -0,0 +1,307 @@
+/*
+ * ring.c - Binary entry records in a shared-memory ring for --ring
+ * ----------------------------------------------------------------
+ * gls is the only producer.  It keeps its own copy of head and a cached
+ * tail, so the shared cache lines are touched only to publish (once per
+ * listing, or when the ring is full) and to refresh the tail when the cached
+ * value says the ring looks full.  Records for the main thread's listings
+ * are encoded straight into the ring; -R workers encode into their output
+ * buffers, which the printer copies in whole records, in listing order.
+ *
+ * A full ring is the only place gls waits on the consumer, so that is where
+ * it checks the consumer is still there; if it is not, gls stops with an
+ * error rather than waiting forever.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "gls.h"
+#include "ring.h"
+#include "ringproto.h"
+#include "xattr.h"
+#include "dircount.h"
+#include "timing.h"
+
+#define RING_DEFAULT_SIZE   (16UL * 1024 * 1024)
+#define RING_MIN_SIZE       (256UL * 1024)      // room for a record with a PATH_MAX name
+#define PUBLISH_BYTES       (64 * 1024)         // publish at least this often
+#define ATTACH_TIMEOUT_NS   (10ULL * 1000000000) // a full ring waits this long for a consumer
+
+static struct {
+    bool active;
+    const char *spec;
+    int fd;
+    pid_t parent;               // fd: our parent, normally the consumer; else 0
+    RingHeader *hdr;
+    unsigned char *data;
+    uint64_t capacity;
+    size_t map_len;
+    uint64_t head;              // our head; hdr->head lags until published
+    uint64_t tail;              // last tail seen
+    uint64_t published;
+} ring = { .fd = -1 };
+
+bool ring_active(void) {
+    return ring.active;
+}
+
+// ========================================
+// Setup
+// ========================================
+
+static int open_segment(const Options *opts, size_t *size) {
+    const char *spec = opts->ring;
+    struct stat st;
+    int fd;
+
+    if (strncmp(spec, "fd:", 3) == 0) {
+        char *end;
+        long n = strtol(spec + 3, &end, 10);
+        fd = (int)n;
+        if (end == spec + 3 || *end != '\0' || n < 0 || fstat(fd, &st) != 0) {
+            fprintf(stderr, "Error: --ring: '%s' is not an open descriptor\n", spec);
+            return -1;
+        }
+        // A descriptor the consumer already sized keeps its size.
+        *size = st.st_size > 0 ? (size_t)st.st_size : opts->ring_size;
+    } else if (strncmp(spec, "shm:", 4) == 0) {
+        fd = shm_open(spec + 4, O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (fd < 0) {
+            perror(spec);
+            return -1;
+        }
+        *size = opts->ring_size;
+    } else {
+        fprintf(stderr, "Error: invalid value for --ring: '%s'\n", spec);
+        return -1;
+    }
+    if (*size == 0) *size = RING_DEFAULT_SIZE;
+    if (*size < RING_MIN_SIZE) *size = RING_MIN_SIZE;
+    if (fstat(fd, &st) != 0 ||
+        ((size_t)st.st_size != *size && ftruncate(fd, (off_t)*size) != 0)) {
+        perror(spec);
+        return -1;
+    }
+    return fd;
+}
+
+int ring_open(const Options *opts) {
+    if (!opts->ring) return 0;
+
+    size_t size = 0;
+    int fd = open_segment(opts, &size);
+    if (fd < 0) return 1;
+
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        perror(opts->ring);
+        close(fd);
+        return 1;
+    }
+    size_t header = (sizeof(RingHeader) + RING_CACHELINE - 1) & ~(size_t)(RING_CACHELINE - 1);
+    ring.spec = opts->ring;
+    ring.parent = strncmp(opts->ring, "fd:", 3) == 0 ? getppid() : 0;
+    ring.fd = fd;
+    ring.hdr = map;
+    ring.map_len = size;
+    ring.data = (unsigned char *)map + header;
+    ring.capacity = (size - header) & ~(uint64_t)(RING_ALIGN - 1);
+
+    RingHeader *h = ring.hdr;
+    h->version = RING_VERSION;
+    h->capacity = ring.capacity;
+    h->header_size = (uint32_t)header;
+    atomic_store_explicit(&h->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&h->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&h->closed, 0, memory_order_relaxed);
+    atomic_store_explicit(&h->consumer_pid, 0, memory_order_relaxed);
+    atomic_store_explicit(&h->consumer, RING_NO_CONSUMER, memory_order_relaxed);
+    atomic_store_explicit(&h->magic, RING_MAGIC, memory_order_release);
+    ring.active = true;
+    return 0;
+}
+
+// ========================================
+// Producing Records
+// ========================================
+
+static void publish(void) {
+    if (ring.published == ring.head) return;
+    atomic_store_explicit(&ring.hdr->head, ring.head, memory_order_release);
+    ring.published = ring.head;
+}
+
+// Spin briefly, then sleep in growing steps up to a millisecond.
+static void backoff(unsigned *round) {
+    if (*round < 64) {
+        sched_yield();
+    } else {
+        long ns = 1000L << (*round - 64 < 10 ? *round - 64 : 10);
+        struct timespec ts = { 0, ns };
+        nanosleep(&ts, NULL);
+    }
+    (*round)++;
+}
+
+// Why the ring will never drain, or NULL while it still may.  `waited` is
+// how long it has been full.
+static const char *consumer_gone(uint64_t waited) {
+    uint32_t state = atomic_load_explicit(&ring.hdr->consumer, memory_order_acquire);
+    if (state == RING_DETACHED) return "the consumer stopped reading";
+    if (state == RING_ATTACHED) {
+        pid_t pid = atomic_load_explicit(&ring.hdr->consumer_pid, memory_order_relaxed);
+        if (pid > 0 && kill(pid, 0) != 0 && errno == ESRCH) return "the consumer exited";
+        return NULL;
+    }
+    if (ring.parent > 1 && getppid() != ring.parent) return "the consumer exited";
+    if (waited >= ATTACH_TIMEOUT_NS) return "no consumer attached";
+    return NULL;
+}
+
+// Nothing will read what is left: don't leave the name behind either.
+static void ring_fail(const char *why) {
+    fprintf(stderr, "Fatal: --ring=%s: %s.\n", ring.spec, why);
+    if (strncmp(ring.spec, "shm:", 4) == 0) shm_unlink(ring.spec + 4);
+    exit(EXIT_FAILURE);
+}
+
+// Wait until `bytes` more can be written.  The consumer is only checked on
+// once the back-off has reached sleeping.
+static void wait_space(uint64_t bytes) {
+    unsigned round = 0;
+    uint64_t since = 0;
+    while (ring.head + bytes - ring.tail > ring.capacity) {
+        ring.tail = atomic_load_explicit(&ring.hdr->tail, memory_order_acquire);
+        if (ring.head + bytes - ring.tail <= ring.capacity) break;
+        publish();                  // the consumer may be waiting on us
+        if (round >= 64) {
+            uint64_t now = timing_now();
+            if (!since) since = now;
+            const char *why = consumer_gone(now - since);
+            if (why) ring_fail(why);
+        }
+        backoff(&round);
+    }
+}
+
+// Room for one record of `size` bytes, contiguous; padding the end of the
+// data area first if needed.
+static unsigned char *reserve(uint32_t size) {
+    uint64_t pos = ring.head % ring.capacity;
+    if (ring.capacity - pos < size) {
+        uint64_t pad = ring.capacity - pos;
+        wait_space(pad);
+        RingRecord *rec = (RingRecord *)(ring.data + pos);
+        rec->length = (uint32_t)pad;
+        rec->type = RING_PAD;
+        rec->name_len = 0;
+        ring.head += pad;
+        pos = 0;
+    }
+    wait_space(size);
+    return ring.data + pos;
+}
+
+static void commit(uint32_t size) {
+    ring.head += size;
+    if (ring.head - ring.published >= PUBLISH_BYTES) publish();
+}
+
+static uint32_t dir_size(const char *path) {
+    return ring_record_size(sizeof(RingRecord), (uint32_t)strlen(path));
+}
+
+static uint32_t entry_size(const FileEntry *fe) {
+    return ring_record_size(sizeof(RingEntry), (uint32_t)strlen(fe->name));
+}
+
+static void encode_dir(unsigned char *dst, const char *path, uint32_t size) {
+    RingRecord *rec = (RingRecord *)dst;
+    size_t len = strlen(path);
+    rec->length = size;
+    rec->type = RING_DIR;
+    rec->name_len = (uint16_t)len;
+    memcpy(dst + sizeof(RingRecord), path, len + 1);
+}
+
+static void encode_entry(unsigned char *dst, const FileEntry *fe, uint32_t size) {
+    RingEntry *e = (RingEntry *)dst;
+    size_t len = strlen(fe->name);
+    const struct stat *st = &fe->st;
+
+    memset(e, 0, sizeof(*e));
+    e->rec.length = size;
+    e->rec.type = RING_ENTRY;
+    e->rec.name_len = (uint16_t)len;
+    e->mode = (uint32_t)st->st_mode;
+    e->nlink = (uint32_t)st->st_nlink;
+    e->uid = (uint32_t)st->st_uid;
+    e->gid = (uint32_t)st->st_gid;
+    e->ino = (uint64_t)st->st_ino;
+    e->dev = (uint64_t)st->st_dev;
+    e->size = (int64_t)st->st_size;
+    e->blocks = (int64_t)st->st_blocks;
+    e->time_sec = (int64_t)fe->time.tv_sec;
+    e->time_nsec = (int32_t)fe->time.tv_nsec;
+    e->xattr = xattr_enabled() ? (int8_t)fe->xattr : 0;
+    e->child_count = dircount_enabled() ? fe->child_count : -1;
+    memcpy(dst + sizeof(RingEntry), fe->name, len + 1);
+}
+
+void ring_put_listing(const char *path, const FileEntry *entries, int count) {
+    uint32_t size = dir_size(path);
+    encode_dir(reserve(size), path, size);
+    commit(size);
+    for (int i = 0; i < count; i++) {
+        size = entry_size(&entries[i]);
+        encode_entry(reserve(size), &entries[i], size);
+        commit(size);
+    }
+    publish();
+}
+
+void ring_encode_listing(FILE *out, const char *path, const FileEntry *entries, int count) {
+    // Large enough for any record: fixed part plus a PATH_MAX name.
+    unsigned char buf[sizeof(RingEntry) + PATH_MAX + RING_ALIGN];
+    uint32_t size = dir_size(path);
+    encode_dir(buf, path, size);
+    fwrite(buf, 1, size, out);
+    for (int i = 0; i < count; i++) {
+        size = entry_size(&entries[i]);
+        encode_entry(buf, &entries[i], size);
+        fwrite(buf, 1, size, out);
+    }
+}
+
+void ring_put(const char *buf, size_t len) {
+    size_t off = 0;
+    while (off + sizeof(RingRecord) <= len) {
+        RingRecord rec;
+        memcpy(&rec, buf + off, sizeof(rec));
+        memcpy(reserve(rec.length), buf + off, rec.length);
+        commit(rec.length);
+        off += rec.length;
+    }
+    publish();
+}
+
+void ring_close(void) {
+    if (!ring.active) return;
+    publish();
+    atomic_store_explicit(&ring.hdr->closed, 1, memory_order_release);
+    munmap(ring.hdr, ring.map_len);
+    close(ring.fd);
+    ring.active = false;
+}
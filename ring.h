@@ -0,0 +1,37 @@
+#ifndef RING_H
+#define RING_H
+
+/*
+ * ring.h - Binary entry records in a shared-memory ring for --ring
+ * ----------------------------------------------------------------
+ * With --ring=fd:N (a memfd or shm descriptor inherited from the consumer)
+ * or --ring=shm:/NAME (created by gls, sized by --ring-size) listings are
+ * written as fixed-layout records (ringproto.h) instead of text, for a
+ * consumer on the same machine to read in place.  Plain and -R listings and
+ * file operands go to the ring; the order is the text order.  If the ring
+ * fills and its consumer has gone, or none attaches within 10 seconds, gls
+ * exits with an error.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "gls.h"
+
+// Map and initialise the ring.  Returns non-zero (after printing why) if it
+// cannot be set up.  Does nothing without --ring.
+int ring_open(const Options *opts);
+bool ring_active(void);
+
+// Write a directory record and its entries straight into the ring.
+void ring_put_listing(const char *path, const FileEntry *entries, int count);
+
+// Encode the same records into `out` (a worker's buffer), to be handed to
+// ring_put() later, in order.
+void ring_encode_listing(FILE *out, const char *path, const FileEntry *entries, int count);
+// Copy whole encoded records into the ring.
+void ring_put(const char *buf, size_t len);
+
+// Publish what is left, mark the ring closed and unmap it.
+void ring_close(void);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef RINGPROTO_H
+#define RINGPROTO_H
+
+/*
+ * ringproto.h - Shared-memory ring format for --ring
+ * --------------------------------------------------
+ * Shared by gls (the producer) and any consumer, such as glsring.c.  The
+ * segment is a RingHeader followed by `capacity` bytes of data, used as a
+ * single-producer/single-consumer ring:
+ *
+ *   - `head` and `tail` count bytes ever written and consumed; the live
+ *     records are [tail, head) taken modulo capacity.  The producer stores
+ *     head with release order after writing a record; the consumer loads it
+ *     with acquire order, reads the records in place, then stores tail with
+ *     release order to give the space back.
+ *   - Records are 8-byte aligned and never wrap.  When one does not fit
+ *     before the end of the data area the producer fills the rest with a
+ *     RING_PAD record and starts again at offset 0.
+ *   - `magic` is written last, once the header is valid; `closed` is set
+ *     when the producer is done.  Whoever waits (producer on a full ring,
+ *     consumer on an empty one) polls with a short back-off.
+ *   - A consumer stores its pid in `consumer_pid`, then sets `consumer` to
+ *     RING_ATTACHED, and to RING_DETACHED when it stops reading.  A producer
+ *     waiting on a full ring gives up if the consumer detaches or its pid is
+ *     gone, or if none attaches in time.
+ *
+ * All integers are native-endian: the ring never leaves the machine.
+ */
+
+#include <stdint.h>
+#include <stdatomic.h>
+
+#define RING_MAGIC      0x676c7372u     // "glsr"
+#define RING_VERSION    2
+#define RING_ALIGN      8
+#define RING_CACHELINE  64
+
+typedef struct {
+    _Atomic uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;              // bytes of data after the header
+    uint32_t header_size;           // offset of the data area
+    _Alignas(RING_CACHELINE) _Atomic uint64_t head;
+    _Alignas(RING_CACHELINE) _Atomic uint64_t tail;
+    _Alignas(RING_CACHELINE) _Atomic uint32_t closed;
+    _Atomic uint32_t consumer;      // RING_NO_CONSUMER, RING_ATTACHED, RING_DETACHED
+    _Atomic int32_t consumer_pid;
+} RingHeader;
+
+enum {
+    RING_NO_CONSUMER = 0,
+    RING_ATTACHED = 1,
+    RING_DETACHED = 2,
+};
+
+enum {
+    RING_PAD = 0,                   // skip to the start of the data area
+    RING_DIR = 1,                   // the entries that follow belong to `name`
+    RING_ENTRY = 2,
+};
+
+// Every record starts with this; `length` includes it and the padding.
+typedef struct {
+    uint32_t length;
+    uint16_t type;
+    uint16_t name_len;              // bytes of name, which follows the record
+} RingRecord;
+
+// RING_DIR is a RingRecord plus the path ("" for file operands).
+// RING_ENTRY is this, followed by the leaf name and a NUL.
+typedef struct {
+    RingRecord rec;
+    uint32_t mode;
+    uint32_t nlink;
+    uint32_t uid;
+    uint32_t gid;
+    uint64_t ino;
+    uint64_t dev;
+    int64_t size;
+    int64_t blocks;                 // 512-byte units
+    int64_t time_sec;               // the --time field
+    int32_t time_nsec;              // -1 when unknown (birth time)
+    int8_t xattr;                   // --xattrs indicator, 0 when off
+    int8_t pad[3];
+    int64_t child_count;            // --dir-counts, -1 when off/not a dir
+} RingEntry;
+
+static inline uint32_t ring_record_size(uint32_t fixed, uint32_t name_len) {
+    return (fixed + name_len + 1 + RING_ALIGN - 1) & ~(uint32_t)(RING_ALIGN - 1);
+}
+
+#endif
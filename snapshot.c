@@ -0,0 +1,856 @@
+/*
+ * snapshot.c - Saved tree scans for --incremental and --query
+ * -----------------------------------------------------------
+ * File layout (native byte order, every section 8-byte aligned):
+ *
+ *   SnapHeader   magic, endian marker, flags, counts and section offsets
+ *   entries      SnapEntry[entry_count]; each directory's entries are
+ *                contiguous and sorted by name (byte order)
+ *   names        pool of leaf names and symlink targets, not NUL terminated
+ *   dirs         SnapDir[dir_count] in depth-first order; each stores its
+ *                parent's id and its leaf name (walk roots have no parent
+ *                and store the path they were walked as)
+ *   index        dir ids sorted by full path (byte order)
+ *
+ * Full paths are never stored: a directory's path is rebuilt from its parent
+ * chain when needed.  A lookup binary-searches the index and then the
+ * directory's entries on the mapped file, so it touches a handful of pages
+ * however large the snapshot is.  Everything read from the file is bounds
+ * checked, so a damaged snapshot is rejected rather than trusted.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "gls.h"
+#include "display.h"
+#include "snapshot.h"
+#include "backend.h"
+#include "numa.h"
+#include "timefmt.h"
+
+#define SNAP_MAGIC      "GLSSNAP2"
+#define SNAP_ENDIAN     0x01020304u
+#define SNAP_FLAG_ALL   0x1u
+#define SNAP_NONE       UINT64_MAX
+#define SNAP_MAX_DEPTH  (PATH_MAX / 2)
+
+typedef struct {
+    char magic[8];
+    uint32_t endian;
+    uint32_t flags;
+    uint64_t dir_count;
+    uint64_t entry_count;
+    uint64_t off_entries;
+    uint64_t off_names;
+    uint64_t names_size;
+    uint64_t off_dirs;
+    uint64_t off_index;
+} SnapHeader;
+
+typedef struct {
+    uint64_t parent;        // dir id, or SNAP_NONE for a walk root
+    uint64_t name_off;      // into the name pool
+    uint64_t first_entry;
+    uint32_t name_len;
+    uint32_t entry_count;
+    SnapStat st;
+} SnapDir;
+
+typedef struct {
+    uint64_t name_off;
+    uint64_t target_off;    // symlink target, valid if target_len > 0
+    uint32_t name_len;
+    uint32_t target_len;
+    SnapStat st;
+} SnapEntry;
+
+struct Snapshot {
+    void *map;
+    size_t size;
+    const SnapHeader *hdr;
+    const SnapEntry *entries;
+    const char *names;
+    const SnapDir *dirs;
+    const uint64_t *index;
+};
+
+// ========================================
+// Stat Conversion
+// ========================================
+
+void snapstat_from(SnapStat *ss, const struct stat *st) {
+    ss->mode = st->st_mode;
+    ss->nlink = (int64_t)st->st_nlink;
+    ss->uid = st->st_uid;
+    ss->gid = st->st_gid;
+    ss->size = st->st_size;
+    ss->blocks = st->st_blocks;
+    ss->ino = (int64_t)st->st_ino;
+    ss->dev = (int64_t)st->st_dev;
+    ss->rdev = (int64_t)st->st_rdev;
+    ss->atime = ST_ATIM(st).tv_sec;
+    ss->atime_ns = ST_ATIM(st).tv_nsec;
+    ss->mtime = ST_MTIM(st).tv_sec;
+    ss->mtime_ns = ST_MTIM(st).tv_nsec;
+    ss->ctime = ST_CTIM(st).tv_sec;
+    ss->ctime_ns = ST_CTIM(st).tv_nsec;
+}
+
+void snapstat_to(struct stat *st, const SnapStat *ss) {
+    memset(st, 0, sizeof(*st));
+    st->st_mode = (mode_t)ss->mode;
+    st->st_nlink = (nlink_t)ss->nlink;
+    st->st_uid = (uid_t)ss->uid;
+    st->st_gid = (gid_t)ss->gid;
+    st->st_size = (off_t)ss->size;
+    st->st_blocks = (blkcnt_t)ss->blocks;
+    st->st_ino = (ino_t)ss->ino;
+    st->st_dev = (dev_t)ss->dev;
+    st->st_rdev = (dev_t)ss->rdev;
+    ST_ATIM(st).tv_sec = (time_t)ss->atime;
+    ST_ATIM(st).tv_nsec = (long)ss->atime_ns;
+    ST_MTIM(st).tv_sec = (time_t)ss->mtime;
+    ST_MTIM(st).tv_nsec = (long)ss->mtime_ns;
+    ST_CTIM(st).tv_sec = (time_t)ss->ctime;
+    ST_CTIM(st).tv_nsec = (long)ss->ctime_ns;
+}
+
+// ========================================
+// Reading
+// ========================================
+
+static bool section_fits(uint64_t off, uint64_t count, uint64_t item, size_t size) {
+    if (off % 8 != 0 || off > size) return false;
+    return count <= (size - off) / item;
+}
+
+// A slice of the name pool, or NULL if it lies outside it.
+static const char *pool_at(const Snapshot *s, uint64_t off, uint32_t len) {
+    if (off > s->hdr->names_size || len > s->hdr->names_size - off) return NULL;
+    return s->names + off;
+}
+
+// Rebuild a directory's full path.  False if it does not fit or the parent
+// chain is damaged.
+static bool dir_path(const Snapshot *s, uint64_t id, char *buf, size_t len) {
+    uint64_t chain[SNAP_MAX_DEPTH];
+    int depth = 0;
+
+    while (id != SNAP_NONE) {
+        if (id >= s->hdr->dir_count || depth == SNAP_MAX_DEPTH) return false;
+        chain[depth++] = id;
+        id = s->dirs[id].parent;
+    }
+
+    size_t used = 0;
+    for (int i = depth - 1; i >= 0; i--) {
+        const SnapDir *d = &s->dirs[chain[i]];
+        const char *name = pool_at(s, d->name_off, d->name_len);
+        if (!name) return false;
+        bool slash = i != depth - 1 && used > 0 && buf[used - 1] != '/';
+        if (used + slash + d->name_len + 1 > len) return false;
+        if (slash) buf[used++] = '/';
+        memcpy(buf + used, name, d->name_len);
+        used += d->name_len;
+    }
+    buf[used] = '\0';
+    return true;
+}
+
+// First index position whose path is >= `path`.
+static uint64_t index_lower_bound(const Snapshot *s, const char *path) {
+    uint64_t lo = 0, hi = s->hdr->dir_count;
+    char buf[PATH_MAX];
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (!dir_path(s, s->index[mid], buf, sizeof(buf)) || strcmp(buf, path) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static uint64_t find_dir(const Snapshot *s, const char *path) {
+    char buf[PATH_MAX];
+    uint64_t pos = index_lower_bound(s, path);
+    if (pos < s->hdr->dir_count && dir_path(s, s->index[pos], buf, sizeof(buf)) &&
+        strcmp(buf, path) == 0)
+        return s->index[pos];
+    return SNAP_NONE;
+}
+
+static int compare_name(const Snapshot *s, const SnapEntry *e, const char *name, size_t len) {
+    const char *en = pool_at(s, e->name_off, e->name_len);
+    if (!en) return -1;
+    size_t n = e->name_len < len ? e->name_len : len;
+    int c = memcmp(en, name, n);
+    if (c != 0) return c;
+    return e->name_len < len ? -1 : e->name_len > len ? 1 : 0;
+}
+
+// First entry of `dir` whose name is >= `name` (as an index into entries).
+static uint64_t entry_lower_bound(const Snapshot *s, const SnapDir *dir, const char *name, size_t len) {
+    uint64_t lo = dir->first_entry, hi = dir->first_entry + dir->entry_count;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (compare_name(s, &s->entries[mid], name, len) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+Snapshot *snapshot_open(const char *file, const Options *opts) {
+    int fd = open(file, O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT || !opts) perror(file);
+        return NULL;
+    }
+
+    struct stat st;
+    Snapshot *snap = xcalloc(1, sizeof(Snapshot));
+    if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(SnapHeader)) {
+        snap->size = (size_t)st.st_size;
+        snap->map = mmap(NULL, snap->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (snap->map == MAP_FAILED) snap->map = NULL;
+    }
+    close(fd);
+
+    const SnapHeader *h = snap->map;
+    bool ok = h && memcmp(h->magic, SNAP_MAGIC, sizeof(h->magic)) == 0 &&
+              h->endian == SNAP_ENDIAN &&
+              section_fits(h->off_entries, h->entry_count, sizeof(SnapEntry), snap->size) &&
+              section_fits(h->off_names, h->names_size, 1, snap->size) &&
+              section_fits(h->off_dirs, h->dir_count, sizeof(SnapDir), snap->size) &&
+              section_fits(h->off_index, h->dir_count, sizeof(uint64_t), snap->size);
+    if (!ok) {
+        fprintf(stderr, "Warning: %s is not a usable snapshot%s.\n", file,
+                opts ? "; doing a full scan" : "");
+        snapshot_close(snap);
+        return NULL;
+    }
+    if (opts && ((h->flags & SNAP_FLAG_ALL) != 0) != opts->show_all) {
+        fprintf(stderr, "Warning: %s was saved %s -a; doing a full scan.\n",
+                file, opts->show_all ? "without" : "with");
+        snapshot_close(snap);
+        return NULL;
+    }
+
+    const char *base = snap->map;
+    snap->hdr = h;
+    snap->entries = (const SnapEntry *)(base + h->off_entries);
+    snap->names = base + h->off_names;
+    snap->dirs = (const SnapDir *)(base + h->off_dirs);
+    snap->index = (const uint64_t *)(base + h->off_index);
+    return snap;
+}
+
+void snapshot_close(Snapshot *snap) {
+    if (!snap) return;
+    if (snap->map) munmap(snap->map, snap->size);
+    free(snap);
+}
+
+static bool dir_entries_fit(const Snapshot *s, const SnapDir *d) {
+    return d->first_entry <= s->hdr->entry_count &&
+           d->entry_count <= s->hdr->entry_count - d->first_entry;
+}
+
+bool snapshot_reuse(const Snapshot *snap, const char *path,
+                    const struct stat *dir_st, DirListing *list) {
+    if (!snap) return false;
+
+    uint64_t id = find_dir(snap, path);
+    if (id == SNAP_NONE) return false;
+    const SnapDir *d = &snap->dirs[id];
+    if (!dir_entries_fit(snap, d) ||
+        d->st.mtime != ST_MTIM(dir_st).tv_sec || d->st.mtime_ns != ST_MTIM(dir_st).tv_nsec ||
+        d->st.ctime != ST_CTIM(dir_st).tv_sec || d->st.ctime_ns != ST_CTIM(dir_st).tv_nsec ||
+        d->st.ino != (int64_t)dir_st->st_ino)
+        return false;
+
+    memset(list, 0, sizeof(*list));
+    list->capacity = d->entry_count > 0 ? (int)d->entry_count : 1;
+    list->entries = arena_alloc((size_t)list->capacity * sizeof(FileEntry));
+    for (uint64_t i = d->first_entry; i < d->first_entry + d->entry_count; i++) {
+        const SnapEntry *e = &snap->entries[i];
+        const char *name = pool_at(snap, e->name_off, e->name_len);
+        if (!name) {
+            free_listing(list);
+            return false;
+        }
+        FileEntry *fe = &list->entries[list->count++];
+        fe->name = xmalloc(e->name_len + 1);
+        memcpy(fe->name, name, e->name_len);
+        fe->name[e->name_len] = '\0';
+        snapstat_to(&fe->st, &e->st);
+        list->total_blocks += fe->st.st_blocks;
+    }
+    return true;
+}
+
+// ========================================
+// Writing
+// ========================================
+
+struct SnapshotWriter {
+    FILE *fp;               // header placeholder, then entries as they arrive
+    FILE *names;            // name pool, spooled until close
+    uint64_t names_size;
+    char *path;
+    char *tmp_path;
+    SnapDir *dirs;
+    char **dir_paths;       // kept for the path-sorted index
+    uint64_t dir_count;
+    uint64_t dir_capacity;
+    uint64_t entry_count;
+    uint64_t *stack;        // ids from the current root down to the last dir
+    size_t stack_len;
+    size_t stack_capacity;
+    bool failed;
+};
+
+// A parsed entry of an encoded directory record.
+typedef struct {
+    const char *name;
+    uint32_t name_len;
+    const char *target;
+    uint32_t target_len;
+    SnapStat st;
+} RecordEntry;
+
+typedef struct {
+    const char *data;
+    size_t size;
+    size_t pos;
+} Cursor;
+
+static bool take(Cursor *c, void *dest, size_t len) {
+    if (c->size - c->pos < len) return false;
+    if (dest) memcpy(dest, c->data + c->pos, len);
+    c->pos += len;
+    return true;
+}
+
+static const char *take_bytes(Cursor *c, uint32_t *len) {
+    if (!take(c, len, sizeof(*len))) return NULL;
+    const char *p = c->data + c->pos;
+    return take(c, NULL, *len) ? p : NULL;
+}
+
+char *snapshot_encode_dir(const char *path, const struct stat *dir_st,
+                          const DirListing *list, size_t *len) {
+    char *buf = NULL;
+    FILE *out = open_memstream(&buf, len);
+    if (!out) {
+        fprintf(stderr, "Fatal: Out of memory (open_memstream).\n");
+        exit(EXIT_FAILURE);
+    }
+
+    SnapStat ss;
+    uint32_t n = (uint32_t)strlen(path);
+    fwrite(&n, sizeof(n), 1, out);
+    fwrite(path, 1, n, out);
+    snapstat_from(&ss, dir_st);
+    fwrite(&ss, sizeof(ss), 1, out);
+    n = (uint32_t)list->count;
+    fwrite(&n, sizeof(n), 1, out);
+    for (int i = 0; i < list->count; i++) {
+        const FileEntry *fe = &list->entries[i];
+        char target[PATH_MAX];
+        uint32_t tlen = 0;
+
+        n = (uint32_t)strlen(fe->name);
+        fwrite(&n, sizeof(n), 1, out);
+        fwrite(fe->name, 1, n, out);
+        snapstat_from(&ss, &fe->st);
+        fwrite(&ss, sizeof(ss), 1, out);
+        if (S_ISLNK(fe->st.st_mode)) {
+            char fullpath[PATH_MAX];
+            join_path(fullpath, sizeof(fullpath), path, fe->name);
+            ssize_t r = backend_readlink(fullpath, target, sizeof(target));
+            if (r > 0) tlen = (uint32_t)r;
+        }
+        fwrite(&tlen, sizeof(tlen), 1, out);
+        fwrite(target, 1, tlen, out);
+    }
+    fclose(out);
+    return buf;
+}
+
+SnapshotWriter *snapshot_writer_open(const char *file, const Options *opts) {
+    SnapshotWriter *w = xcalloc(1, sizeof(SnapshotWriter));
+    size_t len = strlen(file) + 5;
+    w->path = xstrdup(file);
+    w->tmp_path = xmalloc(len);
+    snprintf(w->tmp_path, len, "%s.tmp", file);
+
+    w->fp = fopen(w->tmp_path, "w+b");
+    w->names = tmpfile();
+    if (!w->fp || !w->names) {
+        perror(w->fp ? "tmpfile" : w->tmp_path);
+        if (w->fp) {
+            fclose(w->fp);
+            remove(w->tmp_path);
+        }
+        if (w->names) fclose(w->names);
+        free(w->tmp_path);
+        free(w->path);
+        free(w);
+        return NULL;
+    }
+    SnapHeader hdr = { .endian = SNAP_ENDIAN, .flags = opts->show_all ? SNAP_FLAG_ALL : 0 };
+    if (fwrite(&hdr, sizeof(hdr), 1, w->fp) != 1) w->failed = true;
+    return w;
+}
+
+void snapshot_writer_begin_root(SnapshotWriter *w) {
+    if (w) w->stack_len = 0;
+}
+
+static uint64_t add_name(SnapshotWriter *w, const char *name, uint32_t len) {
+    uint64_t off = w->names_size;
+    if (len > 0 && fwrite(name, 1, len, w->names) != len) w->failed = true;
+    w->names_size += len;
+    return off;
+}
+
+// If `path` is a direct child of `parent`, return its leaf name.
+static const char *child_leaf(const char *parent, const char *path) {
+    size_t plen = strlen(parent);
+    if (strncmp(path, parent, plen) != 0) return NULL;
+    const char *leaf = path + plen;
+    if (plen == 0 || parent[plen - 1] != '/') {
+        if (*leaf != '/') return NULL;
+        leaf++;
+    }
+    return (*leaf && !strchr(leaf, '/')) ? leaf : NULL;
+}
+
+static int compare_record_entries(const void *a, const void *b) {
+    const RecordEntry *ea = a, *eb = b;
+    uint32_t n = ea->name_len < eb->name_len ? ea->name_len : eb->name_len;
+    int c = memcmp(ea->name, eb->name, n);
+    if (c != 0) return c;
+    return (ea->name_len > eb->name_len) - (ea->name_len < eb->name_len);
+}
+
+void snapshot_writer_add(SnapshotWriter *w, const char *record, size_t len) {
+    if (!w || w->failed) return;
+
+    Cursor c = { record, len, 0 };
+    uint32_t path_len, count;
+    SnapStat dir_st;
+    const char *path_bytes = take_bytes(&c, &path_len);
+    if (!path_bytes || !take(&c, &dir_st, sizeof(dir_st)) || !take(&c, &count, sizeof(count))) {
+        w->failed = true;
+        return;
+    }
+    char *path = xmalloc(path_len + 1);
+    memcpy(path, path_bytes, path_len);
+    path[path_len] = '\0';
+
+    RecordEntry *ents = xcalloc(count > 0 ? count : 1, sizeof(RecordEntry));
+    for (uint32_t i = 0; i < count; i++) {
+        ents[i].name = take_bytes(&c, &ents[i].name_len);
+        if (!ents[i].name || !take(&c, &ents[i].st, sizeof(SnapStat)) ||
+            !(ents[i].target = take_bytes(&c, &ents[i].target_len))) {
+            w->failed = true;
+            free(ents);
+            free(path);
+            return;
+        }
+    }
+    qsort(ents, count, sizeof(RecordEntry), compare_record_entries);
+
+    // Pop back up to this directory's parent; nothing left means a root.
+    const char *leaf = NULL;
+    while (w->stack_len > 0 &&
+           !(leaf = child_leaf(w->dir_paths[w->stack[w->stack_len - 1]], path)))
+        w->stack_len--;
+
+    if (w->dir_count >= w->dir_capacity) {
+        w->dir_capacity = w->dir_capacity ? w->dir_capacity * 2 : 256;
+        w->dirs = xrealloc(w->dirs, w->dir_capacity * sizeof(SnapDir));
+        w->dir_paths = xrealloc(w->dir_paths, w->dir_capacity * sizeof(char *));
+    }
+    SnapDir *d = &w->dirs[w->dir_count];
+    memset(d, 0, sizeof(*d));
+    d->parent = w->stack_len > 0 ? w->stack[w->stack_len - 1] : SNAP_NONE;
+    if (!leaf) leaf = path;
+    d->name_len = (uint32_t)strlen(leaf);
+    d->name_off = add_name(w, leaf, d->name_len);
+    d->first_entry = w->entry_count;
+    d->entry_count = count;
+    d->st = dir_st;
+    w->dir_paths[w->dir_count] = path;
+
+    for (uint32_t i = 0; i < count; i++) {
+        SnapEntry e = {0};
+        e.name_len = ents[i].name_len;
+        e.name_off = add_name(w, ents[i].name, ents[i].name_len);
+        e.target_len = ents[i].target_len;
+        e.target_off = add_name(w, ents[i].target, ents[i].target_len);
+        e.st = ents[i].st;
+        if (fwrite(&e, sizeof(e), 1, w->fp) != 1) w->failed = true;
+    }
+    w->entry_count += count;
+    free(ents);
+
+    if (w->stack_len >= w->stack_capacity) {
+        w->stack_capacity = w->stack_capacity ? w->stack_capacity * 2 : 64;
+        w->stack = xrealloc(w->stack, w->stack_capacity * sizeof(uint64_t));
+    }
+    w->stack[w->stack_len++] = w->dir_count++;
+}
+
+static uint64_t pad_to_8(SnapshotWriter *w) {
+    static const char zeros[8] = {0};
+    long pos = ftell(w->fp);
+    if (pos < 0) {
+        w->failed = true;
+        return 0;
+    }
+    size_t pad = (8 - (size_t)pos % 8) % 8;
+    if (pad && fwrite(zeros, 1, pad, w->fp) != pad) w->failed = true;
+    return (uint64_t)pos + pad;
+}
+
+typedef struct {
+    const char *path;
+    uint64_t id;
+} IndexItem;
+
+static int compare_index_items(const void *a, const void *b) {
+    return strcmp(((const IndexItem *)a)->path, ((const IndexItem *)b)->path);
+}
+
+int snapshot_writer_close(SnapshotWriter *w) {
+    if (!w) return 1;
+
+    SnapHeader hdr = { .endian = SNAP_ENDIAN };
+    if (fseek(w->fp, 0, SEEK_SET) != 0 || fread(&hdr, sizeof(hdr), 1, w->fp) != 1 ||
+        fseek(w->fp, 0, SEEK_END) != 0)
+        w->failed = true;
+    memcpy(hdr.magic, SNAP_MAGIC, sizeof(hdr.magic));
+    hdr.dir_count = w->dir_count;
+    hdr.entry_count = w->entry_count;
+    hdr.off_entries = sizeof(SnapHeader);
+
+    // Name pool
+    hdr.off_names = pad_to_8(w);
+    hdr.names_size = w->names_size;
+    char buf[65536];
+    size_t n;
+    rewind(w->names);
+    while ((n = fread(buf, 1, sizeof(buf), w->names)) > 0) {
+        if (fwrite(buf, 1, n, w->fp) != n) w->failed = true;
+    }
+    fclose(w->names);
+
+    // Directory table and the path-sorted index
+    hdr.off_dirs = pad_to_8(w);
+    if (w->dir_count && fwrite(w->dirs, sizeof(SnapDir), w->dir_count, w->fp) != w->dir_count)
+        w->failed = true;
+    hdr.off_index = pad_to_8(w);
+    IndexItem *items = xcalloc(w->dir_count ? w->dir_count : 1, sizeof(IndexItem));
+    for (uint64_t i = 0; i < w->dir_count; i++) items[i] = (IndexItem){ w->dir_paths[i], i };
+    qsort(items, w->dir_count, sizeof(IndexItem), compare_index_items);
+    for (uint64_t i = 0; i < w->dir_count; i++) {
+        if (fwrite(&items[i].id, sizeof(uint64_t), 1, w->fp) != 1) w->failed = true;
+    }
+    free(items);
+
+    if (fseek(w->fp, 0, SEEK_SET) != 0 || fwrite(&hdr, sizeof(hdr), 1, w->fp) != 1)
+        w->failed = true;
+
+    int result = 0;
+    if (fclose(w->fp) != 0) w->failed = true;
+    if (w->failed || rename(w->tmp_path, w->path) != 0) {
+        fprintf(stderr, "Error: unable to write snapshot %s\n", w->path);
+        remove(w->tmp_path);
+        result = 1;
+    }
+    for (uint64_t i = 0; i < w->dir_count; i++) free(w->dir_paths[i]);
+    free(w->dir_paths);
+    free(w->dirs);
+    free(w->stack);
+    free(w->tmp_path);
+    free(w->path);
+    free(w);
+    return result;
+}
+
+// ========================================
+// Queries
+// ========================================
+
+// Recorded entries have no live file behind them: no xattrs, no birth time.
+static void print_recorded(const char *display, const struct stat *st, const char *target) {
+    char name[PATH_MAX];
+    snprintf(name, sizeof(name), "%s", display);
+    FileEntry fe = { .name = name, .st = *st, .child_count = -1 };
+    fe.time = timefmt_entry_time(NULL, st);
+    print_entry_line(stdout, &fe, target);
+}
+
+static void print_snap_entry(const Snapshot *s, const SnapEntry *e, const char *display) {
+    struct stat st;
+    char target[PATH_MAX];
+    const char *tp = NULL;
+
+    snapstat_to(&st, &e->st);
+    if (e->target_len > 0 && e->target_len < sizeof(target)) {
+        const char *t = pool_at(s, e->target_off, e->target_len);
+        if (t) {
+            memcpy(target, t, e->target_len);
+            target[e->target_len] = '\0';
+            tp = target;
+        }
+    }
+    print_recorded(display, &st, tp);
+}
+
+// Print the entries of `dir` whose names start with `leaf`, under a header.
+static int print_dir_matches(const Snapshot *s, uint64_t id, const char *leaf, bool *first) {
+    const SnapDir *d = &s->dirs[id];
+    char path[PATH_MAX];
+    size_t leaf_len = strlen(leaf);
+    int shown = 0;
+
+    if (!dir_entries_fit(s, d) || !dir_path(s, id, path, sizeof(path))) return 0;
+    uint64_t end = d->first_entry + d->entry_count;
+    for (uint64_t i = entry_lower_bound(s, d, leaf, leaf_len); i < end; i++) {
+        const SnapEntry *e = &s->entries[i];
+        const char *name = pool_at(s, e->name_off, e->name_len);
+        char display[PATH_MAX];
+        if (!name || e->name_len < leaf_len || memcmp(name, leaf, leaf_len) != 0) break;
+        if (shown++ == 0) {
+            printf("%s%s:\n", *first ? "" : "\n", path);
+            *first = false;
+        }
+        snprintf(display, sizeof(display), "%.*s", (int)e->name_len, name);
+        print_snap_entry(s, e, display);
+    }
+    return shown;
+}
+
+static int query_prefix(const Snapshot *s, const char *prefix) {
+    size_t plen = strlen(prefix);
+    bool first = true;
+    int shown = 0;
+
+    // Entries of the prefix's parent whose names start with the last part.
+    const char *slash = strrchr(prefix, '/');
+    if (slash) {
+        char parent[PATH_MAX];
+        size_t n = slash == prefix ? 1 : (size_t)(slash - prefix);
+        snprintf(parent, sizeof(parent), "%.*s", (int)n, prefix);
+        uint64_t id = find_dir(s, parent);
+        if (id != SNAP_NONE) shown += print_dir_matches(s, id, slash + 1, &first);
+    }
+
+    // Every directory whose own path starts with the prefix.
+    char path[PATH_MAX];
+    for (uint64_t pos = index_lower_bound(s, prefix); pos < s->hdr->dir_count; pos++) {
+        if (!dir_path(s, s->index[pos], path, sizeof(path)) || strncmp(path, prefix, plen) != 0)
+            break;
+        shown += print_dir_matches(s, s->index[pos], "", &first);
+    }
+    return shown;
+}
+
+// Find a recorded path: an entry of its parent directory, or else a walk
+// root (roots are only recorded as directories).  Sets exactly one of the two.
+static bool find_path(const Snapshot *s, const char *path, const SnapEntry **entry,
+                      const SnapDir **root) {
+    const char *slash = strrchr(path, '/');
+
+    *entry = NULL;
+    *root = NULL;
+    if (slash && slash[1] != '\0') {
+        char parent[PATH_MAX];
+        size_t n = slash == path ? 1 : (size_t)(slash - path);
+        snprintf(parent, sizeof(parent), "%.*s", (int)n, path);
+        uint64_t id = find_dir(s, parent);
+        if (id != SNAP_NONE && dir_entries_fit(s, &s->dirs[id])) {
+            const SnapDir *d = &s->dirs[id];
+            size_t len = strlen(slash + 1);
+            uint64_t i = entry_lower_bound(s, d, slash + 1, len);
+            if (i < d->first_entry + d->entry_count &&
+                compare_name(s, &s->entries[i], slash + 1, len) == 0) {
+                *entry = &s->entries[i];
+                return true;
+            }
+        }
+    }
+
+    uint64_t id = find_dir(s, path);
+    if (id == SNAP_NONE) return false;
+    *root = &s->dirs[id];
+    return true;
+}
+
+static bool query_exact(const Snapshot *s, const char *path) {
+    const SnapEntry *entry;
+    const SnapDir *root;
+
+    if (!find_path(s, path, &entry, &root)) return false;
+    if (entry) {
+        print_snap_entry(s, entry, path);
+    } else {
+        struct stat st;
+        snapstat_to(&st, &root->st);
+        print_recorded(path, &st, NULL);
+    }
+    return true;
+}
+
+int snapshot_query(const char *file, char **paths, int path_count) {
+    Snapshot *s = snapshot_open(file, NULL);
+    int result = 0;
+
+    if (!s) return 1;
+    for (int i = 0; i < path_count; i++) {
+        char path[PATH_MAX];
+        snprintf(path, sizeof(path), "%s", paths[i]);
+        size_t len = strlen(path);
+
+        if (len > 0 && path[len - 1] == '*') {
+            path[len - 1] = '\0';
+            if (i > 0) printf("\n");
+            if (query_prefix(s, path) == 0) {
+                fprintf(stderr, "%s: no entries in snapshot\n", paths[i]);
+                result = 1;
+            }
+            continue;
+        }
+        while (len > 1 && path[len - 1] == '/') path[--len] = '\0';
+        if (!query_exact(s, path)) {
+            fprintf(stderr, "%s: not in snapshot\n", paths[i]);
+            result = 1;
+        }
+    }
+    snapshot_close(s);
+    return result;
+}
+
+// ========================================
+// Listing Source
+// ========================================
+
+// --source=snapshot:FILE lists a saved scan.  Directories are found through
+// the index, and a stat batch binary-searches the one directory's entries.
+
+static BackendDir *snap_open_dir(Backend *b, const char *path) {
+    const Snapshot *s = b->state;
+    uint64_t id = find_dir(s, path);
+
+    if (id == SNAP_NONE || !dir_entries_fit(s, &s->dirs[id])) {
+        errno = ENOENT;
+        return NULL;
+    }
+    BackendDir *d = xcalloc(1, sizeof(BackendDir));
+    d->pos = s->dirs[id].first_entry;
+    d->end = d->pos + s->dirs[id].entry_count;
+    return d;
+}
+
+static int snap_next_batch(Backend *b, BackendDir *d, FileEntry *out, int max) {
+    const Snapshot *s = b->state;
+    int n = 0;
+
+    while (n < max && d->pos < d->end) {
+        const SnapEntry *e = &s->entries[d->pos++];
+        const char *name = pool_at(s, e->name_off, e->name_len);
+        if (!name) {
+            errno = EIO;
+            return n > 0 ? n : -1;
+        }
+        out[n].name = xmalloc(e->name_len + 1);
+        memcpy(out[n].name, name, e->name_len);
+        out[n].name[e->name_len] = '\0';
+        out[n].d_type = 0;
+        n++;
+    }
+    return n;
+}
+
+static void snap_close_dir(Backend *b, BackendDir *d) {
+    (void)b;
+    free(d);
+}
+
+static void snap_stat_batch(Backend *b, const char *dir, FileEntry *entries, int count, bool *ok) {
+    const Snapshot *s = b->state;
+    uint64_t id = find_dir(s, dir);
+    const SnapDir *d = id != SNAP_NONE && dir_entries_fit(s, &s->dirs[id]) ? &s->dirs[id] : NULL;
+
+    for (int i = 0; i < count; i++) {
+        ok[i] = false;
+        if (!d) continue;
+        size_t len = strlen(entries[i].name);
+        uint64_t pos = entry_lower_bound(s, d, entries[i].name, len);
+        if (pos < d->first_entry + d->entry_count &&
+            compare_name(s, &s->entries[pos], entries[i].name, len) == 0) {
+            snapstat_to(&entries[i].st, &s->entries[pos].st);
+            ok[i] = true;
+        }
+    }
+}
+
+static int snap_lstat(Backend *b, const char *path, struct stat *st) {
+    const SnapEntry *entry;
+    const SnapDir *root;
+
+    if (!find_path(b->state, path, &entry, &root)) {
+        errno = ENOENT;
+        return -1;
+    }
+    snapstat_to(st, entry ? &entry->st : &root->st);
+    return 0;
+}
+
+static ssize_t snap_readlink(Backend *b, const char *path, char *buf, size_t len) {
+    const Snapshot *s = b->state;
+    const SnapEntry *entry;
+    const SnapDir *root;
+
+    if (!find_path(s, path, &entry, &root)) {
+        errno = ENOENT;
+        return -1;
+    }
+    const char *target = entry ? pool_at(s, entry->target_off, entry->target_len) : NULL;
+    if (!target || entry->target_len == 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    size_t n = entry->target_len < len ? entry->target_len : len;
+    memcpy(buf, target, n);
+    return (ssize_t)n;
+}
+
+static void snap_destroy(Backend *b) {
+    snapshot_close(b->state);
+    free(b);
+}
+
+Backend *snapshot_backend(const char *file) {
+    Snapshot *s = snapshot_open(file, NULL);
+    if (!s) return NULL;
+
+    Backend *b = xcalloc(1, sizeof(Backend));
+    b->name = "snapshot";
+    b->state = s;
+    b->open_dir = snap_open_dir;
+    b->next_batch = snap_next_batch;
+    b->close_dir = snap_close_dir;
+    b->stat_batch = snap_stat_batch;
+    b->lstat = snap_lstat;
+    b->readlink = snap_readlink;
+    b->destroy = snap_destroy;
+    return b;
+}
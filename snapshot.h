@@ -0,0 +1,58 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+/*
+ * snapshot.h - Saved tree scans for --incremental and --query
+ * -----------------------------------------------------------
+ * A snapshot records, for every directory of a recursive scan, the
+ * directory's own metadata and the metadata of each entry.  A later scan can
+ * reuse a directory's recorded entry list when the directory's mtime and
+ * ctime show that no entry was added, removed or renamed since, and any
+ * recorded path can be looked up without reading the rest of the file.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "gls.h"
+
+// struct stat in a fixed, platform-independent layout, as stored on disk.
+typedef struct {
+    int64_t mode, nlink, uid, gid, size, blocks, ino, dev, rdev;
+    int64_t atime, atime_ns, mtime, mtime_ns, ctime, ctime_ns;
+} SnapStat;
+
+void snapstat_from(SnapStat *ss, const struct stat *st);
+void snapstat_to(struct stat *st, const SnapStat *ss);
+
+typedef struct Snapshot Snapshot;
+typedef struct SnapshotWriter SnapshotWriter;
+
+// Map a snapshot.  Returns NULL if the file does not exist or is damaged
+// (with a warning).  With `opts`, a snapshot saved with a different -a
+// setting is also rejected.
+Snapshot *snapshot_open(const char *file, const Options *opts);
+void snapshot_close(Snapshot *snap);
+
+// If `path` is recorded and its mtime/ctime still match `dir_st`, fill
+// `list` with the recorded entries (unsorted) and return true.
+bool snapshot_reuse(const Snapshot *snap, const char *path,
+                    const struct stat *dir_st, DirListing *list);
+
+// Serialise one scanned directory into a malloc'd record for
+// snapshot_writer_add().  Symlink targets are read here.
+char *snapshot_encode_dir(const char *path, const struct stat *dir_st,
+                          const DirListing *list, size_t *len);
+
+// Records must arrive in depth-first order; call begin_root before each
+// walk.  Output goes to FILE.tmp and is renamed over FILE on close.
+SnapshotWriter *snapshot_writer_open(const char *file, const Options *opts);
+void snapshot_writer_begin_root(SnapshotWriter *w);
+void snapshot_writer_add(SnapshotWriter *w, const char *record, size_t len);
+int snapshot_writer_close(SnapshotWriter *w);
+
+// --query: print the recorded entry for PATH, or every recorded entry under
+// a PATH ending in '*'.
+int snapshot_query(const char *file, char **paths, int path_count);
+
+#endif
@@ -0,0 +1,361 @@
+/*
+ * timefmt.c - Timestamp selection (--time) and formatting (--time-style)
+ * ----------------------------------------------------------------------
+ * A format is compiled into segments: runs of date-level conversions and
+ * literal text (handed to strftime() as one piece), and integer fields for
+ * the time of day.  Each thread caches the rendered date pieces together
+ * with the local day they belong to; any timestamp inside that day only
+ * needs its seconds-since-midnight split into fields.
+ *
+ * A day containing a DST change is never cached, since seconds since
+ * midnight no longer map to the wall clock there.  Formats that use
+ * conversions depending on the time of day in locale-specific ways (%p, %r,
+ * %c, %X, E/O modifiers...) fall back to strftime() per entry.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "gls.h"
+#include "backend.h"
+#include "timefmt.h"
+
+#define MAX_SEGS        32
+#define SEG_FMT_MAX     64
+#define DAY_TEXT_MAX    128
+#define RECENT_SECS     15778800    // six months, as ls uses
+
+enum { SEG_DAY, SEG_HOUR, SEG_HOUR_SPACE, SEG_MIN, SEG_SEC, SEG_NSEC, SEG_EPOCH };
+
+typedef struct {
+    int kind;
+    int width;                  // SEG_NSEC: digits shown
+    char fmt[SEG_FMT_MAX];      // SEG_DAY: strftime format
+} Segment;
+
+typedef struct {
+    Segment segs[MAX_SEGS];
+    int count;
+    bool per_entry;             // date pieces depend on more than the day
+} Program;
+
+// The rendered date pieces of one local day.
+typedef struct {
+    time_t day_start, day_end;  // empty range = nothing cached
+    char text[MAX_SEGS][DAY_TEXT_MAX];
+} DayCache;
+
+static Program programs[2];     // [0] older or future, [1] recent
+static bool two_formats = false;
+static int field = TIME_MTIME;
+static time_t now;
+static int unknown_width = 1;
+
+static _Thread_local DayCache day_cache[2];
+
+// ========================================
+// Compiling
+// ========================================
+
+static Segment *add_segment(Program *p, int kind) {
+    if (p->count >= MAX_SEGS) return NULL;
+    Segment *s = &p->segs[p->count++];
+    memset(s, 0, sizeof(*s));
+    s->kind = kind;
+    return s;
+}
+
+// Append text to the trailing date segment, starting one if needed.
+static bool add_day_text(Program *p, const char *text, size_t len) {
+    Segment *s = p->count > 0 ? &p->segs[p->count - 1] : NULL;
+    if (!s || s->kind != SEG_DAY) s = add_segment(p, SEG_DAY);
+    if (!s) return false;
+    size_t used = strlen(s->fmt);
+    if (used + len >= sizeof(s->fmt)) return false;
+    memcpy(s->fmt + used, text, len);
+    s->fmt[used + len] = '\0';
+    return true;
+}
+
+static bool add_time(Program *p, int kind, int width) {
+    Segment *s = add_segment(p, kind);
+    if (s) s->width = width;
+    return s != NULL;
+}
+
+static bool compile(const char *fmt, Program *p) {
+    // Conversions that only depend on the local day (and its UTC offset).
+    static const char day_level[] = "aAbBCdDeFgGhjmnuUVwWxyYzZt%";
+    bool ok = true;
+
+    memset(p, 0, sizeof(*p));
+    for (const char *c = fmt; *c && ok; c++) {
+        if (*c != '%') {
+            ok = add_day_text(p, c, 1);
+            continue;
+        }
+        c++;
+        int width = 9;
+        if (*c >= '1' && *c <= '9' && c[1] == 'N') width = *c++ - '0';
+
+        switch (*c) {
+            case '\0': return false;
+            case 'H': ok = add_time(p, SEG_HOUR, 0); break;
+            case 'k': ok = add_time(p, SEG_HOUR_SPACE, 0); break;
+            case 'M': ok = add_time(p, SEG_MIN, 0); break;
+            case 'S': ok = add_time(p, SEG_SEC, 0); break;
+            case 'N': ok = add_time(p, SEG_NSEC, width); break;
+            case 's': ok = add_time(p, SEG_EPOCH, 0); break;
+            case 'R':
+                ok = add_time(p, SEG_HOUR, 0) && add_day_text(p, ":", 1) &&
+                     add_time(p, SEG_MIN, 0);
+                break;
+            case 'T':
+                ok = add_time(p, SEG_HOUR, 0) && add_day_text(p, ":", 1) &&
+                     add_time(p, SEG_MIN, 0) && add_day_text(p, ":", 1) &&
+                     add_time(p, SEG_SEC, 0);
+                break;
+            default: {
+                char conv[3] = { '%', *c, '\0' };
+                if (!strchr(day_level, *c)) p->per_entry = true;
+                ok = add_day_text(p, conv, 2);
+                // Keep an E/O modifier together with its conversion.
+                if (ok && (*c == 'E' || *c == 'O') && c[1]) ok = add_day_text(p, ++c, 1);
+                break;
+            }
+        }
+    }
+    return ok;
+}
+
+// GNU ls style names and their (older, recent) formats.
+static int compile_style(const char *style) {
+    const char *old_fmt = NULL, *recent_fmt = NULL;
+
+    if (strncmp(style, "posix-", 6) == 0) style += 6;
+    if (strcmp(style, "locale") == 0) {
+        old_fmt = "%b %e  %Y";
+        recent_fmt = "%b %e %H:%M";
+    } else if (strcmp(style, "full-iso") == 0) {
+        old_fmt = "%Y-%m-%d %H:%M:%S.%N %z";
+    } else if (strcmp(style, "long-iso") == 0) {
+        old_fmt = "%Y-%m-%d %H:%M";
+    } else if (strcmp(style, "iso") == 0) {
+        old_fmt = "%Y-%m-%d ";
+        recent_fmt = "%m-%d %H:%M";
+    } else if (style[0] == '+') {
+        char buf[2 * MAX_SEGS * SEG_FMT_MAX];
+        snprintf(buf, sizeof(buf), "%s", style + 1);
+        char *nl = strchr(buf, '\n');
+        if (nl) *nl = '\0';
+        if (!compile(buf, &programs[0])) return 1;
+        two_formats = nl != NULL;
+        return two_formats && !compile(nl + 1, &programs[1]) ? 1 : 0;
+    } else {
+        return 1;
+    }
+
+    if (!compile(old_fmt, &programs[0])) return 1;
+    two_formats = recent_fmt != NULL;
+    return two_formats && !compile(recent_fmt, &programs[1]) ? 1 : 0;
+}
+
+int timefmt_parse_field(const char *word) {
+    if (strcmp(word, "mtime") == 0 || strcmp(word, "modification") == 0) return TIME_MTIME;
+    if (strcmp(word, "atime") == 0 || strcmp(word, "access") == 0 ||
+        strcmp(word, "use") == 0) return TIME_ATIME;
+    if (strcmp(word, "ctime") == 0 || strcmp(word, "status") == 0) return TIME_CTIME;
+    if (strcmp(word, "birth") == 0 || strcmp(word, "creation") == 0) return TIME_BIRTH;
+    return -1;
+}
+
+int timefmt_init(const Options *opts) {
+    const char *style = opts->time_style ? opts->time_style : getenv("TIME_STYLE");
+    if (!style || !*style) style = "locale";
+
+    field = opts->time_field;
+    now = time(NULL);
+    if (compile_style(style) != 0) {
+        fprintf(stderr, "Error: invalid time style: '%s'\n", style);
+        return 1;
+    }
+
+    // Unknown times print as "-" padded to the width of a real one.
+    char sample[DAY_TEXT_MAX];
+    timefmt_format((struct timespec){ now, 0 }, sample, sizeof(sample));
+    unknown_width = (int)strlen(sample);
+    return 0;
+}
+
+// ========================================
+// Rendering
+// ========================================
+
+typedef struct {
+    char *pos, *end;            // end leaves room for the terminator
+} Cursor;
+
+static void put_str(Cursor *c, const char *s) {
+    while (*s && c->pos < c->end) *c->pos++ = *s++;
+}
+
+// Zero-padded decimal of exactly `digits` digits.
+static void put_digits(Cursor *c, unsigned long value, int digits) {
+    if (c->end - c->pos < digits) return;
+    for (int i = digits - 1; i >= 0; i--) {
+        c->pos[i] = (char)('0' + value % 10);
+        value /= 10;
+    }
+    c->pos += digits;
+}
+
+static void put_epoch(Cursor *c, long long value) {
+    char buf[24];
+    int n = 0;
+    unsigned long long v = value < 0 ? 0ULL - (unsigned long long)value : (unsigned long long)value;
+    do {
+        buf[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    if (value < 0 && c->pos < c->end) *c->pos++ = '-';
+    while (n > 0 && c->pos < c->end) *c->pos++ = buf[--n];
+}
+
+// Render the date pieces of `tm` into the cache and, unless the day has a
+// DST change or the pieces depend on more than the day, mark the whole day
+// as covered.
+static void fill_day(const Program *p, DayCache *cache, time_t t, const struct tm *tm) {
+    for (int i = 0; i < p->count; i++) {
+        if (p->segs[i].kind == SEG_DAY &&
+            strftime(cache->text[i], DAY_TEXT_MAX, p->segs[i].fmt, tm) == 0)
+            cache->text[i][0] = '\0';
+    }
+    cache->day_start = cache->day_end = 0;
+    if (p->per_entry) return;
+
+    time_t start = t - (tm->tm_hour * 3600 + tm->tm_min * 60 + tm->tm_sec);
+    time_t last = start + 86399;
+    struct tm a, b;
+    cache->day_start = cache->day_end = start;
+    if (localtime_r(&start, &a) && localtime_r(&last, &b) &&
+        a.tm_hour == 0 && a.tm_min == 0 && a.tm_sec == 0 &&
+        b.tm_hour == 23 && b.tm_min == 59 && b.tm_sec == 59 &&
+        a.tm_isdst == tm->tm_isdst && b.tm_isdst == tm->tm_isdst)
+        cache->day_end = start + 86400;
+}
+
+void timefmt_format(struct timespec ts, char *out, size_t len) {
+    if (ts.tv_nsec < 0) {
+        snprintf(out, len, "%*s", unknown_width, "-");
+        return;
+    }
+
+    time_t t = ts.tv_sec;
+    int which = two_formats && t <= now && now - t <= RECENT_SECS ? 1 : 0;
+    const Program *p = &programs[which];
+    DayCache *cache = &day_cache[which];
+    struct tm tm;
+    long sod;                   // seconds since local midnight
+
+    if (p->per_entry || t < cache->day_start || t >= cache->day_end) {
+        if (!localtime_r(&t, &tm)) {
+            snprintf(out, len, "??? ?? ??:??");
+            return;
+        }
+        fill_day(p, cache, t, &tm);
+        sod = tm.tm_hour * 3600L + tm.tm_min * 60L + tm.tm_sec;
+    } else {
+        sod = (long)(t - cache->day_start);
+    }
+
+    Cursor c = { out, out + len - 1 };
+    for (int i = 0; i < p->count; i++) {
+        const Segment *s = &p->segs[i];
+        switch (s->kind) {
+            case SEG_DAY: put_str(&c, cache->text[i]); break;
+            case SEG_HOUR: put_digits(&c, (unsigned long)(sod / 3600), 2); break;
+            case SEG_HOUR_SPACE:
+                if (sod / 3600 < 10 && c.pos < c.end) *c.pos++ = ' ';
+                put_digits(&c, (unsigned long)(sod / 3600), sod / 3600 < 10 ? 1 : 2);
+                break;
+            case SEG_MIN: put_digits(&c, (unsigned long)(sod / 60 % 60), 2); break;
+            case SEG_SEC: put_digits(&c, (unsigned long)(sod % 60), 2); break;
+            case SEG_NSEC: {
+                unsigned long ns = (unsigned long)ts.tv_nsec;
+                for (int d = s->width; d < 9; d++) ns /= 10;
+                put_digits(&c, ns, s->width);
+                break;
+            }
+            case SEG_EPOCH: put_epoch(&c, (long long)t); break;
+        }
+    }
+    *c.pos = '\0';
+}
+
+// ========================================
+// Field Selection
+// ========================================
+
+static struct timespec stat_time(const struct stat *st) {
+    switch (field) {
+        case TIME_ATIME: return ST_ATIM(st);
+        case TIME_CTIME: return ST_CTIM(st);
+        default: return ST_MTIM(st);
+    }
+}
+
+// Birth time of `name` relative to `dfd` (AT_FDCWD for a full path).
+static struct timespec birth_time(int dfd, const char *name, const struct stat *st) {
+    struct timespec ts = { 0, -1 };
+
+    if (!backend_is_fs()) return ts;
+#ifdef __APPLE__
+    (void)dfd;
+    (void)name;
+    ts = st->st_birthtimespec;
+#elif defined(STATX_BTIME)
+    struct statx stx;
+    (void)st;
+    if (name && statx(dfd, name, AT_SYMLINK_NOFOLLOW, STATX_BTIME, &stx) == 0 &&
+        (stx.stx_mask & STATX_BTIME)) {
+        ts.tv_sec = (time_t)stx.stx_btime.tv_sec;
+        ts.tv_nsec = (long)stx.stx_btime.tv_nsec;
+    }
+#else
+    (void)dfd;
+    (void)name;
+    (void)st;
+#endif
+    return ts;
+}
+
+struct timespec timefmt_entry_time(const char *path, const struct stat *st) {
+    return field == TIME_BIRTH ? birth_time(AT_FDCWD, path, st) : stat_time(st);
+}
+
+void timefmt_batch(const char *dir, FileEntry *entries, const bool *ok, int count) {
+    if (field != TIME_BIRTH) {
+        for (int i = 0; i < count; i++)
+            if (!ok || ok[i]) entries[i].time = stat_time(&entries[i].st);
+        return;
+    }
+
+    // Names resolve against one directory fd rather than a joined path each.
+    int dfd = backend_is_fs() ? open(dir, O_RDONLY | O_DIRECTORY | O_CLOEXEC) : -1;
+    for (int i = 0; i < count; i++) {
+        if (ok && !ok[i]) continue;
+        if (dfd >= 0) {
+            entries[i].time = birth_time(dfd, entries[i].name, &entries[i].st);
+        } else {
+            char path[PATH_MAX];
+            join_path(path, sizeof(path), dir, entries[i].name);
+            entries[i].time = birth_time(AT_FDCWD, path, &entries[i].st);
+        }
+    }
+    if (dfd >= 0) close(dfd);
+}
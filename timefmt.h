@@ -0,0 +1,45 @@
+#ifndef TIMEFMT_H
+#define TIMEFMT_H
+
+/*
+ * timefmt.h - Timestamp selection (--time) and formatting (--time-style)
+ * ----------------------------------------------------------------------
+ * The style is compiled once into a list of segments.  The date-dependent
+ * parts are rendered with strftime() once per day and cached per thread,
+ * while hours, minutes, seconds and nanoseconds are written with integer
+ * arithmetic, so a listing of millions of entries makes a handful of
+ * strftime() calls rather than one per line.
+ *
+ * Styles: the default ("locale") matches ls: "Mon dd HH:MM" for the last six
+ * months, "Mon dd  YYYY" otherwise.  "full-iso", "long-iso", "iso", and
+ * "+FORMAT" (strftime plus %N for nanoseconds; "+OLD\nRECENT" gives two
+ * formats) follow GNU ls.  $TIME_STYLE is used when --time-style is absent.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "gls.h"
+
+enum { TIME_MTIME, TIME_ATIME, TIME_CTIME, TIME_BIRTH };
+
+// Compile the style and remember the field.  Returns non-zero (after
+// printing why) if the style is invalid.
+int timefmt_init(const Options *opts);
+
+// Map a --time word (GNU spellings accepted) to a TIME_* value, or -1.
+int timefmt_parse_field(const char *word);
+
+// The selected timestamp of one entry.  Birth times need `path` (NULL gives
+// "unknown"), which is reported as tv_nsec == -1.
+struct timespec timefmt_entry_time(const char *path, const struct stat *st);
+
+// Fill `time` of the entries of `dir` whose `ok` flag is set (all of them
+// when `ok` is NULL).  Only --time=birth touches the filesystem.
+void timefmt_batch(const char *dir, FileEntry *entries, const bool *ok, int count);
+
+// Render `ts` in the compiled style.  Safe on any thread.
+void timefmt_format(struct timespec ts, char *out, size_t len);
+
+#endif
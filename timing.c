@@ -0,0 +1,144 @@
+/*
+ * timing.c - Per-directory timing for --slowest
+ * ---------------------------------------------
+ * Recording happens on whichever thread scanned the directory.  Every thread
+ * owns a min-heap of at most N records keyed on total time, so a directory
+ * that cannot make the cut costs one comparison and nothing is copied.  The
+ * heaps are only ever read after the workers have been joined.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "gls.h"
+#include "timing.h"
+
+typedef struct {
+    char *path;
+    uint64_t enum_ns;
+    uint64_t stat_ns;
+    uint64_t total_ns;
+    long entries;
+} DirTiming;
+
+typedef struct TimingLocal {
+    DirTiming *heap;            // min-heap on total_ns
+    int count;
+    struct TimingLocal *next;
+} TimingLocal;
+
+static int top_count = 0;
+static TimingLocal *all_locals = NULL;
+static pthread_mutex_t locals_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local TimingLocal *local = NULL;
+
+uint64_t timing_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void timing_init(int top_n) {
+    top_count = top_n;
+}
+
+// ========================================
+// Per-thread Min-heap
+// ========================================
+
+static void sift_down(DirTiming *heap, int count, int i) {
+    for (;;) {
+        int smallest = i, l = 2 * i + 1, r = 2 * i + 2;
+        if (l < count && heap[l].total_ns < heap[smallest].total_ns) smallest = l;
+        if (r < count && heap[r].total_ns < heap[smallest].total_ns) smallest = r;
+        if (smallest == i) return;
+        DirTiming tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+static void sift_up(DirTiming *heap, int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (heap[parent].total_ns <= heap[i].total_ns) return;
+        DirTiming tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+void timing_record(const char *path, uint64_t enum_ns, uint64_t stat_ns,
+                   uint64_t total_ns, long entries) {
+    if (top_count <= 0) return;
+
+    if (!local) {
+        local = xcalloc(1, sizeof(TimingLocal));
+        local->heap = xcalloc((size_t)top_count, sizeof(DirTiming));
+        pthread_mutex_lock(&locals_lock);
+        local->next = all_locals;
+        all_locals = local;
+        pthread_mutex_unlock(&locals_lock);
+    }
+
+    DirTiming rec = { NULL, enum_ns, stat_ns, total_ns, entries };
+    if (local->count < top_count) {
+        rec.path = xstrdup(path);
+        local->heap[local->count] = rec;
+        sift_up(local->heap, local->count++);
+    } else if (total_ns > local->heap[0].total_ns) {
+        free(local->heap[0].path);
+        rec.path = xstrdup(path);
+        local->heap[0] = rec;
+        sift_down(local->heap, local->count, 0);
+    }
+}
+
+// ========================================
+// Report
+// ========================================
+
+static int compare_timing(const void *a, const void *b) {
+    const DirTiming *ta = a, *tb = b;
+    if (ta->total_ns > tb->total_ns) return -1;
+    if (ta->total_ns < tb->total_ns) return 1;
+    return strcmp(ta->path, tb->path);
+}
+
+void timing_report(FILE *out) {
+    if (top_count <= 0) return;
+
+    int total = 0;
+    for (TimingLocal *l = all_locals; l; l = l->next) total += l->count;
+
+    DirTiming *merged = xcalloc(total > 0 ? (size_t)total : 1, sizeof(DirTiming));
+    int n = 0;
+    for (TimingLocal *l = all_locals; l; l = l->next) {
+        memcpy(merged + n, l->heap, (size_t)l->count * sizeof(DirTiming));
+        n += l->count;
+    }
+    qsort(merged, (size_t)n, sizeof(DirTiming), compare_timing);
+
+    int shown = n < top_count ? n : top_count;
+    fprintf(out, "\nSlowest %d director%s:\n", shown, shown == 1 ? "y" : "ies");
+    fprintf(out, "%10s %10s %10s %10s  %s\n", "total ms", "enum ms", "stat ms", "entries", "path");
+    for (int i = 0; i < shown; i++) {
+        fprintf(out, "%10.3f %10.3f %10.3f %10ld  %s\n",
+                merged[i].total_ns / 1e6, merged[i].enum_ns / 1e6,
+                merged[i].stat_ns / 1e6, merged[i].entries, merged[i].path);
+    }
+
+    for (int i = 0; i < n; i++) free(merged[i].path);
+    free(merged);
+    while (all_locals) {
+        TimingLocal *next = all_locals->next;
+        free(all_locals->heap);
+        free(all_locals);
+        all_locals = next;
+    }
+    local = NULL;
+}
@@ -0,0 +1,28 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+/*
+ * timing.h - Per-directory timing for --slowest
+ * ---------------------------------------------
+ * Each thread keeps its own top-N of the directories it visited, so recording
+ * is lock-free after the first call on a thread.  The per-thread results are
+ * merged once, when the report is printed.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Monotonic clock in nanoseconds.
+uint64_t timing_now(void);
+
+// Enable recording of the `top_n` slowest directories.
+void timing_init(int top_n);
+
+// Record one visited directory (times in nanoseconds).
+void timing_record(const char *path, uint64_t enum_ns, uint64_t stat_ns,
+                   uint64_t total_ns, long entries);
+
+// Print the slowest directories across all threads, slowest first.
+void timing_report(FILE *out);
+
+#endif
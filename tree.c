@@ -0,0 +1,164 @@
+/*
+ * tree.c - Indented hierarchy output for --tree
+ * ---------------------------------------------
+ * Each directory is one walker node.  Its visit renders one line per entry
+ * and places every subdirectory's subtree right after that subdirectory's
+ * line (walk_add_child_here()), so workers render directories in any order
+ * while the printer still produces the usual depth-first drawing.
+ *
+ * A child inherits the connector prefix of its parent's entries, extended
+ * by "│   " or, under the last entry, by blanks.  File counts and sizes are
+ * summed per directory during the visit and folded into the parent when a
+ * subtree is left, which happens on the printing thread right after the
+ * subtree's last line: the closing totals line is written there.
+ *
+ *   dir
+ *   ├── a.c
+ *   ├── sub
+ *   │   ├── b.c
+ *   │   └── c.c
+ *   │   [2 files, 4.1K]
+ *   └── z.txt
+ *
+ *   1 directory, 3 files, 4.6K
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <langinfo.h>
+#include <sys/stat.h>
+#include "gls.h"
+#include "display.h"
+#include "tree.h"
+#include "walk.h"
+
+// Connectors: box drawing in UTF-8 locales, ASCII otherwise (as tree does).
+typedef struct {
+    const char *branch, *last, *pipe;
+} Connectors;
+
+static const Connectors utf8_lines = { "\u251c\u2500\u2500 ", "\u2514\u2500\u2500 ", "\u2502   " };
+static const Connectors ascii_lines = { "|-- ", "`-- ", "|   " };
+
+// Per directory, owned by its walker node until leave() frees it.
+typedef struct {
+    char *prefix;                   // drawn before each entry line
+    unsigned long long dirs;        // below this directory, all levels
+    unsigned long long files;
+    unsigned long long bytes;       // apparent size of those files
+} TreeDir;
+
+typedef struct {
+    const Options *opts;
+    const Connectors *lines;
+} TreeCtx;
+
+static TreeDir *new_tree_dir(const char *prefix, const char *extend) {
+    TreeDir *td = xcalloc(1, sizeof(TreeDir));
+    size_t len = strlen(prefix);
+    td->prefix = xmalloc(len + strlen(extend) + 1);
+    memcpy(td->prefix, prefix, len);
+    strcpy(td->prefix + len, extend);
+    return td;
+}
+
+static void print_totals(FILE *out, const TreeDir *td, bool with_dirs) {
+    struct stat st = { .st_size = (off_t)td->bytes };
+    char size[32];
+    format_size(&st, size, sizeof(size));
+    if (with_dirs)
+        fprintf(out, "%llu director%s, ", td->dirs, td->dirs == 1 ? "y" : "ies");
+    fprintf(out, "%llu file%s, %s", td->files, td->files == 1 ? "" : "s", size);
+}
+
+static int visit_tree(WalkNode *node, FILE *out, void *ctx) {
+    TreeCtx *tc = ctx;
+    const char *path = walk_node_path(node);
+    int depth = walk_node_depth(node);
+    TreeDir *td = walk_node_data(node);
+
+    if (!td) {
+        char safe[PATH_MAX];
+        td = new_tree_dir("", "");
+        walk_node_set_data(node, td, sizeof(TreeDir));
+        sanitize_string(safe, path, sizeof(safe));
+        fprintf(out, "%s\n", safe);
+    }
+
+    DirListing list;
+    if (scan_directory(path, tc->opts, &list) != 0) return 1;
+
+    bool descend = tc->opts->max_depth == 0 || depth + 1 < tc->opts->max_depth;
+    for (int i = 0; i < list.count; i++) {
+        const FileEntry *fe = &list.entries[i];
+        bool last = i == list.count - 1;
+        char safe[PATH_MAX], child[PATH_MAX];
+
+        sanitize_string(safe, fe->name, sizeof(safe));
+        join_path(child, sizeof(child), path, fe->name);
+        fprintf(out, "%s%s%s", td->prefix, last ? tc->lines->last : tc->lines->branch, safe);
+        if (S_ISLNK(fe->st.st_mode)) {
+            char target[PATH_MAX];
+            if (get_link_target(child, target, sizeof(target)) == 0)
+                fprintf(out, " -> %s", target);
+        }
+        fputc('\n', out);
+
+        if (S_ISDIR(fe->st.st_mode)) {
+            td->dirs++;
+            if (descend) {
+                WalkNode *sub = walk_add_child_here(node, child, out);
+                TreeDir *std = new_tree_dir(td->prefix, last ? "    " : tc->lines->pipe);
+                walk_node_set_data(sub, std, sizeof(TreeDir) + strlen(std->prefix) + 1);
+            }
+        } else {
+            td->files++;
+            td->bytes += (unsigned long long)fe->st.st_size;
+        }
+    }
+    free_listing(&list);
+    return 0;
+}
+
+// The subtree of `node` has been printed: close it and pass its totals up.
+static void leave_tree(WalkNode *node, void *ctx) {
+    TreeDir *td = walk_node_data(node);
+    WalkNode *parent = walk_node_parent(node);
+
+    (void)ctx;
+    if (!td) return;
+    if (!parent) {
+        fputc('\n', stdout);
+        print_totals(stdout, td, true);
+        fputc('\n', stdout);
+    } else {
+        if (td->dirs + td->files > 0) {
+            fprintf(stdout, "%s[", td->prefix);
+            print_totals(stdout, td, false);
+            fprintf(stdout, "]\n");
+        }
+        TreeDir *up = walk_node_data(parent);
+        up->dirs += td->dirs;
+        up->files += td->files;
+        up->bytes += td->bytes;
+    }
+    free(td->prefix);
+    free(td);
+}
+
+int list_tree(const char *path, const Options *opts) {
+    const char *codeset = nl_langinfo(CODESET);
+    TreeCtx tc = {
+        .opts = opts,
+        .lines = strcmp(codeset, "UTF-8") == 0 ? &utf8_lines : &ascii_lines,
+    };
+    WalkConfig cfg = {
+        .visit = visit_tree,
+        .leave = leave_tree,
+        .ctx = &tc,
+        .jobs = opts->jobs,
+        .mem_limit = opts->buffer_mem,
+    };
+    return walk_tree(path, &cfg);
+}
@@ -0,0 +1,17 @@
+#ifndef TREE_H
+#define TREE_H
+
+/*
+ * tree.h - Indented hierarchy output for --tree
+ * ---------------------------------------------
+ * Draws the tree below a directory with box-drawing connectors, walked by
+ * the parallel walker but printed in the same order on every run.  Each
+ * directory closes with the number and total size of the files below it,
+ * and the root with totals for the whole tree, all from the one walk.
+ */
+
+#include "gls.h"
+
+int list_tree(const char *path, const Options *opts);
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ * unifold.c - Case and normalisation folding of file names
+ * --------------------------------------------------------
+ * The key is NFD(casefold(NFD(name))): every code point is replaced by its
+ * case-folded full decomposition, then runs of combining marks are put into
+ * canonical order.  ASCII, which is nearly every byte of a typical source
+ * tree, takes a table-free fast path; everything else is a binary search in
+ * the generated tables.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "unifold.h"
+
+typedef struct {
+    uint32_t cp;
+    uint16_t offset;        // into fold_pool
+    uint8_t len;
+} FoldEntry;
+
+typedef struct {
+    uint32_t lo, hi;
+    uint8_t ccc;            // canonical combining class
+} CccRange;
+
+#include "unifold_table.h"
+
+#define MAX_CPS 1024
+#define INVALID_BASE 0x110000   // invalid bytes map above the code space
+
+// Hangul syllables decompose algorithmically (Unicode 3.12).
+#define SBASE 0xAC00
+#define LBASE 0x1100
+#define VBASE 0x1161
+#define TBASE 0x11A7
+#define TCOUNT 28
+#define NCOUNT 588
+#define SCOUNT 11172
+
+static const FoldEntry *find_fold(uint32_t cp) {
+    size_t lo = 0, hi = sizeof(fold_table) / sizeof(fold_table[0]);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (fold_table[mid].cp == cp) return &fold_table[mid];
+        if (fold_table[mid].cp < cp) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+static uint8_t combining_class(uint32_t cp) {
+    if (cp < 0x300 || cp >= INVALID_BASE) return 0;
+    size_t lo = 0, hi = sizeof(ccc_table) / sizeof(ccc_table[0]);
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (cp < ccc_table[mid].lo) hi = mid;
+        else if (cp > ccc_table[mid].hi) lo = mid + 1;
+        else return ccc_table[mid].ccc;
+    }
+    return 0;
+}
+
+// Decode one UTF-8 sequence; invalid bytes come back as INVALID_BASE + byte.
+static uint32_t decode_utf8(const unsigned char **p) {
+    const unsigned char *s = *p;
+    uint32_t cp;
+    int extra;
+
+    if (s[0] < 0x80) { *p = s + 1; return s[0]; }
+    if ((s[0] & 0xE0) == 0xC0) { cp = s[0] & 0x1F; extra = 1; }
+    else if ((s[0] & 0xF0) == 0xE0) { cp = s[0] & 0x0F; extra = 2; }
+    else if ((s[0] & 0xF8) == 0xF0) { cp = s[0] & 0x07; extra = 3; }
+    else { *p = s + 1; return INVALID_BASE + s[0]; }
+
+    for (int i = 1; i <= extra; i++) {
+        if ((s[i] & 0xC0) != 0x80) { *p = s + 1; return INVALID_BASE + s[0]; }
+        cp = (cp << 6) | (s[i] & 0x3F);
+    }
+    // Reject overlong forms and surrogates so they cannot alias real text.
+    if ((extra == 1 && cp < 0x80) || (extra == 2 && cp < 0x800) ||
+        (extra == 3 && (cp < 0x10000 || cp > 0x10FFFF)) ||
+        (cp >= 0xD800 && cp <= 0xDFFF)) {
+        *p = s + 1;
+        return INVALID_BASE + s[0];
+    }
+    *p = s + extra + 1;
+    return cp;
+}
+
+static size_t encode_utf8(uint32_t cp, char *out) {
+    if (cp >= INVALID_BASE) { out[0] = (char)(cp - INVALID_BASE); return 1; }
+    if (cp < 0x80) { out[0] = (char)cp; return 1; }
+    if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    }
+    if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    out[0] = (char)(0xF0 | (cp >> 18));
+    out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+}
+
+size_t unifold_key(const char *name, char *out, size_t outsz) {
+    const unsigned char *p = (const unsigned char *)name;
+    uint32_t cps[MAX_CPS];
+    size_t n = 0;
+
+    // ASCII-only names need nothing but lower-casing.
+    size_t i = 0;
+    for (; name[i] && i + 1 < outsz; i++) {
+        unsigned char c = (unsigned char)name[i];
+        if (c >= 0x80) break;
+        out[i] = (c >= 'A' && c <= 'Z') ? (char)(c + 32) : (char)c;
+    }
+    if (!name[i] || i + 1 >= outsz) {
+        out[i] = '\0';
+        return i;
+    }
+
+    while (*p && n + 4 <= MAX_CPS) {
+        uint32_t cp = decode_utf8(&p);
+        if (cp < 0x80) {
+            cps[n++] = (cp >= 'A' && cp <= 'Z') ? cp + 32 : cp;
+        } else if (cp >= SBASE && cp < SBASE + SCOUNT) {
+            uint32_t s = cp - SBASE;
+            cps[n++] = LBASE + s / NCOUNT;
+            cps[n++] = VBASE + (s % NCOUNT) / TCOUNT;
+            if (s % TCOUNT) cps[n++] = TBASE + s % TCOUNT;
+        } else {
+            const FoldEntry *f = find_fold(cp);
+            if (f) {
+                for (int k = 0; k < f->len; k++) cps[n++] = fold_pool[f->offset + k];
+            } else {
+                cps[n++] = cp;
+            }
+        }
+    }
+
+    // Canonical ordering: stable sort of each run of non-starters by class.
+    for (size_t k = 1; k < n; k++) {
+        uint8_t ck = combining_class(cps[k]);
+        if (ck == 0) continue;
+        size_t j = k;
+        while (j > 0) {
+            uint8_t cj = combining_class(cps[j - 1]);
+            if (cj == 0 || cj <= ck) break;
+            uint32_t tmp = cps[j];
+            cps[j] = cps[j - 1];
+            cps[j - 1] = tmp;
+            j--;
+        }
+    }
+
+    size_t len = 0;
+    for (size_t k = 0; k < n && len + 5 <= outsz; k++)
+        len += encode_utf8(cps[k], out + len);
+    out[len] = '\0';
+    return len;
+}
@@ -0,0 +1,21 @@
+#ifndef UNIFOLD_H
+#define UNIFOLD_H
+
+/*
+ * unifold.h - Case and normalisation folding of file names
+ * --------------------------------------------------------
+ * Produces a key under which two names compare equal exactly when a
+ * case-insensitive, normalisation-insensitive filesystem (APFS, NTFS, SMB
+ * shares) would treat them as the same file.
+ */
+
+#include <stddef.h>
+
+// Longest key unifold_key() can produce for a NAME_MAX-sized name.
+#define UNIFOLD_KEY_MAX 4096
+
+// Write the folded key for `name` into `out` (NUL terminated) and return its
+// length.  Invalid UTF-8 bytes are kept as-is, so they never fold together.
+size_t unifold_key(const char *name, char *out, size_t outsz);
+
+#endif
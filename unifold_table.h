@@ -0,0 +1,4080 @@
+/*
+ * unifold_table.h - Generated by gen_unifold.py from Unicode 14.0.0 data.
+ * Do not edit by hand.
+ */
+
+static const uint32_t fold_pool[4488] = {
+    0x03BC, 0x0061, 0x0300, 0x0061, 0x0301, 0x0061, 0x0302, 0x0061,
+    0x0303, 0x0061, 0x0308, 0x0061, 0x030A, 0x00E6, 0x0063, 0x0327,
+    0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302, 0x0065, 0x0308,
+    0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069, 0x0308,
+    0x00F0, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301, 0x006F,
+    0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x00F8, 0x0075, 0x0300,
+    0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+    0x00FE, 0x0073, 0x0073, 0x0061, 0x0300, 0x0061, 0x0301, 0x0061,
+    0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030A, 0x0063,
+    0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302, 0x0065,
+    0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302, 0x0069,
+    0x0308, 0x006E, 0x0303, 0x006F, 0x0300, 0x006F, 0x0301, 0x006F,
+    0x0302, 0x006F, 0x0303, 0x006F, 0x0308, 0x0075, 0x0300, 0x0075,
+    0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301, 0x0079,
+    0x0308, 0x0061, 0x0304, 0x0061, 0x0304, 0x0061, 0x0306, 0x0061,
+    0x0306, 0x0061, 0x0328, 0x0061, 0x0328, 0x0063, 0x0301, 0x0063,
+    0x0301, 0x0063, 0x0302, 0x0063, 0x0302, 0x0063, 0x0307, 0x0063,
+    0x0307, 0x0063, 0x030C, 0x0063, 0x030C, 0x0064, 0x030C, 0x0064,
+    0x030C, 0x0111, 0x0065, 0x0304, 0x0065, 0x0304, 0x0065, 0x0306,
+    0x0065, 0x0306, 0x0065, 0x0307, 0x0065, 0x0307, 0x0065, 0x0328,
+    0x0065, 0x0328, 0x0065, 0x030C, 0x0065, 0x030C, 0x0067, 0x0302,
+    0x0067, 0x0302, 0x0067, 0x0306, 0x0067, 0x0306, 0x0067, 0x0307,
+    0x0067, 0x0307, 0x0067, 0x0327, 0x0067, 0x0327, 0x0068, 0x0302,
+    0x0068, 0x0302, 0x0127, 0x0069, 0x0303, 0x0069, 0x0303, 0x0069,
+    0x0304, 0x0069, 0x0304, 0x0069, 0x0306, 0x0069, 0x0306, 0x0069,
+    0x0328, 0x0069, 0x0328, 0x0069, 0x0307, 0x0133, 0x006A, 0x0302,
+    0x006A, 0x0302, 0x006B, 0x0327, 0x006B, 0x0327, 0x006C, 0x0301,
+    0x006C, 0x0301, 0x006C, 0x0327, 0x006C, 0x0327, 0x006C, 0x030C,
+    0x006C, 0x030C, 0x0140, 0x0142, 0x006E, 0x0301, 0x006E, 0x0301,
+    0x006E, 0x0327, 0x006E, 0x0327, 0x006E, 0x030C, 0x006E, 0x030C,
+    0x02BC, 0x006E, 0x014B, 0x006F, 0x0304, 0x006F, 0x0304, 0x006F,
+    0x0306, 0x006F, 0x0306, 0x006F, 0x030B, 0x006F, 0x030B, 0x0153,
+    0x0072, 0x0301, 0x0072, 0x0301, 0x0072, 0x0327, 0x0072, 0x0327,
+    0x0072, 0x030C, 0x0072, 0x030C, 0x0073, 0x0301, 0x0073, 0x0301,
+    0x0073, 0x0302, 0x0073, 0x0302, 0x0073, 0x0327, 0x0073, 0x0327,
+    0x0073, 0x030C, 0x0073, 0x030C, 0x0074, 0x0327, 0x0074, 0x0327,
+    0x0074, 0x030C, 0x0074, 0x030C, 0x0167, 0x0075, 0x0303, 0x0075,
+    0x0303, 0x0075, 0x0304, 0x0075, 0x0304, 0x0075, 0x0306, 0x0075,
+    0x0306, 0x0075, 0x030A, 0x0075, 0x030A, 0x0075, 0x030B, 0x0075,
+    0x030B, 0x0075, 0x0328, 0x0075, 0x0328, 0x0077, 0x0302, 0x0077,
+    0x0302, 0x0079, 0x0302, 0x0079, 0x0302, 0x0079, 0x0308, 0x007A,
+    0x0301, 0x007A, 0x0301, 0x007A, 0x0307, 0x007A, 0x0307, 0x007A,
+    0x030C, 0x007A, 0x030C, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254,
+    0x0188, 0x0256, 0x0257, 0x018C, 0x01DD, 0x0259, 0x025B, 0x0192,
+    0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026F, 0x0272, 0x0275,
+    0x006F, 0x031B, 0x006F, 0x031B, 0x01A3, 0x01A5, 0x0280, 0x01A8,
+    0x0283, 0x01AD, 0x0288, 0x0075, 0x031B, 0x0075, 0x031B, 0x028A,
+    0x028B, 0x01B4, 0x01B6, 0x0292, 0x01B9, 0x01BD, 0x01C6, 0x01C6,
+    0x01C9, 0x01C9, 0x01CC, 0x01CC, 0x0061, 0x030C, 0x0061, 0x030C,
+    0x0069, 0x030C, 0x0069, 0x030C, 0x006F, 0x030C, 0x006F, 0x030C,
+    0x0075, 0x030C, 0x0075, 0x030C, 0x0075, 0x0308, 0x0304, 0x0075,
+    0x0308, 0x0304, 0x0075, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301,
+    0x0075, 0x0308, 0x030C, 0x0075, 0x0308, 0x030C, 0x0075, 0x0308,
+    0x0300, 0x0075, 0x0308, 0x0300, 0x0061, 0x0308, 0x0304, 0x0061,
+    0x0308, 0x0304, 0x0061, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304,
+    0x00E6, 0x0304, 0x00E6, 0x0304, 0x01E5, 0x0067, 0x030C, 0x0067,
+    0x030C, 0x006B, 0x030C, 0x006B, 0x030C, 0x006F, 0x0328, 0x006F,
+    0x0328, 0x006F, 0x0328, 0x0304, 0x006F, 0x0328, 0x0304, 0x0292,
+    0x030C, 0x0292, 0x030C, 0x006A, 0x030C, 0x01F3, 0x01F3, 0x0067,
+    0x0301, 0x0067, 0x0301, 0x0195, 0x01BF, 0x006E, 0x0300, 0x006E,
+    0x0300, 0x0061, 0x030A, 0x0301, 0x0061, 0x030A, 0x0301, 0x00E6,
+    0x0301, 0x00E6, 0x0301, 0x00F8, 0x0301, 0x00F8, 0x0301, 0x0061,
+    0x030F, 0x0061, 0x030F, 0x0061, 0x0311, 0x0061, 0x0311, 0x0065,
+    0x030F, 0x0065, 0x030F, 0x0065, 0x0311, 0x0065, 0x0311, 0x0069,
+    0x030F, 0x0069, 0x030F, 0x0069, 0x0311, 0x0069, 0x0311, 0x006F,
+    0x030F, 0x006F, 0x030F, 0x006F, 0x0311, 0x006F, 0x0311, 0x0072,
+    0x030F, 0x0072, 0x030F, 0x0072, 0x0311, 0x0072, 0x0311, 0x0075,
+    0x030F, 0x0075, 0x030F, 0x0075, 0x0311, 0x0075, 0x0311, 0x0073,
+    0x0326, 0x0073, 0x0326, 0x0074, 0x0326, 0x0074, 0x0326, 0x021D,
+    0x0068, 0x030C, 0x0068, 0x030C, 0x019E, 0x0223, 0x0225, 0x0061,
+    0x0307, 0x0061, 0x0307, 0x0065, 0x0327, 0x0065, 0x0327, 0x006F,
+    0x0308, 0x0304, 0x006F, 0x0308, 0x0304, 0x006F, 0x0303, 0x0304,
+    0x006F, 0x0303, 0x0304, 0x006F, 0x0307, 0x006F, 0x0307, 0x006F,
+    0x0307, 0x0304, 0x006F, 0x0307, 0x0304, 0x0079, 0x0304, 0x0079,
+    0x0304, 0x2C65, 0x023C, 0x019A, 0x2C66, 0x0242, 0x0180, 0x0289,
+    0x028C, 0x0247, 0x0249, 0x024B, 0x024D, 0x024F, 0x0300, 0x0301,
+    0x0313, 0x0308, 0x0301, 0x03B9, 0x0371, 0x0373, 0x02B9, 0x0377,
+    0x003B, 0x03F3, 0x00A8, 0x0301, 0x03B1, 0x0301, 0x00B7, 0x03B5,
+    0x0301, 0x03B7, 0x0301, 0x03B9, 0x0301, 0x03BF, 0x0301, 0x03C5,
+    0x0301, 0x03C9, 0x0301, 0x03B9, 0x0308, 0x0301, 0x03B1, 0x03B2,
+    0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA,
+    0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3,
+    0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03B9, 0x0308,
+    0x03C5, 0x0308, 0x03B1, 0x0301, 0x03B5, 0x0301, 0x03B7, 0x0301,
+    0x03B9, 0x0301, 0x03C5, 0x0308, 0x0301, 0x03C3, 0x03B9, 0x0308,
+    0x03C5, 0x0308, 0x03BF, 0x0301, 0x03C5, 0x0301, 0x03C9, 0x0301,
+    0x03D7, 0x03B2, 0x03B8, 0x03D2, 0x0301, 0x03D2, 0x0308, 0x03C6,
+    0x03C0, 0x03D9, 0x03DB, 0x03DD, 0x03DF, 0x03E1, 0x03E3, 0x03E5,
+    0x03E7, 0x03E9, 0x03EB, 0x03ED, 0x03EF, 0x03BA, 0x03C1, 0x03B8,
+    0x03B5, 0x03F8, 0x03F2, 0x03FB, 0x037B, 0x037C, 0x037D, 0x0435,
+    0x0300, 0x0435, 0x0308, 0x0452, 0x0433, 0x0301, 0x0454, 0x0455,
+    0x0456, 0x0456, 0x0308, 0x0458, 0x0459, 0x045A, 0x045B, 0x043A,
+    0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x045F, 0x0430, 0x0431,
+    0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0438,
+    0x0306, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440,
+    0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448,
+    0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x0438,
+    0x0306, 0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456,
+    0x0308, 0x043A, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0461,
+    0x0463, 0x0465, 0x0467, 0x0469, 0x046B, 0x046D, 0x046F, 0x0471,
+    0x0473, 0x0475, 0x0475, 0x030F, 0x0475, 0x030F, 0x0479, 0x047B,
+    0x047D, 0x047F, 0x0481, 0x048B, 0x048D, 0x048F, 0x0491, 0x0493,
+    0x0495, 0x0497, 0x0499, 0x049B, 0x049D, 0x049F, 0x04A1, 0x04A3,
+    0x04A5, 0x04A7, 0x04A9, 0x04AB, 0x04AD, 0x04AF, 0x04B1, 0x04B3,
+    0x04B5, 0x04B7, 0x04B9, 0x04BB, 0x04BD, 0x04BF, 0x04CF, 0x0436,
+    0x0306, 0x0436, 0x0306, 0x04C4, 0x04C6, 0x04C8, 0x04CA, 0x04CC,
+    0x04CE, 0x0430, 0x0306, 0x0430, 0x0306, 0x0430, 0x0308, 0x0430,
+    0x0308, 0x04D5, 0x0435, 0x0306, 0x0435, 0x0306, 0x04D9, 0x04D9,
+    0x0308, 0x04D9, 0x0308, 0x0436, 0x0308, 0x0436, 0x0308, 0x0437,
+    0x0308, 0x0437, 0x0308, 0x04E1, 0x0438, 0x0304, 0x0438, 0x0304,
+    0x0438, 0x0308, 0x0438, 0x0308, 0x043E, 0x0308, 0x043E, 0x0308,
+    0x04E9, 0x04E9, 0x0308, 0x04E9, 0x0308, 0x044D, 0x0308, 0x044D,
+    0x0308, 0x0443, 0x0304, 0x0443, 0x0304, 0x0443, 0x0308, 0x0443,
+    0x0308, 0x0443, 0x030B, 0x0443, 0x030B, 0x0447, 0x0308, 0x0447,
+    0x0308, 0x04F7, 0x044B, 0x0308, 0x044B, 0x0308, 0x04FB, 0x04FD,
+    0x04FF, 0x0501, 0x0503, 0x0505, 0x0507, 0x0509, 0x050B, 0x050D,
+    0x050F, 0x0511, 0x0513, 0x0515, 0x0517, 0x0519, 0x051B, 0x051D,
+    0x051F, 0x0521, 0x0523, 0x0525, 0x0527, 0x0529, 0x052B, 0x052D,
+    0x052F, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+    0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F,
+    0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+    0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
+    0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0565,
+    0x0582, 0x0627, 0x0653, 0x0627, 0x0654, 0x0648, 0x0654, 0x0627,
+    0x0655, 0x064A, 0x0654, 0x06D5, 0x0654, 0x06C1, 0x0654, 0x06D2,
+    0x0654, 0x0928, 0x093C, 0x0930, 0x093C, 0x0933, 0x093C, 0x0915,
+    0x093C, 0x0916, 0x093C, 0x0917, 0x093C, 0x091C, 0x093C, 0x0921,
+    0x093C, 0x0922, 0x093C, 0x092B, 0x093C, 0x092F, 0x093C, 0x09C7,
+    0x09BE, 0x09C7, 0x09D7, 0x09A1, 0x09BC, 0x09A2, 0x09BC, 0x09AF,
+    0x09BC, 0x0A32, 0x0A3C, 0x0A38, 0x0A3C, 0x0A16, 0x0A3C, 0x0A17,
+    0x0A3C, 0x0A1C, 0x0A3C, 0x0A2B, 0x0A3C, 0x0B47, 0x0B56, 0x0B47,
+    0x0B3E, 0x0B47, 0x0B57, 0x0B21, 0x0B3C, 0x0B22, 0x0B3C, 0x0B92,
+    0x0BD7, 0x0BC6, 0x0BBE, 0x0BC7, 0x0BBE, 0x0BC6, 0x0BD7, 0x0C46,
+    0x0C56, 0x0CBF, 0x0CD5, 0x0CC6, 0x0CD5, 0x0CC6, 0x0CD6, 0x0CC6,
+    0x0CC2, 0x0CC6, 0x0CC2, 0x0CD5, 0x0D46, 0x0D3E, 0x0D47, 0x0D3E,
+    0x0D46, 0x0D57, 0x0DD9, 0x0DCA, 0x0DD9, 0x0DCF, 0x0DD9, 0x0DCF,
+    0x0DCA, 0x0DD9, 0x0DDF, 0x0F42, 0x0FB7, 0x0F4C, 0x0FB7, 0x0F51,
+    0x0FB7, 0x0F56, 0x0FB7, 0x0F5B, 0x0FB7, 0x0F40, 0x0FB5, 0x0F71,
+    0x0F72, 0x0F71, 0x0F74, 0x0FB2, 0x0F80, 0x0FB3, 0x0F80, 0x0F71,
+    0x0F80, 0x0F92, 0x0FB7, 0x0F9C, 0x0FB7, 0x0FA1, 0x0FB7, 0x0FA6,
+    0x0FB7, 0x0FAB, 0x0FB7, 0x0F90, 0x0FB5, 0x1025, 0x102E, 0x2D00,
+    0x2D01, 0x2D02, 0x2D03, 0x2D04, 0x2D05, 0x2D06, 0x2D07, 0x2D08,
+    0x2D09, 0x2D0A, 0x2D0B, 0x2D0C, 0x2D0D, 0x2D0E, 0x2D0F, 0x2D10,
+    0x2D11, 0x2D12, 0x2D13, 0x2D14, 0x2D15, 0x2D16, 0x2D17, 0x2D18,
+    0x2D19, 0x2D1A, 0x2D1B, 0x2D1C, 0x2D1D, 0x2D1E, 0x2D1F, 0x2D20,
+    0x2D21, 0x2D22, 0x2D23, 0x2D24, 0x2D25, 0x2D27, 0x2D2D, 0x13F0,
+    0x13F1, 0x13F2, 0x13F3, 0x13F4, 0x13F5, 0x1B05, 0x1B35, 0x1B07,
+    0x1B35, 0x1B09, 0x1B35, 0x1B0B, 0x1B35, 0x1B0D, 0x1B35, 0x1B11,
+    0x1B35, 0x1B3A, 0x1B35, 0x1B3C, 0x1B35, 0x1B3E, 0x1B35, 0x1B3F,
+    0x1B35, 0x1B42, 0x1B35, 0x0432, 0x0434, 0x043E, 0x0441, 0x0442,
+    0x0442, 0x044A, 0x0463, 0xA64B, 0x10D0, 0x10D1, 0x10D2, 0x10D3,
+    0x10D4, 0x10D5, 0x10D6, 0x10D7, 0x10D8, 0x10D9, 0x10DA, 0x10DB,
+    0x10DC, 0x10DD, 0x10DE, 0x10DF, 0x10E0, 0x10E1, 0x10E2, 0x10E3,
+    0x10E4, 0x10E5, 0x10E6, 0x10E7, 0x10E8, 0x10E9, 0x10EA, 0x10EB,
+    0x10EC, 0x10ED, 0x10EE, 0x10EF, 0x10F0, 0x10F1, 0x10F2, 0x10F3,
+    0x10F4, 0x10F5, 0x10F6, 0x10F7, 0x10F8, 0x10F9, 0x10FA, 0x10FD,
+    0x10FE, 0x10FF, 0x0061, 0x0325, 0x0061, 0x0325, 0x0062, 0x0307,
+    0x0062, 0x0307, 0x0062, 0x0323, 0x0062, 0x0323, 0x0062, 0x0331,
+    0x0062, 0x0331, 0x0063, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301,
+    0x0064, 0x0307, 0x0064, 0x0307, 0x0064, 0x0323, 0x0064, 0x0323,
+    0x0064, 0x0331, 0x0064, 0x0331, 0x0064, 0x0327, 0x0064, 0x0327,
+    0x0064, 0x032D, 0x0064, 0x032D, 0x0065, 0x0304, 0x0300, 0x0065,
+    0x0304, 0x0300, 0x0065, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301,
+    0x0065, 0x032D, 0x0065, 0x032D, 0x0065, 0x0330, 0x0065, 0x0330,
+    0x0065, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0066, 0x0307,
+    0x0066, 0x0307, 0x0067, 0x0304, 0x0067, 0x0304, 0x0068, 0x0307,
+    0x0068, 0x0307, 0x0068, 0x0323, 0x0068, 0x0323, 0x0068, 0x0308,
+    0x0068, 0x0308, 0x0068, 0x0327, 0x0068, 0x0327, 0x0068, 0x032E,
+    0x0068, 0x032E, 0x0069, 0x0330, 0x0069, 0x0330, 0x0069, 0x0308,
+    0x0301, 0x0069, 0x0308, 0x0301, 0x006B, 0x0301, 0x006B, 0x0301,
+    0x006B, 0x0323, 0x006B, 0x0323, 0x006B, 0x0331, 0x006B, 0x0331,
+    0x006C, 0x0323, 0x006C, 0x0323, 0x006C, 0x0323, 0x0304, 0x006C,
+    0x0323, 0x0304, 0x006C, 0x0331, 0x006C, 0x0331, 0x006C, 0x032D,
+    0x006C, 0x032D, 0x006D, 0x0301, 0x006D, 0x0301, 0x006D, 0x0307,
+    0x006D, 0x0307, 0x006D, 0x0323, 0x006D, 0x0323, 0x006E, 0x0307,
+    0x006E, 0x0307, 0x006E, 0x0323, 0x006E, 0x0323, 0x006E, 0x0331,
+    0x006E, 0x0331, 0x006E, 0x032D, 0x006E, 0x032D, 0x006F, 0x0303,
+    0x0301, 0x006F, 0x0303, 0x0301, 0x006F, 0x0303, 0x0308, 0x006F,
+    0x0303, 0x0308, 0x006F, 0x0304, 0x0300, 0x006F, 0x0304, 0x0300,
+    0x006F, 0x0304, 0x0301, 0x006F, 0x0304, 0x0301, 0x0070, 0x0301,
+    0x0070, 0x0301, 0x0070, 0x0307, 0x0070, 0x0307, 0x0072, 0x0307,
+    0x0072, 0x0307, 0x0072, 0x0323, 0x0072, 0x0323, 0x0072, 0x0323,
+    0x0304, 0x0072, 0x0323, 0x0304, 0x0072, 0x0331, 0x0072, 0x0331,
+    0x0073, 0x0307, 0x0073, 0x0307, 0x0073, 0x0323, 0x0073, 0x0323,
+    0x0073, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0073, 0x030C,
+    0x0307, 0x0073, 0x030C, 0x0307, 0x0073, 0x0323, 0x0307, 0x0073,
+    0x0323, 0x0307, 0x0074, 0x0307, 0x0074, 0x0307, 0x0074, 0x0323,
+    0x0074, 0x0323, 0x0074, 0x0331, 0x0074, 0x0331, 0x0074, 0x032D,
+    0x0074, 0x032D, 0x0075, 0x0324, 0x0075, 0x0324, 0x0075, 0x0330,
+    0x0075, 0x0330, 0x0075, 0x032D, 0x0075, 0x032D, 0x0075, 0x0303,
+    0x0301, 0x0075, 0x0303, 0x0301, 0x0075, 0x0304, 0x0308, 0x0075,
+    0x0304, 0x0308, 0x0076, 0x0303, 0x0076, 0x0303, 0x0076, 0x0323,
+    0x0076, 0x0323, 0x0077, 0x0300, 0x0077, 0x0300, 0x0077, 0x0301,
+    0x0077, 0x0301, 0x0077, 0x0308, 0x0077, 0x0308, 0x0077, 0x0307,
+    0x0077, 0x0307, 0x0077, 0x0323, 0x0077, 0x0323, 0x0078, 0x0307,
+    0x0078, 0x0307, 0x0078, 0x0308, 0x0078, 0x0308, 0x0079, 0x0307,
+    0x0079, 0x0307, 0x007A, 0x0302, 0x007A, 0x0302, 0x007A, 0x0323,
+    0x007A, 0x0323, 0x007A, 0x0331, 0x007A, 0x0331, 0x0068, 0x0331,
+    0x0074, 0x0308, 0x0077, 0x030A, 0x0079, 0x030A, 0x0061, 0x02BE,
+    0x0073, 0x0307, 0x0073, 0x0073, 0x0061, 0x0323, 0x0061, 0x0323,
+    0x0061, 0x0309, 0x0061, 0x0309, 0x0061, 0x0302, 0x0301, 0x0061,
+    0x0302, 0x0301, 0x0061, 0x0302, 0x0300, 0x0061, 0x0302, 0x0300,
+    0x0061, 0x0302, 0x0309, 0x0061, 0x0302, 0x0309, 0x0061, 0x0302,
+    0x0303, 0x0061, 0x0302, 0x0303, 0x0061, 0x0323, 0x0302, 0x0061,
+    0x0323, 0x0302, 0x0061, 0x0306, 0x0301, 0x0061, 0x0306, 0x0301,
+    0x0061, 0x0306, 0x0300, 0x0061, 0x0306, 0x0300, 0x0061, 0x0306,
+    0x0309, 0x0061, 0x0306, 0x0309, 0x0061, 0x0306, 0x0303, 0x0061,
+    0x0306, 0x0303, 0x0061, 0x0323, 0x0306, 0x0061, 0x0323, 0x0306,
+    0x0065, 0x0323, 0x0065, 0x0323, 0x0065, 0x0309, 0x0065, 0x0309,
+    0x0065, 0x0303, 0x0065, 0x0303, 0x0065, 0x0302, 0x0301, 0x0065,
+    0x0302, 0x0301, 0x0065, 0x0302, 0x0300, 0x0065, 0x0302, 0x0300,
+    0x0065, 0x0302, 0x0309, 0x0065, 0x0302, 0x0309, 0x0065, 0x0302,
+    0x0303, 0x0065, 0x0302, 0x0303, 0x0065, 0x0323, 0x0302, 0x0065,
+    0x0323, 0x0302, 0x0069, 0x0309, 0x0069, 0x0309, 0x0069, 0x0323,
+    0x0069, 0x0323, 0x006F, 0x0323, 0x006F, 0x0323, 0x006F, 0x0309,
+    0x006F, 0x0309, 0x006F, 0x0302, 0x0301, 0x006F, 0x0302, 0x0301,
+    0x006F, 0x0302, 0x0300, 0x006F, 0x0302, 0x0300, 0x006F, 0x0302,
+    0x0309, 0x006F, 0x0302, 0x0309, 0x006F, 0x0302, 0x0303, 0x006F,
+    0x0302, 0x0303, 0x006F, 0x0323, 0x0302, 0x006F, 0x0323, 0x0302,
+    0x006F, 0x031B, 0x0301, 0x006F, 0x031B, 0x0301, 0x006F, 0x031B,
+    0x0300, 0x006F, 0x031B, 0x0300, 0x006F, 0x031B, 0x0309, 0x006F,
+    0x031B, 0x0309, 0x006F, 0x031B, 0x0303, 0x006F, 0x031B, 0x0303,
+    0x006F, 0x031B, 0x0323, 0x006F, 0x031B, 0x0323, 0x0075, 0x0323,
+    0x0075, 0x0323, 0x0075, 0x0309, 0x0075, 0x0309, 0x0075, 0x031B,
+    0x0301, 0x0075, 0x031B, 0x0301, 0x0075, 0x031B, 0x0300, 0x0075,
+    0x031B, 0x0300, 0x0075, 0x031B, 0x0309, 0x0075, 0x031B, 0x0309,
+    0x0075, 0x031B, 0x0303, 0x0075, 0x031B, 0x0303, 0x0075, 0x031B,
+    0x0323, 0x0075, 0x031B, 0x0323, 0x0079, 0x0300, 0x0079, 0x0300,
+    0x0079, 0x0323, 0x0079, 0x0323, 0x0079, 0x0309, 0x0079, 0x0309,
+    0x0079, 0x0303, 0x0079, 0x0303, 0x1EFB, 0x1EFD, 0x1EFF, 0x03B1,
+    0x0313, 0x03B1, 0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314,
+    0x0300, 0x03B1, 0x0313, 0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1,
+    0x0313, 0x0342, 0x03B1, 0x0314, 0x0342, 0x03B1, 0x0313, 0x03B1,
+    0x0314, 0x03B1, 0x0313, 0x0300, 0x03B1, 0x0314, 0x0300, 0x03B1,
+    0x0313, 0x0301, 0x03B1, 0x0314, 0x0301, 0x03B1, 0x0313, 0x0342,
+    0x03B1, 0x0314, 0x0342, 0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5,
+    0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313, 0x0301,
+    0x03B5, 0x0314, 0x0301, 0x03B5, 0x0313, 0x03B5, 0x0314, 0x03B5,
+    0x0313, 0x0300, 0x03B5, 0x0314, 0x0300, 0x03B5, 0x0313, 0x0301,
+    0x03B5, 0x0314, 0x0301, 0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7,
+    0x0313, 0x0300, 0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313, 0x0301,
+    0x03B7, 0x0314, 0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314,
+    0x0342, 0x03B7, 0x0313, 0x03B7, 0x0314, 0x03B7, 0x0313, 0x0300,
+    0x03B7, 0x0314, 0x0300, 0x03B7, 0x0313, 0x0301, 0x03B7, 0x0314,
+    0x0301, 0x03B7, 0x0313, 0x0342, 0x03B7, 0x0314, 0x0342, 0x03B9,
+    0x0313, 0x03B9, 0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9, 0x0314,
+    0x0300, 0x03B9, 0x0313, 0x0301, 0x03B9, 0x0314, 0x0301, 0x03B9,
+    0x0313, 0x0342, 0x03B9, 0x0314, 0x0342, 0x03B9, 0x0313, 0x03B9,
+    0x0314, 0x03B9, 0x0313, 0x0300, 0x03B9, 0x0314, 0x0300, 0x03B9,
+    0x0313, 0x0301, 0x03B9, 0x0314, 0x0301, 0x03B9, 0x0313, 0x0342,
+    0x03B9, 0x0314, 0x0342, 0x03BF, 0x0313, 0x03BF, 0x0314, 0x03BF,
+    0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313, 0x0301,
+    0x03BF, 0x0314, 0x0301, 0x03BF, 0x0313, 0x03BF, 0x0314, 0x03BF,
+    0x0313, 0x0300, 0x03BF, 0x0314, 0x0300, 0x03BF, 0x0313, 0x0301,
+    0x03BF, 0x0314, 0x0301, 0x03C5, 0x0313, 0x03C5, 0x0314, 0x03C5,
+    0x0313, 0x0300, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0313, 0x0301,
+    0x03C5, 0x0314, 0x0301, 0x03C5, 0x0313, 0x0342, 0x03C5, 0x0314,
+    0x0342, 0x03C5, 0x0314, 0x03C5, 0x0314, 0x0300, 0x03C5, 0x0314,
+    0x0301, 0x03C5, 0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314,
+    0x03C9, 0x0313, 0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313,
+    0x0301, 0x03C9, 0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9,
+    0x0314, 0x0342, 0x03C9, 0x0313, 0x03C9, 0x0314, 0x03C9, 0x0313,
+    0x0300, 0x03C9, 0x0314, 0x0300, 0x03C9, 0x0313, 0x0301, 0x03C9,
+    0x0314, 0x0301, 0x03C9, 0x0313, 0x0342, 0x03C9, 0x0314, 0x0342,
+    0x03B1, 0x0300, 0x03B1, 0x0301, 0x03B5, 0x0300, 0x03B5, 0x0301,
+    0x03B7, 0x0300, 0x03B7, 0x0301, 0x03B9, 0x0300, 0x03B9, 0x0301,
+    0x03BF, 0x0300, 0x03BF, 0x0301, 0x03C5, 0x0300, 0x03C5, 0x0301,
+    0x03C9, 0x0300, 0x03C9, 0x0301, 0x03B1, 0x0313, 0x03B9, 0x03B1,
+    0x0314, 0x03B9, 0x03B1, 0x0313, 0x0300, 0x03B9, 0x03B1, 0x0314,
+    0x0300, 0x03B9, 0x03B1, 0x0313, 0x0301, 0x03B9, 0x03B1, 0x0314,
+    0x0301, 0x03B9, 0x03B1, 0x0313, 0x0342, 0x03B9, 0x03B1, 0x0314,
+    0x0342, 0x03B9, 0x03B1, 0x0313, 0x03B9, 0x03B1, 0x0314, 0x03B9,
+    0x03B1, 0x0313, 0x0300, 0x03B9, 0x03B1, 0x0314, 0x0300, 0x03B9,
+    0x03B1, 0x0313, 0x0301, 0x03B9, 0x03B1, 0x0314, 0x0301, 0x03B9,
+    0x03B1, 0x0313, 0x0342, 0x03B9, 0x03B1, 0x0314, 0x0342, 0x03B9,
+    0x03B7, 0x0313, 0x03B9, 0x03B7, 0x0314, 0x03B9, 0x03B7, 0x0313,
+    0x0300, 0x03B9, 0x03B7, 0x0314, 0x0300, 0x03B9, 0x03B7, 0x0313,
+    0x0301, 0x03B9, 0x03B7, 0x0314, 0x0301, 0x03B9, 0x03B7, 0x0313,
+    0x0342, 0x03B9, 0x03B7, 0x0314, 0x0342, 0x03B9, 0x03B7, 0x0313,
+    0x03B9, 0x03B7, 0x0314, 0x03B9, 0x03B7, 0x0313, 0x0300, 0x03B9,
+    0x03B7, 0x0314, 0x0300, 0x03B9, 0x03B7, 0x0313, 0x0301, 0x03B9,
+    0x03B7, 0x0314, 0x0301, 0x03B9, 0x03B7, 0x0313, 0x0342, 0x03B9,
+    0x03B7, 0x0314, 0x0342, 0x03B9, 0x03C9, 0x0313, 0x03B9, 0x03C9,
+    0x0314, 0x03B9, 0x03C9, 0x0313, 0x0300, 0x03B9, 0x03C9, 0x0314,
+    0x0300, 0x03B9, 0x03C9, 0x0313, 0x0301, 0x03B9, 0x03C9, 0x0314,
+    0x0301, 0x03B9, 0x03C9, 0x0313, 0x0342, 0x03B9, 0x03C9, 0x0314,
+    0x0342, 0x03B9, 0x03C9, 0x0313, 0x03B9, 0x03C9, 0x0314, 0x03B9,
+    0x03C9, 0x0313, 0x0300, 0x03B9, 0x03C9, 0x0314, 0x0300, 0x03B9,
+    0x03C9, 0x0313, 0x0301, 0x03B9, 0x03C9, 0x0314, 0x0301, 0x03B9,
+    0x03C9, 0x0313, 0x0342, 0x03B9, 0x03C9, 0x0314, 0x0342, 0x03B9,
+    0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x03B9, 0x03B1,
+    0x03B9, 0x03B1, 0x0301, 0x03B9, 0x03B1, 0x0342, 0x03B1, 0x0342,
+    0x03B9, 0x03B1, 0x0306, 0x03B1, 0x0304, 0x03B1, 0x0300, 0x03B1,
+    0x0301, 0x03B1, 0x03B9, 0x03B9, 0x00A8, 0x0342, 0x03B7, 0x0300,
+    0x03B9, 0x03B7, 0x03B9, 0x03B7, 0x0301, 0x03B9, 0x03B7, 0x0342,
+    0x03B7, 0x0342, 0x03B9, 0x03B5, 0x0300, 0x03B5, 0x0301, 0x03B7,
+    0x0300, 0x03B7, 0x0301, 0x03B7, 0x03B9, 0x1FBF, 0x0300, 0x1FBF,
+    0x0301, 0x1FBF, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9,
+    0x0308, 0x0300, 0x03B9, 0x0308, 0x0301, 0x03B9, 0x0342, 0x03B9,
+    0x0308, 0x0342, 0x03B9, 0x0306, 0x03B9, 0x0304, 0x03B9, 0x0300,
+    0x03B9, 0x0301, 0x1FFE, 0x0300, 0x1FFE, 0x0301, 0x1FFE, 0x0342,
+    0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5, 0x0308, 0x0300, 0x03C5,
+    0x0308, 0x0301, 0x03C1, 0x0313, 0x03C1, 0x0314, 0x03C5, 0x0342,
+    0x03C5, 0x0308, 0x0342, 0x03C5, 0x0306, 0x03C5, 0x0304, 0x03C5,
+    0x0300, 0x03C5, 0x0301, 0x03C1, 0x0314, 0x00A8, 0x0300, 0x00A8,
+    0x0301, 0x0060, 0x03C9, 0x0300, 0x03B9, 0x03C9, 0x03B9, 0x03C9,
+    0x0301, 0x03B9, 0x03C9, 0x0342, 0x03C9, 0x0342, 0x03B9, 0x03BF,
+    0x0300, 0x03BF, 0x0301, 0x03C9, 0x0300, 0x03C9, 0x0301, 0x03C9,
+    0x03B9, 0x00B4, 0x2002, 0x2003, 0x03C9, 0x006B, 0x0061, 0x030A,
+    0x214E, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176,
+    0x2177, 0x2178, 0x2179, 0x217A, 0x217B, 0x217C, 0x217D, 0x217E,
+    0x217F, 0x2184, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338,
+    0x21D0, 0x0338, 0x21D4, 0x0338, 0x21D2, 0x0338, 0x2203, 0x0338,
+    0x2208, 0x0338, 0x220B, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338,
+    0x223C, 0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338,
+    0x003D, 0x0338, 0x2261, 0x0338, 0x224D, 0x0338, 0x003C, 0x0338,
+    0x003E, 0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338,
+    0x2273, 0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227A, 0x0338,
+    0x227B, 0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338,
+    0x2287, 0x0338, 0x22A2, 0x0338, 0x22A8, 0x0338, 0x22A9, 0x0338,
+    0x22AB, 0x0338, 0x227C, 0x0338, 0x227D, 0x0338, 0x2291, 0x0338,
+    0x2292, 0x0338, 0x22B2, 0x0338, 0x22B3, 0x0338, 0x22B4, 0x0338,
+    0x22B5, 0x0338, 0x3008, 0x3009, 0x24D0, 0x24D1, 0x24D2, 0x24D3,
+    0x24D4, 0x24D5, 0x24D6, 0x24D7, 0x24D8, 0x24D9, 0x24DA, 0x24DB,
+    0x24DC, 0x24DD, 0x24DE, 0x24DF, 0x24E0, 0x24E1, 0x24E2, 0x24E3,
+    0x24E4, 0x24E5, 0x24E6, 0x24E7, 0x24E8, 0x24E9, 0x2ADD, 0x0338,
+    0x2C30, 0x2C31, 0x2C32, 0x2C33, 0x2C34, 0x2C35, 0x2C36, 0x2C37,
+    0x2C38, 0x2C39, 0x2C3A, 0x2C3B, 0x2C3C, 0x2C3D, 0x2C3E, 0x2C3F,
+    0x2C40, 0x2C41, 0x2C42, 0x2C43, 0x2C44, 0x2C45, 0x2C46, 0x2C47,
+    0x2C48, 0x2C49, 0x2C4A, 0x2C4B, 0x2C4C, 0x2C4D, 0x2C4E, 0x2C4F,
+    0x2C50, 0x2C51, 0x2C52, 0x2C53, 0x2C54, 0x2C55, 0x2C56, 0x2C57,
+    0x2C58, 0x2C59, 0x2C5A, 0x2C5B, 0x2C5C, 0x2C5D, 0x2C5E, 0x2C5F,
+    0x2C61, 0x026B, 0x1D7D, 0x027D, 0x2C68, 0x2C6A, 0x2C6C, 0x0251,
+    0x0271, 0x0250, 0x0252, 0x2C73, 0x2C76, 0x023F, 0x0240, 0x2C81,
+    0x2C83, 0x2C85, 0x2C87, 0x2C89, 0x2C8B, 0x2C8D, 0x2C8F, 0x2C91,
+    0x2C93, 0x2C95, 0x2C97, 0x2C99, 0x2C9B, 0x2C9D, 0x2C9F, 0x2CA1,
+    0x2CA3, 0x2CA5, 0x2CA7, 0x2CA9, 0x2CAB, 0x2CAD, 0x2CAF, 0x2CB1,
+    0x2CB3, 0x2CB5, 0x2CB7, 0x2CB9, 0x2CBB, 0x2CBD, 0x2CBF, 0x2CC1,
+    0x2CC3, 0x2CC5, 0x2CC7, 0x2CC9, 0x2CCB, 0x2CCD, 0x2CCF, 0x2CD1,
+    0x2CD3, 0x2CD5, 0x2CD7, 0x2CD9, 0x2CDB, 0x2CDD, 0x2CDF, 0x2CE1,
+    0x2CE3, 0x2CEC, 0x2CEE, 0x2CF3, 0x304B, 0x3099, 0x304D, 0x3099,
+    0x304F, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055, 0x3099,
+    0x3057, 0x3099, 0x3059, 0x3099, 0x305B, 0x3099, 0x305D, 0x3099,
+    0x305F, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066, 0x3099,
+    0x3068, 0x3099, 0x306F, 0x3099, 0x306F, 0x309A, 0x3072, 0x3099,
+    0x3072, 0x309A, 0x3075, 0x3099, 0x3075, 0x309A, 0x3078, 0x3099,
+    0x3078, 0x309A, 0x307B, 0x3099, 0x307B, 0x309A, 0x3046, 0x3099,
+    0x309D, 0x3099, 0x30AB, 0x3099, 0x30AD, 0x3099, 0x30AF, 0x3099,
+    0x30B1, 0x3099, 0x30B3, 0x3099, 0x30B5, 0x3099, 0x30B7, 0x3099,
+    0x30B9, 0x3099, 0x30BB, 0x3099, 0x30BD, 0x3099, 0x30BF, 0x3099,
+    0x30C1, 0x3099, 0x30C4, 0x3099, 0x30C6, 0x3099, 0x30C8, 0x3099,
+    0x30CF, 0x3099, 0x30CF, 0x309A, 0x30D2, 0x3099, 0x30D2, 0x309A,
+    0x30D5, 0x3099, 0x30D5, 0x309A, 0x30D8, 0x3099, 0x30D8, 0x309A,
+    0x30DB, 0x3099, 0x30DB, 0x309A, 0x30A6, 0x3099, 0x30EF, 0x3099,
+    0x30F0, 0x3099, 0x30F1, 0x3099, 0x30F2, 0x3099, 0x30FD, 0x3099,
+    0xA641, 0xA643, 0xA645, 0xA647, 0xA649, 0xA64B, 0xA64D, 0xA64F,
+    0xA651, 0xA653, 0xA655, 0xA657, 0xA659, 0xA65B, 0xA65D, 0xA65F,
+    0xA661, 0xA663, 0xA665, 0xA667, 0xA669, 0xA66B, 0xA66D, 0xA681,
+    0xA683, 0xA685, 0xA687, 0xA689, 0xA68B, 0xA68D, 0xA68F, 0xA691,
+    0xA693, 0xA695, 0xA697, 0xA699, 0xA69B, 0xA723, 0xA725, 0xA727,
+    0xA729, 0xA72B, 0xA72D, 0xA72F, 0xA733, 0xA735, 0xA737, 0xA739,
+    0xA73B, 0xA73D, 0xA73F, 0xA741, 0xA743, 0xA745, 0xA747, 0xA749,
+    0xA74B, 0xA74D, 0xA74F, 0xA751, 0xA753, 0xA755, 0xA757, 0xA759,
+    0xA75B, 0xA75D, 0xA75F, 0xA761, 0xA763, 0xA765, 0xA767, 0xA769,
+    0xA76B, 0xA76D, 0xA76F, 0xA77A, 0xA77C, 0x1D79, 0xA77F, 0xA781,
+    0xA783, 0xA785, 0xA787, 0xA78C, 0x0265, 0xA791, 0xA793, 0xA797,
+    0xA799, 0xA79B, 0xA79D, 0xA79F, 0xA7A1, 0xA7A3, 0xA7A5, 0xA7A7,
+    0xA7A9, 0x0266, 0x025C, 0x0261, 0x026C, 0x026A, 0x029E, 0x0287,
+    0x029D, 0xAB53, 0xA7B5, 0xA7B7, 0xA7B9, 0xA7BB, 0xA7BD, 0xA7BF,
+    0xA7C1, 0xA7C3, 0xA794, 0x0282, 0x1D8E, 0xA7C8, 0xA7CA, 0xA7D1,
+    0xA7D7, 0xA7D9, 0xA7F6, 0x13A0, 0x13A1, 0x13A2, 0x13A3, 0x13A4,
+    0x13A5, 0x13A6, 0x13A7, 0x13A8, 0x13A9, 0x13AA, 0x13AB, 0x13AC,
+    0x13AD, 0x13AE, 0x13AF, 0x13B0, 0x13B1, 0x13B2, 0x13B3, 0x13B4,
+    0x13B5, 0x13B6, 0x13B7, 0x13B8, 0x13B9, 0x13BA, 0x13BB, 0x13BC,
+    0x13BD, 0x13BE, 0x13BF, 0x13C0, 0x13C1, 0x13C2, 0x13C3, 0x13C4,
+    0x13C5, 0x13C6, 0x13C7, 0x13C8, 0x13C9, 0x13CA, 0x13CB, 0x13CC,
+    0x13CD, 0x13CE, 0x13CF, 0x13D0, 0x13D1, 0x13D2, 0x13D3, 0x13D4,
+    0x13D5, 0x13D6, 0x13D7, 0x13D8, 0x13D9, 0x13DA, 0x13DB, 0x13DC,
+    0x13DD, 0x13DE, 0x13DF, 0x13E0, 0x13E1, 0x13E2, 0x13E3, 0x13E4,
+    0x13E5, 0x13E6, 0x13E7, 0x13E8, 0x13E9, 0x13EA, 0x13EB, 0x13EC,
+    0x13ED, 0x13EE, 0x13EF, 0x8C48, 0x66F4, 0x8ECA, 0x8CC8, 0x6ED1,
+    0x4E32, 0x53E5, 0x9F9C, 0x9F9C, 0x5951, 0x91D1, 0x5587, 0x5948,
+    0x61F6, 0x7669, 0x7F85, 0x863F, 0x87BA, 0x88F8, 0x908F, 0x6A02,
+    0x6D1B, 0x70D9, 0x73DE, 0x843D, 0x916A, 0x99F1, 0x4E82, 0x5375,
+    0x6B04, 0x721B, 0x862D, 0x9E1E, 0x5D50, 0x6FEB, 0x85CD, 0x8964,
+    0x62C9, 0x81D8, 0x881F, 0x5ECA, 0x6717, 0x6D6A, 0x72FC, 0x90CE,
+    0x4F86, 0x51B7, 0x52DE, 0x64C4, 0x6AD3, 0x7210, 0x76E7, 0x8001,
+    0x8606, 0x865C, 0x8DEF, 0x9732, 0x9B6F, 0x9DFA, 0x788C, 0x797F,
+    0x7DA0, 0x83C9, 0x9304, 0x9E7F, 0x8AD6, 0x58DF, 0x5F04, 0x7C60,
+    0x807E, 0x7262, 0x78CA, 0x8CC2, 0x96F7, 0x58D8, 0x5C62, 0x6A13,
+    0x6DDA, 0x6F0F, 0x7D2F, 0x7E37, 0x964B, 0x52D2, 0x808B, 0x51DC,
+    0x51CC, 0x7A1C, 0x7DBE, 0x83F1, 0x9675, 0x8B80, 0x62CF, 0x6A02,
+    0x8AFE, 0x4E39, 0x5BE7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78FB,
+    0x4FBF, 0x5FA9, 0x4E0D, 0x6CCC, 0x6578, 0x7D22, 0x53C3, 0x585E,
+    0x7701, 0x8449, 0x8AAA, 0x6BBA, 0x8FB0, 0x6C88, 0x62FE, 0x82E5,
+    0x63A0, 0x7565, 0x4EAE, 0x5169, 0x51C9, 0x6881, 0x7CE7, 0x826F,
+    0x8AD2, 0x91CF, 0x52F5, 0x5442, 0x5973, 0x5EEC, 0x65C5, 0x6FFE,
+    0x792A, 0x95AD, 0x9A6A, 0x9E97, 0x9ECE, 0x529B, 0x66C6, 0x6B77,
+    0x8F62, 0x5E74, 0x6190, 0x6200, 0x649A, 0x6F23, 0x7149, 0x7489,
+    0x79CA, 0x7DF4, 0x806F, 0x8F26, 0x84EE, 0x9023, 0x934A, 0x5217,
+    0x52A3, 0x54BD, 0x70C8, 0x88C2, 0x8AAA, 0x5EC9, 0x5FF5, 0x637B,
+    0x6BAE, 0x7C3E, 0x7375, 0x4EE4, 0x56F9, 0x5BE7, 0x5DBA, 0x601C,
+    0x73B2, 0x7469, 0x7F9A, 0x8046, 0x9234, 0x96F6, 0x9748, 0x9818,
+    0x4F8B, 0x79AE, 0x91B4, 0x96B8, 0x60E1, 0x4E86, 0x50DA, 0x5BEE,
+    0x5C3F, 0x6599, 0x6A02, 0x71CE, 0x7642, 0x84FC, 0x907C, 0x9F8D,
+    0x6688, 0x962E, 0x5289, 0x677B, 0x67F3, 0x6D41, 0x6E9C, 0x7409,
+    0x7559, 0x786B, 0x7D10, 0x985E, 0x516D, 0x622E, 0x9678, 0x502B,
+    0x5D19, 0x6DEA, 0x8F2A, 0x5F8B, 0x6144, 0x6817, 0x7387, 0x9686,
+    0x5229, 0x540F, 0x5C65, 0x6613, 0x674E, 0x68A8, 0x6CE5, 0x7406,
+    0x75E2, 0x7F79, 0x88CF, 0x88E1, 0x91CC, 0x96E2, 0x533F, 0x6EBA,
+    0x541D, 0x71D0, 0x7498, 0x85FA, 0x96A3, 0x9C57, 0x9E9F, 0x6797,
+    0x6DCB, 0x81E8, 0x7ACB, 0x7B20, 0x7C92, 0x72C0, 0x7099, 0x8B58,
+    0x4EC0, 0x8336, 0x523A, 0x5207, 0x5EA6, 0x62D3, 0x7CD6, 0x5B85,
+    0x6D1E, 0x66B4, 0x8F3B, 0x884C, 0x964D, 0x898B, 0x5ED3, 0x5140,
+    0x55C0, 0x585A, 0x6674, 0x51DE, 0x732A, 0x76CA, 0x793C, 0x795E,
+    0x7965, 0x798F, 0x9756, 0x7CBE, 0x7FBD, 0x8612, 0x8AF8, 0x9038,
+    0x90FD, 0x98EF, 0x98FC, 0x9928, 0x9DB4, 0x90DE, 0x96B7, 0x4FAE,
+    0x50E7, 0x514D, 0x52C9, 0x52E4, 0x5351, 0x559D, 0x5606, 0x5668,
+    0x5840, 0x58A8, 0x5C64, 0x5C6E, 0x6094, 0x6168, 0x618E, 0x61F2,
+    0x654F, 0x65E2, 0x6691, 0x6885, 0x6D77, 0x6E1A, 0x6F22, 0x716E,
+    0x722B, 0x7422, 0x7891, 0x793E, 0x7949, 0x7948, 0x7950, 0x7956,
+    0x795D, 0x798D, 0x798E, 0x7A40, 0x7A81, 0x7BC0, 0x7DF4, 0x7E09,
+    0x7E41, 0x7F72, 0x8005, 0x81ED, 0x8279, 0x8279, 0x8457, 0x8910,
+    0x8996, 0x8B01, 0x8B39, 0x8CD3, 0x8D08, 0x8FB6, 0x9038, 0x96E3,
+    0x97FF, 0x983B, 0x6075, 0x242EE, 0x8218, 0x4E26, 0x51B5, 0x5168,
+    0x4F80, 0x5145, 0x5180, 0x52C7, 0x52FA, 0x559D, 0x5555, 0x5599,
+    0x55E2, 0x585A, 0x58B3, 0x5944, 0x5954, 0x5A62, 0x5B28, 0x5ED2,
+    0x5ED9, 0x5F69, 0x5FAD, 0x60D8, 0x614E, 0x6108, 0x618E, 0x6160,
+    0x61F2, 0x6234, 0x63C4, 0x641C, 0x6452, 0x6556, 0x6674, 0x6717,
+    0x671B, 0x6756, 0x6B79, 0x6BBA, 0x6D41, 0x6EDB, 0x6ECB, 0x6F22,
+    0x701E, 0x716E, 0x77A7, 0x7235, 0x72AF, 0x732A, 0x7471, 0x7506,
+    0x753B, 0x761D, 0x761F, 0x76CA, 0x76DB, 0x76F4, 0x774A, 0x7740,
+    0x78CC, 0x7AB1, 0x7BC0, 0x7C7B, 0x7D5B, 0x7DF4, 0x7F3E, 0x8005,
+    0x8352, 0x83EF, 0x8779, 0x8941, 0x8986, 0x8996, 0x8ABF, 0x8AF8,
+    0x8ACB, 0x8B01, 0x8AFE, 0x8AED, 0x8B39, 0x8B8A, 0x8D08, 0x8F38,
+    0x9072, 0x9199, 0x9276, 0x967C, 0x96E3, 0x9756, 0x97DB, 0x97FF,
+    0x980B, 0x983B, 0x9B12, 0x9F9C, 0x2284A, 0x22844, 0x233D5, 0x3B9D,
+    0x4018, 0x4039, 0x25249, 0x25CD0, 0x27ED3, 0x9F43, 0x9F8E, 0x0066,
+    0x0066, 0x0066, 0x0069, 0x0066, 0x006C, 0x0066, 0x0066, 0x0069,
+    0x0066, 0x0066, 0x006C, 0x0073, 0x0074, 0x0073, 0x0074, 0x0574,
+    0x0576, 0x0574, 0x0565, 0x0574, 0x056B, 0x057E, 0x0576, 0x0574,
+    0x056D, 0x05D9, 0x05B4, 0x05F2, 0x05B7, 0x05E9, 0x05C1, 0x05E9,
+    0x05C2, 0x05E9, 0x05BC, 0x05C1, 0x05E9, 0x05BC, 0x05C2, 0x05D0,
+    0x05B7, 0x05D0, 0x05B8, 0x05D0, 0x05BC, 0x05D1, 0x05BC, 0x05D2,
+    0x05BC, 0x05D3, 0x05BC, 0x05D4, 0x05BC, 0x05D5, 0x05BC, 0x05D6,
+    0x05BC, 0x05D8, 0x05BC, 0x05D9, 0x05BC, 0x05DA, 0x05BC, 0x05DB,
+    0x05BC, 0x05DC, 0x05BC, 0x05DE, 0x05BC, 0x05E0, 0x05BC, 0x05E1,
+    0x05BC, 0x05E3, 0x05BC, 0x05E4, 0x05BC, 0x05E6, 0x05BC, 0x05E7,
+    0x05BC, 0x05E8, 0x05BC, 0x05E9, 0x05BC, 0x05EA, 0x05BC, 0x05D5,
+    0x05B9, 0x05D1, 0x05BF, 0x05DB, 0x05BF, 0x05E4, 0x05BF, 0xFF41,
+    0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49,
+    0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51,
+    0xFF52, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59,
+    0xFF5A, 0x10428, 0x10429, 0x1042A, 0x1042B, 0x1042C, 0x1042D, 0x1042E,
+    0x1042F, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434, 0x10435, 0x10436,
+    0x10437, 0x10438, 0x10439, 0x1043A, 0x1043B, 0x1043C, 0x1043D, 0x1043E,
+    0x1043F, 0x10440, 0x10441, 0x10442, 0x10443, 0x10444, 0x10445, 0x10446,
+    0x10447, 0x10448, 0x10449, 0x1044A, 0x1044B, 0x1044C, 0x1044D, 0x1044E,
+    0x1044F, 0x104D8, 0x104D9, 0x104DA, 0x104DB, 0x104DC, 0x104DD, 0x104DE,
+    0x104DF, 0x104E0, 0x104E1, 0x104E2, 0x104E3, 0x104E4, 0x104E5, 0x104E6,
+    0x104E7, 0x104E8, 0x104E9, 0x104EA, 0x104EB, 0x104EC, 0x104ED, 0x104EE,
+    0x104EF, 0x104F0, 0x104F1, 0x104F2, 0x104F3, 0x104F4, 0x104F5, 0x104F6,
+    0x104F7, 0x104F8, 0x104F9, 0x104FA, 0x104FB, 0x10597, 0x10598, 0x10599,
+    0x1059A, 0x1059B, 0x1059C, 0x1059D, 0x1059E, 0x1059F, 0x105A0, 0x105A1,
+    0x105A3, 0x105A4, 0x105A5, 0x105A6, 0x105A7, 0x105A8, 0x105A9, 0x105AA,
+    0x105AB, 0x105AC, 0x105AD, 0x105AE, 0x105AF, 0x105B0, 0x105B1, 0x105B3,
+    0x105B4, 0x105B5, 0x105B6, 0x105B7, 0x105B8, 0x105B9, 0x105BB, 0x105BC,
+    0x10CC0, 0x10CC1, 0x10CC2, 0x10CC3, 0x10CC4, 0x10CC5, 0x10CC6, 0x10CC7,
+    0x10CC8, 0x10CC9, 0x10CCA, 0x10CCB, 0x10CCC, 0x10CCD, 0x10CCE, 0x10CCF,
+    0x10CD0, 0x10CD1, 0x10CD2, 0x10CD3, 0x10CD4, 0x10CD5, 0x10CD6, 0x10CD7,
+    0x10CD8, 0x10CD9, 0x10CDA, 0x10CDB, 0x10CDC, 0x10CDD, 0x10CDE, 0x10CDF,
+    0x10CE0, 0x10CE1, 0x10CE2, 0x10CE3, 0x10CE4, 0x10CE5, 0x10CE6, 0x10CE7,
+    0x10CE8, 0x10CE9, 0x10CEA, 0x10CEB, 0x10CEC, 0x10CED, 0x10CEE, 0x10CEF,
+    0x10CF0, 0x10CF1, 0x10CF2, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+    0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+    0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+    0x115AF, 0x115B9, 0x115AF, 0x118C0, 0x118C1, 0x118C2, 0x118C3, 0x118C4,
+    0x118C5, 0x118C6, 0x118C7, 0x118C8, 0x118C9, 0x118CA, 0x118CB, 0x118CC,
+    0x118CD, 0x118CE, 0x118CF, 0x118D0, 0x118D1, 0x118D2, 0x118D3, 0x118D4,
+    0x118D5, 0x118D6, 0x118D7, 0x118D8, 0x118D9, 0x118DA, 0x118DB, 0x118DC,
+    0x118DD, 0x118DE, 0x118DF, 0x11935, 0x11930, 0x16E60, 0x16E61, 0x16E62,
+    0x16E63, 0x16E64, 0x16E65, 0x16E66, 0x16E67, 0x16E68, 0x16E69, 0x16E6A,
+    0x16E6B, 0x16E6C, 0x16E6D, 0x16E6E, 0x16E6F, 0x16E70, 0x16E71, 0x16E72,
+    0x16E73, 0x16E74, 0x16E75, 0x16E76, 0x16E77, 0x16E78, 0x16E79, 0x16E7A,
+    0x16E7B, 0x16E7C, 0x16E7D, 0x16E7E, 0x16E7F, 0x1D157, 0x1D165, 0x1D158,
+    0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+    0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+    0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+    0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+    0x1E922, 0x1E923, 0x1E924, 0x1E925, 0x1E926, 0x1E927, 0x1E928, 0x1E929,
+    0x1E92A, 0x1E92B, 0x1E92C, 0x1E92D, 0x1E92E, 0x1E92F, 0x1E930, 0x1E931,
+    0x1E932, 0x1E933, 0x1E934, 0x1E935, 0x1E936, 0x1E937, 0x1E938, 0x1E939,
+    0x1E93A, 0x1E93B, 0x1E93C, 0x1E93D, 0x1E93E, 0x1E93F, 0x1E940, 0x1E941,
+    0x1E942, 0x1E943, 0x4E3D, 0x4E38, 0x4E41, 0x20122, 0x4F60, 0x4FAE,
+    0x4FBB, 0x5002, 0x507A, 0x5099, 0x50E7, 0x50CF, 0x349E, 0x2063A,
+    0x514D, 0x5154, 0x5164, 0x5177, 0x2051C, 0x34B9, 0x5167, 0x518D,
+    0x2054B, 0x5197, 0x51A4, 0x4ECC, 0x51AC, 0x51B5, 0x291DF, 0x51F5,
+    0x5203, 0x34DF, 0x523B, 0x5246, 0x5272, 0x5277, 0x3515, 0x52C7,
+    0x52C9, 0x52E4, 0x52FA, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351,
+    0x535A, 0x5373, 0x537D, 0x537F, 0x537F, 0x537F, 0x20A2C, 0x7070,
+    0x53CA, 0x53DF, 0x20B63, 0x53EB, 0x53F1, 0x5406, 0x549E, 0x5438,
+    0x5448, 0x5468, 0x54A2, 0x54F6, 0x5510, 0x5553, 0x5563, 0x5584,
+    0x5584, 0x5599, 0x55AB, 0x55B3, 0x55C2, 0x5716, 0x5606, 0x5717,
+    0x5651, 0x5674, 0x5207, 0x58EE, 0x57CE, 0x57F4, 0x580D, 0x578B,
+    0x5832, 0x5831, 0x58AC, 0x214E4, 0x58F2, 0x58F7, 0x5906, 0x591A,
+    0x5922, 0x5962, 0x216A8, 0x216EA, 0x59EC, 0x5A1B, 0x5A27, 0x59D8,
+    0x5A66, 0x36EE, 0x36FC, 0x5B08, 0x5B3E, 0x5B3E, 0x219C8, 0x5BC3,
+    0x5BD8, 0x5BE7, 0x5BF3, 0x21B18, 0x5BFF, 0x5C06, 0x5F53, 0x5C22,
+    0x3781, 0x5C60, 0x5C6E, 0x5CC0, 0x5C8D, 0x21DE4, 0x5D43, 0x21DE6,
+    0x5D6E, 0x5D6B, 0x5D7C, 0x5DE1, 0x5DE2, 0x382F, 0x5DFD, 0x5E28,
+    0x5E3D, 0x5E69, 0x3862, 0x22183, 0x387C, 0x5EB0, 0x5EB3, 0x5EB6,
+    0x5ECA, 0x2A392, 0x5EFE, 0x22331, 0x22331, 0x8201, 0x5F22, 0x5F22,
+    0x38C7, 0x232B8, 0x261DA, 0x5F62, 0x5F6B, 0x38E3, 0x5F9A, 0x5FCD,
+    0x5FD7, 0x5FF9, 0x6081, 0x393A, 0x391C, 0x6094, 0x226D4, 0x60C7,
+    0x6148, 0x614C, 0x614E, 0x614C, 0x617A, 0x618E, 0x61B2, 0x61A4,
+    0x61AF, 0x61DE, 0x61F2, 0x61F6, 0x6210, 0x621B, 0x625D, 0x62B1,
+    0x62D4, 0x6350, 0x22B0C, 0x633D, 0x62FC, 0x6368, 0x6383, 0x63E4,
+    0x22BF1, 0x6422, 0x63C5, 0x63A9, 0x3A2E, 0x6469, 0x647E, 0x649D,
+    0x6477, 0x3A6C, 0x654F, 0x656C, 0x2300A, 0x65E3, 0x66F8, 0x6649,
+    0x3B19, 0x6691, 0x3B08, 0x3AE4, 0x5192, 0x5195, 0x6700, 0x669C,
+    0x80AD, 0x43D9, 0x6717, 0x671B, 0x6721, 0x675E, 0x6753, 0x233C3,
+    0x3B49, 0x67FA, 0x6785, 0x6852, 0x6885, 0x2346D, 0x688E, 0x681F,
+    0x6914, 0x3B9D, 0x6942, 0x69A3, 0x69EA, 0x6AA8, 0x236A3, 0x6ADB,
+    0x3C18, 0x6B21, 0x238A7, 0x6B54, 0x3C4E, 0x6B72, 0x6B9F, 0x6BBA,
+    0x6BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x6C4E, 0x23CBC, 0x6CBF, 0x6CCD,
+    0x6C67, 0x6D16, 0x6D3E, 0x6D77, 0x6D41, 0x6D69, 0x6D78, 0x6D85,
+    0x23D1E, 0x6D34, 0x6E2F, 0x6E6E, 0x3D33, 0x6ECB, 0x6EC7, 0x23ED1,
+    0x6DF9, 0x6F6E, 0x23F5E, 0x23F8E, 0x6FC6, 0x7039, 0x701E, 0x701B,
+    0x3D96, 0x704A, 0x707D, 0x7077, 0x70AD, 0x20525, 0x7145, 0x24263,
+    0x719C, 0x243AB, 0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295,
+    0x24735, 0x24814, 0x737A, 0x738B, 0x3EAC, 0x73A5, 0x3EB8, 0x3EB8,
+    0x7447, 0x745C, 0x7471, 0x7485, 0x74CA, 0x3F1B, 0x7524, 0x24C36,
+    0x753E, 0x24C92, 0x7570, 0x2219F, 0x7610, 0x24FA1, 0x24FB8, 0x25044,
+    0x3FFC, 0x4008, 0x76F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x771E,
+    0x771F, 0x771F, 0x774A, 0x4039, 0x778B, 0x4046, 0x4096, 0x2541D,
+    0x784E, 0x788C, 0x78CC, 0x40E3, 0x25626, 0x7956, 0x2569A, 0x256C5,
+    0x798F, 0x79EB, 0x412F, 0x7A40, 0x7A4A, 0x7A4F, 0x2597C, 0x25AA7,
+    0x25AA7, 0x7AEE, 0x4202, 0x25BAB, 0x7BC6, 0x7BC9, 0x4227, 0x25C80,
+    0x7CD2, 0x42A0, 0x7CE8, 0x7CE3, 0x7D00, 0x25F86, 0x7D63, 0x4301,
+    0x7DC7, 0x7E02, 0x7E45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262D9,
+    0x7F7A, 0x2633E, 0x7F95, 0x7FFA, 0x8005, 0x264DA, 0x26523, 0x8060,
+    0x265A8, 0x8070, 0x2335F, 0x43D5, 0x80B2, 0x8103, 0x440B, 0x813E,
+    0x5AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x8201, 0x8204, 0x8F9E,
+    0x446B, 0x8291, 0x828B, 0x829D, 0x52B3, 0x82B1, 0x82B3, 0x82BD,
+    0x82E6, 0x26B3C, 0x82E5, 0x831D, 0x8363, 0x83AD, 0x8323, 0x83BD,
+    0x83E7, 0x8457, 0x8353, 0x83CA, 0x83CC, 0x83DC, 0x26C36, 0x26D6B,
+    0x26CD5, 0x452B, 0x84F1, 0x84F3, 0x8516, 0x273CA, 0x8564, 0x26F2C,
+    0x455D, 0x4561, 0x26FB1, 0x270D2, 0x456B, 0x8650, 0x865C, 0x8667,
+    0x8669, 0x86A9, 0x8688, 0x870E, 0x86E2, 0x8779, 0x8728, 0x876B,
+    0x8786, 0x45D7, 0x87E1, 0x8801, 0x45F9, 0x8860, 0x8863, 0x27667,
+    0x88D7, 0x88DE, 0x4635, 0x88FA, 0x34BB, 0x278AE, 0x27966, 0x46BE,
+    0x46C7, 0x8AA0, 0x8AED, 0x8B8A, 0x8C55, 0x27CA8, 0x8CAB, 0x8CC1,
+    0x8D1B, 0x8D77, 0x27F2F, 0x20804, 0x8DCB, 0x8DBC, 0x8DF0, 0x208DE,
+    0x8ED4, 0x8F38, 0x285D2, 0x285ED, 0x9094, 0x90F1, 0x9111, 0x2872E,
+    0x911B, 0x9238, 0x92D7, 0x92D8, 0x927C, 0x93F9, 0x9415, 0x28BFA,
+    0x958B, 0x4995, 0x95B7, 0x28D77, 0x49E6, 0x96C3, 0x5DB2, 0x9723,
+    0x29145, 0x2921A, 0x4A6E, 0x4A76, 0x97E0, 0x2940A, 0x4AB2, 0x29496,
+    0x980B, 0x980B, 0x9829, 0x295B6, 0x98E2, 0x4B33, 0x9929, 0x99A7,
+    0x99C2, 0x99FE, 0x4BCE, 0x29B30, 0x9B12, 0x9C40, 0x9CFD, 0x4CCE,
+    0x4CED, 0x9D67, 0x2A0CE, 0x4CF8, 0x2A105, 0x2A20E, 0x2A291, 0x9EBB,
+    0x4D56, 0x9EF9, 0x9EFE, 0x9F05, 0x9F0F, 0x9F16, 0x9F3B, 0x2A600,
+};
+
+static const FoldEntry fold_table[3124] = {
+    { 0x00B5, 0, 1 },
+    { 0x00C0, 1, 2 },
+    { 0x00C1, 3, 2 },
+    { 0x00C2, 5, 2 },
+    { 0x00C3, 7, 2 },
+    { 0x00C4, 9, 2 },
+    { 0x00C5, 11, 2 },
+    { 0x00C6, 13, 1 },
+    { 0x00C7, 14, 2 },
+    { 0x00C8, 16, 2 },
+    { 0x00C9, 18, 2 },
+    { 0x00CA, 20, 2 },
+    { 0x00CB, 22, 2 },
+    { 0x00CC, 24, 2 },
+    { 0x00CD, 26, 2 },
+    { 0x00CE, 28, 2 },
+    { 0x00CF, 30, 2 },
+    { 0x00D0, 32, 1 },
+    { 0x00D1, 33, 2 },
+    { 0x00D2, 35, 2 },
+    { 0x00D3, 37, 2 },
+    { 0x00D4, 39, 2 },
+    { 0x00D5, 41, 2 },
+    { 0x00D6, 43, 2 },
+    { 0x00D8, 45, 1 },
+    { 0x00D9, 46, 2 },
+    { 0x00DA, 48, 2 },
+    { 0x00DB, 50, 2 },
+    { 0x00DC, 52, 2 },
+    { 0x00DD, 54, 2 },
+    { 0x00DE, 56, 1 },
+    { 0x00DF, 57, 2 },
+    { 0x00E0, 59, 2 },
+    { 0x00E1, 61, 2 },
+    { 0x00E2, 63, 2 },
+    { 0x00E3, 65, 2 },
+    { 0x00E4, 67, 2 },
+    { 0x00E5, 69, 2 },
+    { 0x00E7, 71, 2 },
+    { 0x00E8, 73, 2 },
+    { 0x00E9, 75, 2 },
+    { 0x00EA, 77, 2 },
+    { 0x00EB, 79, 2 },
+    { 0x00EC, 81, 2 },
+    { 0x00ED, 83, 2 },
+    { 0x00EE, 85, 2 },
+    { 0x00EF, 87, 2 },
+    { 0x00F1, 89, 2 },
+    { 0x00F2, 91, 2 },
+    { 0x00F3, 93, 2 },
+    { 0x00F4, 95, 2 },
+    { 0x00F5, 97, 2 },
+    { 0x00F6, 99, 2 },
+    { 0x00F9, 101, 2 },
+    { 0x00FA, 103, 2 },
+    { 0x00FB, 105, 2 },
+    { 0x00FC, 107, 2 },
+    { 0x00FD, 109, 2 },
+    { 0x00FF, 111, 2 },
+    { 0x0100, 113, 2 },
+    { 0x0101, 115, 2 },
+    { 0x0102, 117, 2 },
+    { 0x0103, 119, 2 },
+    { 0x0104, 121, 2 },
+    { 0x0105, 123, 2 },
+    { 0x0106, 125, 2 },
+    { 0x0107, 127, 2 },
+    { 0x0108, 129, 2 },
+    { 0x0109, 131, 2 },
+    { 0x010A, 133, 2 },
+    { 0x010B, 135, 2 },
+    { 0x010C, 137, 2 },
+    { 0x010D, 139, 2 },
+    { 0x010E, 141, 2 },
+    { 0x010F, 143, 2 },
+    { 0x0110, 145, 1 },
+    { 0x0112, 146, 2 },
+    { 0x0113, 148, 2 },
+    { 0x0114, 150, 2 },
+    { 0x0115, 152, 2 },
+    { 0x0116, 154, 2 },
+    { 0x0117, 156, 2 },
+    { 0x0118, 158, 2 },
+    { 0x0119, 160, 2 },
+    { 0x011A, 162, 2 },
+    { 0x011B, 164, 2 },
+    { 0x011C, 166, 2 },
+    { 0x011D, 168, 2 },
+    { 0x011E, 170, 2 },
+    { 0x011F, 172, 2 },
+    { 0x0120, 174, 2 },
+    { 0x0121, 176, 2 },
+    { 0x0122, 178, 2 },
+    { 0x0123, 180, 2 },
+    { 0x0124, 182, 2 },
+    { 0x0125, 184, 2 },
+    { 0x0126, 186, 1 },
+    { 0x0128, 187, 2 },
+    { 0x0129, 189, 2 },
+    { 0x012A, 191, 2 },
+    { 0x012B, 193, 2 },
+    { 0x012C, 195, 2 },
+    { 0x012D, 197, 2 },
+    { 0x012E, 199, 2 },
+    { 0x012F, 201, 2 },
+    { 0x0130, 203, 2 },
+    { 0x0132, 205, 1 },
+    { 0x0134, 206, 2 },
+    { 0x0135, 208, 2 },
+    { 0x0136, 210, 2 },
+    { 0x0137, 212, 2 },
+    { 0x0139, 214, 2 },
+    { 0x013A, 216, 2 },
+    { 0x013B, 218, 2 },
+    { 0x013C, 220, 2 },
+    { 0x013D, 222, 2 },
+    { 0x013E, 224, 2 },
+    { 0x013F, 226, 1 },
+    { 0x0141, 227, 1 },
+    { 0x0143, 228, 2 },
+    { 0x0144, 230, 2 },
+    { 0x0145, 232, 2 },
+    { 0x0146, 234, 2 },
+    { 0x0147, 236, 2 },
+    { 0x0148, 238, 2 },
+    { 0x0149, 240, 2 },
+    { 0x014A, 242, 1 },
+    { 0x014C, 243, 2 },
+    { 0x014D, 245, 2 },
+    { 0x014E, 247, 2 },
+    { 0x014F, 249, 2 },
+    { 0x0150, 251, 2 },
+    { 0x0151, 253, 2 },
+    { 0x0152, 255, 1 },
+    { 0x0154, 256, 2 },
+    { 0x0155, 258, 2 },
+    { 0x0156, 260, 2 },
+    { 0x0157, 262, 2 },
+    { 0x0158, 264, 2 },
+    { 0x0159, 266, 2 },
+    { 0x015A, 268, 2 },
+    { 0x015B, 270, 2 },
+    { 0x015C, 272, 2 },
+    { 0x015D, 274, 2 },
+    { 0x015E, 276, 2 },
+    { 0x015F, 278, 2 },
+    { 0x0160, 280, 2 },
+    { 0x0161, 282, 2 },
+    { 0x0162, 284, 2 },
+    { 0x0163, 286, 2 },
+    { 0x0164, 288, 2 },
+    { 0x0165, 290, 2 },
+    { 0x0166, 292, 1 },
+    { 0x0168, 293, 2 },
+    { 0x0169, 295, 2 },
+    { 0x016A, 297, 2 },
+    { 0x016B, 299, 2 },
+    { 0x016C, 301, 2 },
+    { 0x016D, 303, 2 },
+    { 0x016E, 305, 2 },
+    { 0x016F, 307, 2 },
+    { 0x0170, 309, 2 },
+    { 0x0171, 311, 2 },
+    { 0x0172, 313, 2 },
+    { 0x0173, 315, 2 },
+    { 0x0174, 317, 2 },
+    { 0x0175, 319, 2 },
+    { 0x0176, 321, 2 },
+    { 0x0177, 323, 2 },
+    { 0x0178, 325, 2 },
+    { 0x0179, 327, 2 },
+    { 0x017A, 329, 2 },
+    { 0x017B, 331, 2 },
+    { 0x017C, 333, 2 },
+    { 0x017D, 335, 2 },
+    { 0x017E, 337, 2 },
+    { 0x017F, 339, 1 },
+    { 0x0181, 340, 1 },
+    { 0x0182, 341, 1 },
+    { 0x0184, 342, 1 },
+    { 0x0186, 343, 1 },
+    { 0x0187, 344, 1 },
+    { 0x0189, 345, 1 },
+    { 0x018A, 346, 1 },
+    { 0x018B, 347, 1 },
+    { 0x018E, 348, 1 },
+    { 0x018F, 349, 1 },
+    { 0x0190, 350, 1 },
+    { 0x0191, 351, 1 },
+    { 0x0193, 352, 1 },
+    { 0x0194, 353, 1 },
+    { 0x0196, 354, 1 },
+    { 0x0197, 355, 1 },
+    { 0x0198, 356, 1 },
+    { 0x019C, 357, 1 },
+    { 0x019D, 358, 1 },
+    { 0x019F, 359, 1 },
+    { 0x01A0, 360, 2 },
+    { 0x01A1, 362, 2 },
+    { 0x01A2, 364, 1 },
+    { 0x01A4, 365, 1 },
+    { 0x01A6, 366, 1 },
+    { 0x01A7, 367, 1 },
+    { 0x01A9, 368, 1 },
+    { 0x01AC, 369, 1 },
+    { 0x01AE, 370, 1 },
+    { 0x01AF, 371, 2 },
+    { 0x01B0, 373, 2 },
+    { 0x01B1, 375, 1 },
+    { 0x01B2, 376, 1 },
+    { 0x01B3, 377, 1 },
+    { 0x01B5, 378, 1 },
+    { 0x01B7, 379, 1 },
+    { 0x01B8, 380, 1 },
+    { 0x01BC, 381, 1 },
+    { 0x01C4, 382, 1 },
+    { 0x01C5, 383, 1 },
+    { 0x01C7, 384, 1 },
+    { 0x01C8, 385, 1 },
+    { 0x01CA, 386, 1 },
+    { 0x01CB, 387, 1 },
+    { 0x01CD, 388, 2 },
+    { 0x01CE, 390, 2 },
+    { 0x01CF, 392, 2 },
+    { 0x01D0, 394, 2 },
+    { 0x01D1, 396, 2 },
+    { 0x01D2, 398, 2 },
+    { 0x01D3, 400, 2 },
+    { 0x01D4, 402, 2 },
+    { 0x01D5, 404, 3 },
+    { 0x01D6, 407, 3 },
+    { 0x01D7, 410, 3 },
+    { 0x01D8, 413, 3 },
+    { 0x01D9, 416, 3 },
+    { 0x01DA, 419, 3 },
+    { 0x01DB, 422, 3 },
+    { 0x01DC, 425, 3 },
+    { 0x01DE, 428, 3 },
+    { 0x01DF, 431, 3 },
+    { 0x01E0, 434, 3 },
+    { 0x01E1, 437, 3 },
+    { 0x01E2, 440, 2 },
+    { 0x01E3, 442, 2 },
+    { 0x01E4, 444, 1 },
+    { 0x01E6, 445, 2 },
+    { 0x01E7, 447, 2 },
+    { 0x01E8, 449, 2 },
+    { 0x01E9, 451, 2 },
+    { 0x01EA, 453, 2 },
+    { 0x01EB, 455, 2 },
+    { 0x01EC, 457, 3 },
+    { 0x01ED, 460, 3 },
+    { 0x01EE, 463, 2 },
+    { 0x01EF, 465, 2 },
+    { 0x01F0, 467, 2 },
+    { 0x01F1, 469, 1 },
+    { 0x01F2, 470, 1 },
+    { 0x01F4, 471, 2 },
+    { 0x01F5, 473, 2 },
+    { 0x01F6, 475, 1 },
+    { 0x01F7, 476, 1 },
+    { 0x01F8, 477, 2 },
+    { 0x01F9, 479, 2 },
+    { 0x01FA, 481, 3 },
+    { 0x01FB, 484, 3 },
+    { 0x01FC, 487, 2 },
+    { 0x01FD, 489, 2 },
+    { 0x01FE, 491, 2 },
+    { 0x01FF, 493, 2 },
+    { 0x0200, 495, 2 },
+    { 0x0201, 497, 2 },
+    { 0x0202, 499, 2 },
+    { 0x0203, 501, 2 },
+    { 0x0204, 503, 2 },
+    { 0x0205, 505, 2 },
+    { 0x0206, 507, 2 },
+    { 0x0207, 509, 2 },
+    { 0x0208, 511, 2 },
+    { 0x0209, 513, 2 },
+    { 0x020A, 515, 2 },
+    { 0x020B, 517, 2 },
+    { 0x020C, 519, 2 },
+    { 0x020D, 521, 2 },
+    { 0x020E, 523, 2 },
+    { 0x020F, 525, 2 },
+    { 0x0210, 527, 2 },
+    { 0x0211, 529, 2 },
+    { 0x0212, 531, 2 },
+    { 0x0213, 533, 2 },
+    { 0x0214, 535, 2 },
+    { 0x0215, 537, 2 },
+    { 0x0216, 539, 2 },
+    { 0x0217, 541, 2 },
+    { 0x0218, 543, 2 },
+    { 0x0219, 545, 2 },
+    { 0x021A, 547, 2 },
+    { 0x021B, 549, 2 },
+    { 0x021C, 551, 1 },
+    { 0x021E, 552, 2 },
+    { 0x021F, 554, 2 },
+    { 0x0220, 556, 1 },
+    { 0x0222, 557, 1 },
+    { 0x0224, 558, 1 },
+    { 0x0226, 559, 2 },
+    { 0x0227, 561, 2 },
+    { 0x0228, 563, 2 },
+    { 0x0229, 565, 2 },
+    { 0x022A, 567, 3 },
+    { 0x022B, 570, 3 },
+    { 0x022C, 573, 3 },
+    { 0x022D, 576, 3 },
+    { 0x022E, 579, 2 },
+    { 0x022F, 581, 2 },
+    { 0x0230, 583, 3 },
+    { 0x0231, 586, 3 },
+    { 0x0232, 589, 2 },
+    { 0x0233, 591, 2 },
+    { 0x023A, 593, 1 },
+    { 0x023B, 594, 1 },
+    { 0x023D, 595, 1 },
+    { 0x023E, 596, 1 },
+    { 0x0241, 597, 1 },
+    { 0x0243, 598, 1 },
+    { 0x0244, 599, 1 },
+    { 0x0245, 600, 1 },
+    { 0x0246, 601, 1 },
+    { 0x0248, 602, 1 },
+    { 0x024A, 603, 1 },
+    { 0x024C, 604, 1 },
+    { 0x024E, 605, 1 },
+    { 0x0340, 606, 1 },
+    { 0x0341, 607, 1 },
+    { 0x0343, 608, 1 },
+    { 0x0344, 609, 2 },
+    { 0x0345, 611, 1 },
+    { 0x0370, 612, 1 },
+    { 0x0372, 613, 1 },
+    { 0x0374, 614, 1 },
+    { 0x0376, 615, 1 },
+    { 0x037E, 616, 1 },
+    { 0x037F, 617, 1 },
+    { 0x0385, 618, 2 },
+    { 0x0386, 620, 2 },
+    { 0x0387, 622, 1 },
+    { 0x0388, 623, 2 },
+    { 0x0389, 625, 2 },
+    { 0x038A, 627, 2 },
+    { 0x038C, 629, 2 },
+    { 0x038E, 631, 2 },
+    { 0x038F, 633, 2 },
+    { 0x0390, 635, 3 },
+    { 0x0391, 638, 1 },
+    { 0x0392, 639, 1 },
+    { 0x0393, 640, 1 },
+    { 0x0394, 641, 1 },
+    { 0x0395, 642, 1 },
+    { 0x0396, 643, 1 },
+    { 0x0397, 644, 1 },
+    { 0x0398, 645, 1 },
+    { 0x0399, 646, 1 },
+    { 0x039A, 647, 1 },
+    { 0x039B, 648, 1 },
+    { 0x039C, 649, 1 },
+    { 0x039D, 650, 1 },
+    { 0x039E, 651, 1 },
+    { 0x039F, 652, 1 },
+    { 0x03A0, 653, 1 },
+    { 0x03A1, 654, 1 },
+    { 0x03A3, 655, 1 },
+    { 0x03A4, 656, 1 },
+    { 0x03A5, 657, 1 },
+    { 0x03A6, 658, 1 },
+    { 0x03A7, 659, 1 },
+    { 0x03A8, 660, 1 },
+    { 0x03A9, 661, 1 },
+    { 0x03AA, 662, 2 },
+    { 0x03AB, 664, 2 },
+    { 0x03AC, 666, 2 },
+    { 0x03AD, 668, 2 },
+    { 0x03AE, 670, 2 },
+    { 0x03AF, 672, 2 },
+    { 0x03B0, 674, 3 },
+    { 0x03C2, 677, 1 },
+    { 0x03CA, 678, 2 },
+    { 0x03CB, 680, 2 },
+    { 0x03CC, 682, 2 },
+    { 0x03CD, 684, 2 },
+    { 0x03CE, 686, 2 },
+    { 0x03CF, 688, 1 },
+    { 0x03D0, 689, 1 },
+    { 0x03D1, 690, 1 },
+    { 0x03D3, 691, 2 },
+    { 0x03D4, 693, 2 },
+    { 0x03D5, 695, 1 },
+    { 0x03D6, 696, 1 },
+    { 0x03D8, 697, 1 },
+    { 0x03DA, 698, 1 },
+    { 0x03DC, 699, 1 },
+    { 0x03DE, 700, 1 },
+    { 0x03E0, 701, 1 },
+    { 0x03E2, 702, 1 },
+    { 0x03E4, 703, 1 },
+    { 0x03E6, 704, 1 },
+    { 0x03E8, 705, 1 },
+    { 0x03EA, 706, 1 },
+    { 0x03EC, 707, 1 },
+    { 0x03EE, 708, 1 },
+    { 0x03F0, 709, 1 },
+    { 0x03F1, 710, 1 },
+    { 0x03F4, 711, 1 },
+    { 0x03F5, 712, 1 },
+    { 0x03F7, 713, 1 },
+    { 0x03F9, 714, 1 },
+    { 0x03FA, 715, 1 },
+    { 0x03FD, 716, 1 },
+    { 0x03FE, 717, 1 },
+    { 0x03FF, 718, 1 },
+    { 0x0400, 719, 2 },
+    { 0x0401, 721, 2 },
+    { 0x0402, 723, 1 },
+    { 0x0403, 724, 2 },
+    { 0x0404, 726, 1 },
+    { 0x0405, 727, 1 },
+    { 0x0406, 728, 1 },
+    { 0x0407, 729, 2 },
+    { 0x0408, 731, 1 },
+    { 0x0409, 732, 1 },
+    { 0x040A, 733, 1 },
+    { 0x040B, 734, 1 },
+    { 0x040C, 735, 2 },
+    { 0x040D, 737, 2 },
+    { 0x040E, 739, 2 },
+    { 0x040F, 741, 1 },
+    { 0x0410, 742, 1 },
+    { 0x0411, 743, 1 },
+    { 0x0412, 744, 1 },
+    { 0x0413, 745, 1 },
+    { 0x0414, 746, 1 },
+    { 0x0415, 747, 1 },
+    { 0x0416, 748, 1 },
+    { 0x0417, 749, 1 },
+    { 0x0418, 750, 1 },
+    { 0x0419, 751, 2 },
+    { 0x041A, 753, 1 },
+    { 0x041B, 754, 1 },
+    { 0x041C, 755, 1 },
+    { 0x041D, 756, 1 },
+    { 0x041E, 757, 1 },
+    { 0x041F, 758, 1 },
+    { 0x0420, 759, 1 },
+    { 0x0421, 760, 1 },
+    { 0x0422, 761, 1 },
+    { 0x0423, 762, 1 },
+    { 0x0424, 763, 1 },
+    { 0x0425, 764, 1 },
+    { 0x0426, 765, 1 },
+    { 0x0427, 766, 1 },
+    { 0x0428, 767, 1 },
+    { 0x0429, 768, 1 },
+    { 0x042A, 769, 1 },
+    { 0x042B, 770, 1 },
+    { 0x042C, 771, 1 },
+    { 0x042D, 772, 1 },
+    { 0x042E, 773, 1 },
+    { 0x042F, 774, 1 },
+    { 0x0439, 775, 2 },
+    { 0x0450, 777, 2 },
+    { 0x0451, 779, 2 },
+    { 0x0453, 781, 2 },
+    { 0x0457, 783, 2 },
+    { 0x045C, 785, 2 },
+    { 0x045D, 787, 2 },
+    { 0x045E, 789, 2 },
+    { 0x0460, 791, 1 },
+    { 0x0462, 792, 1 },
+    { 0x0464, 793, 1 },
+    { 0x0466, 794, 1 },
+    { 0x0468, 795, 1 },
+    { 0x046A, 796, 1 },
+    { 0x046C, 797, 1 },
+    { 0x046E, 798, 1 },
+    { 0x0470, 799, 1 },
+    { 0x0472, 800, 1 },
+    { 0x0474, 801, 1 },
+    { 0x0476, 802, 2 },
+    { 0x0477, 804, 2 },
+    { 0x0478, 806, 1 },
+    { 0x047A, 807, 1 },
+    { 0x047C, 808, 1 },
+    { 0x047E, 809, 1 },
+    { 0x0480, 810, 1 },
+    { 0x048A, 811, 1 },
+    { 0x048C, 812, 1 },
+    { 0x048E, 813, 1 },
+    { 0x0490, 814, 1 },
+    { 0x0492, 815, 1 },
+    { 0x0494, 816, 1 },
+    { 0x0496, 817, 1 },
+    { 0x0498, 818, 1 },
+    { 0x049A, 819, 1 },
+    { 0x049C, 820, 1 },
+    { 0x049E, 821, 1 },
+    { 0x04A0, 822, 1 },
+    { 0x04A2, 823, 1 },
+    { 0x04A4, 824, 1 },
+    { 0x04A6, 825, 1 },
+    { 0x04A8, 826, 1 },
+    { 0x04AA, 827, 1 },
+    { 0x04AC, 828, 1 },
+    { 0x04AE, 829, 1 },
+    { 0x04B0, 830, 1 },
+    { 0x04B2, 831, 1 },
+    { 0x04B4, 832, 1 },
+    { 0x04B6, 833, 1 },
+    { 0x04B8, 834, 1 },
+    { 0x04BA, 835, 1 },
+    { 0x04BC, 836, 1 },
+    { 0x04BE, 837, 1 },
+    { 0x04C0, 838, 1 },
+    { 0x04C1, 839, 2 },
+    { 0x04C2, 841, 2 },
+    { 0x04C3, 843, 1 },
+    { 0x04C5, 844, 1 },
+    { 0x04C7, 845, 1 },
+    { 0x04C9, 846, 1 },
+    { 0x04CB, 847, 1 },
+    { 0x04CD, 848, 1 },
+    { 0x04D0, 849, 2 },
+    { 0x04D1, 851, 2 },
+    { 0x04D2, 853, 2 },
+    { 0x04D3, 855, 2 },
+    { 0x04D4, 857, 1 },
+    { 0x04D6, 858, 2 },
+    { 0x04D7, 860, 2 },
+    { 0x04D8, 862, 1 },
+    { 0x04DA, 863, 2 },
+    { 0x04DB, 865, 2 },
+    { 0x04DC, 867, 2 },
+    { 0x04DD, 869, 2 },
+    { 0x04DE, 871, 2 },
+    { 0x04DF, 873, 2 },
+    { 0x04E0, 875, 1 },
+    { 0x04E2, 876, 2 },
+    { 0x04E3, 878, 2 },
+    { 0x04E4, 880, 2 },
+    { 0x04E5, 882, 2 },
+    { 0x04E6, 884, 2 },
+    { 0x04E7, 886, 2 },
+    { 0x04E8, 888, 1 },
+    { 0x04EA, 889, 2 },
+    { 0x04EB, 891, 2 },
+    { 0x04EC, 893, 2 },
+    { 0x04ED, 895, 2 },
+    { 0x04EE, 897, 2 },
+    { 0x04EF, 899, 2 },
+    { 0x04F0, 901, 2 },
+    { 0x04F1, 903, 2 },
+    { 0x04F2, 905, 2 },
+    { 0x04F3, 907, 2 },
+    { 0x04F4, 909, 2 },
+    { 0x04F5, 911, 2 },
+    { 0x04F6, 913, 1 },
+    { 0x04F8, 914, 2 },
+    { 0x04F9, 916, 2 },
+    { 0x04FA, 918, 1 },
+    { 0x04FC, 919, 1 },
+    { 0x04FE, 920, 1 },
+    { 0x0500, 921, 1 },
+    { 0x0502, 922, 1 },
+    { 0x0504, 923, 1 },
+    { 0x0506, 924, 1 },
+    { 0x0508, 925, 1 },
+    { 0x050A, 926, 1 },
+    { 0x050C, 927, 1 },
+    { 0x050E, 928, 1 },
+    { 0x0510, 929, 1 },
+    { 0x0512, 930, 1 },
+    { 0x0514, 931, 1 },
+    { 0x0516, 932, 1 },
+    { 0x0518, 933, 1 },
+    { 0x051A, 934, 1 },
+    { 0x051C, 935, 1 },
+    { 0x051E, 936, 1 },
+    { 0x0520, 937, 1 },
+    { 0x0522, 938, 1 },
+    { 0x0524, 939, 1 },
+    { 0x0526, 940, 1 },
+    { 0x0528, 941, 1 },
+    { 0x052A, 942, 1 },
+    { 0x052C, 943, 1 },
+    { 0x052E, 944, 1 },
+    { 0x0531, 945, 1 },
+    { 0x0532, 946, 1 },
+    { 0x0533, 947, 1 },
+    { 0x0534, 948, 1 },
+    { 0x0535, 949, 1 },
+    { 0x0536, 950, 1 },
+    { 0x0537, 951, 1 },
+    { 0x0538, 952, 1 },
+    { 0x0539, 953, 1 },
+    { 0x053A, 954, 1 },
+    { 0x053B, 955, 1 },
+    { 0x053C, 956, 1 },
+    { 0x053D, 957, 1 },
+    { 0x053E, 958, 1 },
+    { 0x053F, 959, 1 },
+    { 0x0540, 960, 1 },
+    { 0x0541, 961, 1 },
+    { 0x0542, 962, 1 },
+    { 0x0543, 963, 1 },
+    { 0x0544, 964, 1 },
+    { 0x0545, 965, 1 },
+    { 0x0546, 966, 1 },
+    { 0x0547, 967, 1 },
+    { 0x0548, 968, 1 },
+    { 0x0549, 969, 1 },
+    { 0x054A, 970, 1 },
+    { 0x054B, 971, 1 },
+    { 0x054C, 972, 1 },
+    { 0x054D, 973, 1 },
+    { 0x054E, 974, 1 },
+    { 0x054F, 975, 1 },
+    { 0x0550, 976, 1 },
+    { 0x0551, 977, 1 },
+    { 0x0552, 978, 1 },
+    { 0x0553, 979, 1 },
+    { 0x0554, 980, 1 },
+    { 0x0555, 981, 1 },
+    { 0x0556, 982, 1 },
+    { 0x0587, 983, 2 },
+    { 0x0622, 985, 2 },
+    { 0x0623, 987, 2 },
+    { 0x0624, 989, 2 },
+    { 0x0625, 991, 2 },
+    { 0x0626, 993, 2 },
+    { 0x06C0, 995, 2 },
+    { 0x06C2, 997, 2 },
+    { 0x06D3, 999, 2 },
+    { 0x0929, 1001, 2 },
+    { 0x0931, 1003, 2 },
+    { 0x0934, 1005, 2 },
+    { 0x0958, 1007, 2 },
+    { 0x0959, 1009, 2 },
+    { 0x095A, 1011, 2 },
+    { 0x095B, 1013, 2 },
+    { 0x095C, 1015, 2 },
+    { 0x095D, 1017, 2 },
+    { 0x095E, 1019, 2 },
+    { 0x095F, 1021, 2 },
+    { 0x09CB, 1023, 2 },
+    { 0x09CC, 1025, 2 },
+    { 0x09DC, 1027, 2 },
+    { 0x09DD, 1029, 2 },
+    { 0x09DF, 1031, 2 },
+    { 0x0A33, 1033, 2 },
+    { 0x0A36, 1035, 2 },
+    { 0x0A59, 1037, 2 },
+    { 0x0A5A, 1039, 2 },
+    { 0x0A5B, 1041, 2 },
+    { 0x0A5E, 1043, 2 },
+    { 0x0B48, 1045, 2 },
+    { 0x0B4B, 1047, 2 },
+    { 0x0B4C, 1049, 2 },
+    { 0x0B5C, 1051, 2 },
+    { 0x0B5D, 1053, 2 },
+    { 0x0B94, 1055, 2 },
+    { 0x0BCA, 1057, 2 },
+    { 0x0BCB, 1059, 2 },
+    { 0x0BCC, 1061, 2 },
+    { 0x0C48, 1063, 2 },
+    { 0x0CC0, 1065, 2 },
+    { 0x0CC7, 1067, 2 },
+    { 0x0CC8, 1069, 2 },
+    { 0x0CCA, 1071, 2 },
+    { 0x0CCB, 1073, 3 },
+    { 0x0D4A, 1076, 2 },
+    { 0x0D4B, 1078, 2 },
+    { 0x0D4C, 1080, 2 },
+    { 0x0DDA, 1082, 2 },
+    { 0x0DDC, 1084, 2 },
+    { 0x0DDD, 1086, 3 },
+    { 0x0DDE, 1089, 2 },
+    { 0x0F43, 1091, 2 },
+    { 0x0F4D, 1093, 2 },
+    { 0x0F52, 1095, 2 },
+    { 0x0F57, 1097, 2 },
+    { 0x0F5C, 1099, 2 },
+    { 0x0F69, 1101, 2 },
+    { 0x0F73, 1103, 2 },
+    { 0x0F75, 1105, 2 },
+    { 0x0F76, 1107, 2 },
+    { 0x0F78, 1109, 2 },
+    { 0x0F81, 1111, 2 },
+    { 0x0F93, 1113, 2 },
+    { 0x0F9D, 1115, 2 },
+    { 0x0FA2, 1117, 2 },
+    { 0x0FA7, 1119, 2 },
+    { 0x0FAC, 1121, 2 },
+    { 0x0FB9, 1123, 2 },
+    { 0x1026, 1125, 2 },
+    { 0x10A0, 1127, 1 },
+    { 0x10A1, 1128, 1 },
+    { 0x10A2, 1129, 1 },
+    { 0x10A3, 1130, 1 },
+    { 0x10A4, 1131, 1 },
+    { 0x10A5, 1132, 1 },
+    { 0x10A6, 1133, 1 },
+    { 0x10A7, 1134, 1 },
+    { 0x10A8, 1135, 1 },
+    { 0x10A9, 1136, 1 },
+    { 0x10AA, 1137, 1 },
+    { 0x10AB, 1138, 1 },
+    { 0x10AC, 1139, 1 },
+    { 0x10AD, 1140, 1 },
+    { 0x10AE, 1141, 1 },
+    { 0x10AF, 1142, 1 },
+    { 0x10B0, 1143, 1 },
+    { 0x10B1, 1144, 1 },
+    { 0x10B2, 1145, 1 },
+    { 0x10B3, 1146, 1 },
+    { 0x10B4, 1147, 1 },
+    { 0x10B5, 1148, 1 },
+    { 0x10B6, 1149, 1 },
+    { 0x10B7, 1150, 1 },
+    { 0x10B8, 1151, 1 },
+    { 0x10B9, 1152, 1 },
+    { 0x10BA, 1153, 1 },
+    { 0x10BB, 1154, 1 },
+    { 0x10BC, 1155, 1 },
+    { 0x10BD, 1156, 1 },
+    { 0x10BE, 1157, 1 },
+    { 0x10BF, 1158, 1 },
+    { 0x10C0, 1159, 1 },
+    { 0x10C1, 1160, 1 },
+    { 0x10C2, 1161, 1 },
+    { 0x10C3, 1162, 1 },
+    { 0x10C4, 1163, 1 },
+    { 0x10C5, 1164, 1 },
+    { 0x10C7, 1165, 1 },
+    { 0x10CD, 1166, 1 },
+    { 0x13F8, 1167, 1 },
+    { 0x13F9, 1168, 1 },
+    { 0x13FA, 1169, 1 },
+    { 0x13FB, 1170, 1 },
+    { 0x13FC, 1171, 1 },
+    { 0x13FD, 1172, 1 },
+    { 0x1B06, 1173, 2 },
+    { 0x1B08, 1175, 2 },
+    { 0x1B0A, 1177, 2 },
+    { 0x1B0C, 1179, 2 },
+    { 0x1B0E, 1181, 2 },
+    { 0x1B12, 1183, 2 },
+    { 0x1B3B, 1185, 2 },
+    { 0x1B3D, 1187, 2 },
+    { 0x1B40, 1189, 2 },
+    { 0x1B41, 1191, 2 },
+    { 0x1B43, 1193, 2 },
+    { 0x1C80, 1195, 1 },
+    { 0x1C81, 1196, 1 },
+    { 0x1C82, 1197, 1 },
+    { 0x1C83, 1198, 1 },
+    { 0x1C84, 1199, 1 },
+    { 0x1C85, 1200, 1 },
+    { 0x1C86, 1201, 1 },
+    { 0x1C87, 1202, 1 },
+    { 0x1C88, 1203, 1 },
+    { 0x1C90, 1204, 1 },
+    { 0x1C91, 1205, 1 },
+    { 0x1C92, 1206, 1 },
+    { 0x1C93, 1207, 1 },
+    { 0x1C94, 1208, 1 },
+    { 0x1C95, 1209, 1 },
+    { 0x1C96, 1210, 1 },
+    { 0x1C97, 1211, 1 },
+    { 0x1C98, 1212, 1 },
+    { 0x1C99, 1213, 1 },
+    { 0x1C9A, 1214, 1 },
+    { 0x1C9B, 1215, 1 },
+    { 0x1C9C, 1216, 1 },
+    { 0x1C9D, 1217, 1 },
+    { 0x1C9E, 1218, 1 },
+    { 0x1C9F, 1219, 1 },
+    { 0x1CA0, 1220, 1 },
+    { 0x1CA1, 1221, 1 },
+    { 0x1CA2, 1222, 1 },
+    { 0x1CA3, 1223, 1 },
+    { 0x1CA4, 1224, 1 },
+    { 0x1CA5, 1225, 1 },
+    { 0x1CA6, 1226, 1 },
+    { 0x1CA7, 1227, 1 },
+    { 0x1CA8, 1228, 1 },
+    { 0x1CA9, 1229, 1 },
+    { 0x1CAA, 1230, 1 },
+    { 0x1CAB, 1231, 1 },
+    { 0x1CAC, 1232, 1 },
+    { 0x1CAD, 1233, 1 },
+    { 0x1CAE, 1234, 1 },
+    { 0x1CAF, 1235, 1 },
+    { 0x1CB0, 1236, 1 },
+    { 0x1CB1, 1237, 1 },
+    { 0x1CB2, 1238, 1 },
+    { 0x1CB3, 1239, 1 },
+    { 0x1CB4, 1240, 1 },
+    { 0x1CB5, 1241, 1 },
+    { 0x1CB6, 1242, 1 },
+    { 0x1CB7, 1243, 1 },
+    { 0x1CB8, 1244, 1 },
+    { 0x1CB9, 1245, 1 },
+    { 0x1CBA, 1246, 1 },
+    { 0x1CBD, 1247, 1 },
+    { 0x1CBE, 1248, 1 },
+    { 0x1CBF, 1249, 1 },
+    { 0x1E00, 1250, 2 },
+    { 0x1E01, 1252, 2 },
+    { 0x1E02, 1254, 2 },
+    { 0x1E03, 1256, 2 },
+    { 0x1E04, 1258, 2 },
+    { 0x1E05, 1260, 2 },
+    { 0x1E06, 1262, 2 },
+    { 0x1E07, 1264, 2 },
+    { 0x1E08, 1266, 3 },
+    { 0x1E09, 1269, 3 },
+    { 0x1E0A, 1272, 2 },
+    { 0x1E0B, 1274, 2 },
+    { 0x1E0C, 1276, 2 },
+    { 0x1E0D, 1278, 2 },
+    { 0x1E0E, 1280, 2 },
+    { 0x1E0F, 1282, 2 },
+    { 0x1E10, 1284, 2 },
+    { 0x1E11, 1286, 2 },
+    { 0x1E12, 1288, 2 },
+    { 0x1E13, 1290, 2 },
+    { 0x1E14, 1292, 3 },
+    { 0x1E15, 1295, 3 },
+    { 0x1E16, 1298, 3 },
+    { 0x1E17, 1301, 3 },
+    { 0x1E18, 1304, 2 },
+    { 0x1E19, 1306, 2 },
+    { 0x1E1A, 1308, 2 },
+    { 0x1E1B, 1310, 2 },
+    { 0x1E1C, 1312, 3 },
+    { 0x1E1D, 1315, 3 },
+    { 0x1E1E, 1318, 2 },
+    { 0x1E1F, 1320, 2 },
+    { 0x1E20, 1322, 2 },
+    { 0x1E21, 1324, 2 },
+    { 0x1E22, 1326, 2 },
+    { 0x1E23, 1328, 2 },
+    { 0x1E24, 1330, 2 },
+    { 0x1E25, 1332, 2 },
+    { 0x1E26, 1334, 2 },
+    { 0x1E27, 1336, 2 },
+    { 0x1E28, 1338, 2 },
+    { 0x1E29, 1340, 2 },
+    { 0x1E2A, 1342, 2 },
+    { 0x1E2B, 1344, 2 },
+    { 0x1E2C, 1346, 2 },
+    { 0x1E2D, 1348, 2 },
+    { 0x1E2E, 1350, 3 },
+    { 0x1E2F, 1353, 3 },
+    { 0x1E30, 1356, 2 },
+    { 0x1E31, 1358, 2 },
+    { 0x1E32, 1360, 2 },
+    { 0x1E33, 1362, 2 },
+    { 0x1E34, 1364, 2 },
+    { 0x1E35, 1366, 2 },
+    { 0x1E36, 1368, 2 },
+    { 0x1E37, 1370, 2 },
+    { 0x1E38, 1372, 3 },
+    { 0x1E39, 1375, 3 },
+    { 0x1E3A, 1378, 2 },
+    { 0x1E3B, 1380, 2 },
+    { 0x1E3C, 1382, 2 },
+    { 0x1E3D, 1384, 2 },
+    { 0x1E3E, 1386, 2 },
+    { 0x1E3F, 1388, 2 },
+    { 0x1E40, 1390, 2 },
+    { 0x1E41, 1392, 2 },
+    { 0x1E42, 1394, 2 },
+    { 0x1E43, 1396, 2 },
+    { 0x1E44, 1398, 2 },
+    { 0x1E45, 1400, 2 },
+    { 0x1E46, 1402, 2 },
+    { 0x1E47, 1404, 2 },
+    { 0x1E48, 1406, 2 },
+    { 0x1E49, 1408, 2 },
+    { 0x1E4A, 1410, 2 },
+    { 0x1E4B, 1412, 2 },
+    { 0x1E4C, 1414, 3 },
+    { 0x1E4D, 1417, 3 },
+    { 0x1E4E, 1420, 3 },
+    { 0x1E4F, 1423, 3 },
+    { 0x1E50, 1426, 3 },
+    { 0x1E51, 1429, 3 },
+    { 0x1E52, 1432, 3 },
+    { 0x1E53, 1435, 3 },
+    { 0x1E54, 1438, 2 },
+    { 0x1E55, 1440, 2 },
+    { 0x1E56, 1442, 2 },
+    { 0x1E57, 1444, 2 },
+    { 0x1E58, 1446, 2 },
+    { 0x1E59, 1448, 2 },
+    { 0x1E5A, 1450, 2 },
+    { 0x1E5B, 1452, 2 },
+    { 0x1E5C, 1454, 3 },
+    { 0x1E5D, 1457, 3 },
+    { 0x1E5E, 1460, 2 },
+    { 0x1E5F, 1462, 2 },
+    { 0x1E60, 1464, 2 },
+    { 0x1E61, 1466, 2 },
+    { 0x1E62, 1468, 2 },
+    { 0x1E63, 1470, 2 },
+    { 0x1E64, 1472, 3 },
+    { 0x1E65, 1475, 3 },
+    { 0x1E66, 1478, 3 },
+    { 0x1E67, 1481, 3 },
+    { 0x1E68, 1484, 3 },
+    { 0x1E69, 1487, 3 },
+    { 0x1E6A, 1490, 2 },
+    { 0x1E6B, 1492, 2 },
+    { 0x1E6C, 1494, 2 },
+    { 0x1E6D, 1496, 2 },
+    { 0x1E6E, 1498, 2 },
+    { 0x1E6F, 1500, 2 },
+    { 0x1E70, 1502, 2 },
+    { 0x1E71, 1504, 2 },
+    { 0x1E72, 1506, 2 },
+    { 0x1E73, 1508, 2 },
+    { 0x1E74, 1510, 2 },
+    { 0x1E75, 1512, 2 },
+    { 0x1E76, 1514, 2 },
+    { 0x1E77, 1516, 2 },
+    { 0x1E78, 1518, 3 },
+    { 0x1E79, 1521, 3 },
+    { 0x1E7A, 1524, 3 },
+    { 0x1E7B, 1527, 3 },
+    { 0x1E7C, 1530, 2 },
+    { 0x1E7D, 1532, 2 },
+    { 0x1E7E, 1534, 2 },
+    { 0x1E7F, 1536, 2 },
+    { 0x1E80, 1538, 2 },
+    { 0x1E81, 1540, 2 },
+    { 0x1E82, 1542, 2 },
+    { 0x1E83, 1544, 2 },
+    { 0x1E84, 1546, 2 },
+    { 0x1E85, 1548, 2 },
+    { 0x1E86, 1550, 2 },
+    { 0x1E87, 1552, 2 },
+    { 0x1E88, 1554, 2 },
+    { 0x1E89, 1556, 2 },
+    { 0x1E8A, 1558, 2 },
+    { 0x1E8B, 1560, 2 },
+    { 0x1E8C, 1562, 2 },
+    { 0x1E8D, 1564, 2 },
+    { 0x1E8E, 1566, 2 },
+    { 0x1E8F, 1568, 2 },
+    { 0x1E90, 1570, 2 },
+    { 0x1E91, 1572, 2 },
+    { 0x1E92, 1574, 2 },
+    { 0x1E93, 1576, 2 },
+    { 0x1E94, 1578, 2 },
+    { 0x1E95, 1580, 2 },
+    { 0x1E96, 1582, 2 },
+    { 0x1E97, 1584, 2 },
+    { 0x1E98, 1586, 2 },
+    { 0x1E99, 1588, 2 },
+    { 0x1E9A, 1590, 2 },
+    { 0x1E9B, 1592, 2 },
+    { 0x1E9E, 1594, 2 },
+    { 0x1EA0, 1596, 2 },
+    { 0x1EA1, 1598, 2 },
+    { 0x1EA2, 1600, 2 },
+    { 0x1EA3, 1602, 2 },
+    { 0x1EA4, 1604, 3 },
+    { 0x1EA5, 1607, 3 },
+    { 0x1EA6, 1610, 3 },
+    { 0x1EA7, 1613, 3 },
+    { 0x1EA8, 1616, 3 },
+    { 0x1EA9, 1619, 3 },
+    { 0x1EAA, 1622, 3 },
+    { 0x1EAB, 1625, 3 },
+    { 0x1EAC, 1628, 3 },
+    { 0x1EAD, 1631, 3 },
+    { 0x1EAE, 1634, 3 },
+    { 0x1EAF, 1637, 3 },
+    { 0x1EB0, 1640, 3 },
+    { 0x1EB1, 1643, 3 },
+    { 0x1EB2, 1646, 3 },
+    { 0x1EB3, 1649, 3 },
+    { 0x1EB4, 1652, 3 },
+    { 0x1EB5, 1655, 3 },
+    { 0x1EB6, 1658, 3 },
+    { 0x1EB7, 1661, 3 },
+    { 0x1EB8, 1664, 2 },
+    { 0x1EB9, 1666, 2 },
+    { 0x1EBA, 1668, 2 },
+    { 0x1EBB, 1670, 2 },
+    { 0x1EBC, 1672, 2 },
+    { 0x1EBD, 1674, 2 },
+    { 0x1EBE, 1676, 3 },
+    { 0x1EBF, 1679, 3 },
+    { 0x1EC0, 1682, 3 },
+    { 0x1EC1, 1685, 3 },
+    { 0x1EC2, 1688, 3 },
+    { 0x1EC3, 1691, 3 },
+    { 0x1EC4, 1694, 3 },
+    { 0x1EC5, 1697, 3 },
+    { 0x1EC6, 1700, 3 },
+    { 0x1EC7, 1703, 3 },
+    { 0x1EC8, 1706, 2 },
+    { 0x1EC9, 1708, 2 },
+    { 0x1ECA, 1710, 2 },
+    { 0x1ECB, 1712, 2 },
+    { 0x1ECC, 1714, 2 },
+    { 0x1ECD, 1716, 2 },
+    { 0x1ECE, 1718, 2 },
+    { 0x1ECF, 1720, 2 },
+    { 0x1ED0, 1722, 3 },
+    { 0x1ED1, 1725, 3 },
+    { 0x1ED2, 1728, 3 },
+    { 0x1ED3, 1731, 3 },
+    { 0x1ED4, 1734, 3 },
+    { 0x1ED5, 1737, 3 },
+    { 0x1ED6, 1740, 3 },
+    { 0x1ED7, 1743, 3 },
+    { 0x1ED8, 1746, 3 },
+    { 0x1ED9, 1749, 3 },
+    { 0x1EDA, 1752, 3 },
+    { 0x1EDB, 1755, 3 },
+    { 0x1EDC, 1758, 3 },
+    { 0x1EDD, 1761, 3 },
+    { 0x1EDE, 1764, 3 },
+    { 0x1EDF, 1767, 3 },
+    { 0x1EE0, 1770, 3 },
+    { 0x1EE1, 1773, 3 },
+    { 0x1EE2, 1776, 3 },
+    { 0x1EE3, 1779, 3 },
+    { 0x1EE4, 1782, 2 },
+    { 0x1EE5, 1784, 2 },
+    { 0x1EE6, 1786, 2 },
+    { 0x1EE7, 1788, 2 },
+    { 0x1EE8, 1790, 3 },
+    { 0x1EE9, 1793, 3 },
+    { 0x1EEA, 1796, 3 },
+    { 0x1EEB, 1799, 3 },
+    { 0x1EEC, 1802, 3 },
+    { 0x1EED, 1805, 3 },
+    { 0x1EEE, 1808, 3 },
+    { 0x1EEF, 1811, 3 },
+    { 0x1EF0, 1814, 3 },
+    { 0x1EF1, 1817, 3 },
+    { 0x1EF2, 1820, 2 },
+    { 0x1EF3, 1822, 2 },
+    { 0x1EF4, 1824, 2 },
+    { 0x1EF5, 1826, 2 },
+    { 0x1EF6, 1828, 2 },
+    { 0x1EF7, 1830, 2 },
+    { 0x1EF8, 1832, 2 },
+    { 0x1EF9, 1834, 2 },
+    { 0x1EFA, 1836, 1 },
+    { 0x1EFC, 1837, 1 },
+    { 0x1EFE, 1838, 1 },
+    { 0x1F00, 1839, 2 },
+    { 0x1F01, 1841, 2 },
+    { 0x1F02, 1843, 3 },
+    { 0x1F03, 1846, 3 },
+    { 0x1F04, 1849, 3 },
+    { 0x1F05, 1852, 3 },
+    { 0x1F06, 1855, 3 },
+    { 0x1F07, 1858, 3 },
+    { 0x1F08, 1861, 2 },
+    { 0x1F09, 1863, 2 },
+    { 0x1F0A, 1865, 3 },
+    { 0x1F0B, 1868, 3 },
+    { 0x1F0C, 1871, 3 },
+    { 0x1F0D, 1874, 3 },
+    { 0x1F0E, 1877, 3 },
+    { 0x1F0F, 1880, 3 },
+    { 0x1F10, 1883, 2 },
+    { 0x1F11, 1885, 2 },
+    { 0x1F12, 1887, 3 },
+    { 0x1F13, 1890, 3 },
+    { 0x1F14, 1893, 3 },
+    { 0x1F15, 1896, 3 },
+    { 0x1F18, 1899, 2 },
+    { 0x1F19, 1901, 2 },
+    { 0x1F1A, 1903, 3 },
+    { 0x1F1B, 1906, 3 },
+    { 0x1F1C, 1909, 3 },
+    { 0x1F1D, 1912, 3 },
+    { 0x1F20, 1915, 2 },
+    { 0x1F21, 1917, 2 },
+    { 0x1F22, 1919, 3 },
+    { 0x1F23, 1922, 3 },
+    { 0x1F24, 1925, 3 },
+    { 0x1F25, 1928, 3 },
+    { 0x1F26, 1931, 3 },
+    { 0x1F27, 1934, 3 },
+    { 0x1F28, 1937, 2 },
+    { 0x1F29, 1939, 2 },
+    { 0x1F2A, 1941, 3 },
+    { 0x1F2B, 1944, 3 },
+    { 0x1F2C, 1947, 3 },
+    { 0x1F2D, 1950, 3 },
+    { 0x1F2E, 1953, 3 },
+    { 0x1F2F, 1956, 3 },
+    { 0x1F30, 1959, 2 },
+    { 0x1F31, 1961, 2 },
+    { 0x1F32, 1963, 3 },
+    { 0x1F33, 1966, 3 },
+    { 0x1F34, 1969, 3 },
+    { 0x1F35, 1972, 3 },
+    { 0x1F36, 1975, 3 },
+    { 0x1F37, 1978, 3 },
+    { 0x1F38, 1981, 2 },
+    { 0x1F39, 1983, 2 },
+    { 0x1F3A, 1985, 3 },
+    { 0x1F3B, 1988, 3 },
+    { 0x1F3C, 1991, 3 },
+    { 0x1F3D, 1994, 3 },
+    { 0x1F3E, 1997, 3 },
+    { 0x1F3F, 2000, 3 },
+    { 0x1F40, 2003, 2 },
+    { 0x1F41, 2005, 2 },
+    { 0x1F42, 2007, 3 },
+    { 0x1F43, 2010, 3 },
+    { 0x1F44, 2013, 3 },
+    { 0x1F45, 2016, 3 },
+    { 0x1F48, 2019, 2 },
+    { 0x1F49, 2021, 2 },
+    { 0x1F4A, 2023, 3 },
+    { 0x1F4B, 2026, 3 },
+    { 0x1F4C, 2029, 3 },
+    { 0x1F4D, 2032, 3 },
+    { 0x1F50, 2035, 2 },
+    { 0x1F51, 2037, 2 },
+    { 0x1F52, 2039, 3 },
+    { 0x1F53, 2042, 3 },
+    { 0x1F54, 2045, 3 },
+    { 0x1F55, 2048, 3 },
+    { 0x1F56, 2051, 3 },
+    { 0x1F57, 2054, 3 },
+    { 0x1F59, 2057, 2 },
+    { 0x1F5B, 2059, 3 },
+    { 0x1F5D, 2062, 3 },
+    { 0x1F5F, 2065, 3 },
+    { 0x1F60, 2068, 2 },
+    { 0x1F61, 2070, 2 },
+    { 0x1F62, 2072, 3 },
+    { 0x1F63, 2075, 3 },
+    { 0x1F64, 2078, 3 },
+    { 0x1F65, 2081, 3 },
+    { 0x1F66, 2084, 3 },
+    { 0x1F67, 2087, 3 },
+    { 0x1F68, 2090, 2 },
+    { 0x1F69, 2092, 2 },
+    { 0x1F6A, 2094, 3 },
+    { 0x1F6B, 2097, 3 },
+    { 0x1F6C, 2100, 3 },
+    { 0x1F6D, 2103, 3 },
+    { 0x1F6E, 2106, 3 },
+    { 0x1F6F, 2109, 3 },
+    { 0x1F70, 2112, 2 },
+    { 0x1F71, 2114, 2 },
+    { 0x1F72, 2116, 2 },
+    { 0x1F73, 2118, 2 },
+    { 0x1F74, 2120, 2 },
+    { 0x1F75, 2122, 2 },
+    { 0x1F76, 2124, 2 },
+    { 0x1F77, 2126, 2 },
+    { 0x1F78, 2128, 2 },
+    { 0x1F79, 2130, 2 },
+    { 0x1F7A, 2132, 2 },
+    { 0x1F7B, 2134, 2 },
+    { 0x1F7C, 2136, 2 },
+    { 0x1F7D, 2138, 2 },
+    { 0x1F80, 2140, 3 },
+    { 0x1F81, 2143, 3 },
+    { 0x1F82, 2146, 4 },
+    { 0x1F83, 2150, 4 },
+    { 0x1F84, 2154, 4 },
+    { 0x1F85, 2158, 4 },
+    { 0x1F86, 2162, 4 },
+    { 0x1F87, 2166, 4 },
+    { 0x1F88, 2170, 3 },
+    { 0x1F89, 2173, 3 },
+    { 0x1F8A, 2176, 4 },
+    { 0x1F8B, 2180, 4 },
+    { 0x1F8C, 2184, 4 },
+    { 0x1F8D, 2188, 4 },
+    { 0x1F8E, 2192, 4 },
+    { 0x1F8F, 2196, 4 },
+    { 0x1F90, 2200, 3 },
+    { 0x1F91, 2203, 3 },
+    { 0x1F92, 2206, 4 },
+    { 0x1F93, 2210, 4 },
+    { 0x1F94, 2214, 4 },
+    { 0x1F95, 2218, 4 },
+    { 0x1F96, 2222, 4 },
+    { 0x1F97, 2226, 4 },
+    { 0x1F98, 2230, 3 },
+    { 0x1F99, 2233, 3 },
+    { 0x1F9A, 2236, 4 },
+    { 0x1F9B, 2240, 4 },
+    { 0x1F9C, 2244, 4 },
+    { 0x1F9D, 2248, 4 },
+    { 0x1F9E, 2252, 4 },
+    { 0x1F9F, 2256, 4 },
+    { 0x1FA0, 2260, 3 },
+    { 0x1FA1, 2263, 3 },
+    { 0x1FA2, 2266, 4 },
+    { 0x1FA3, 2270, 4 },
+    { 0x1FA4, 2274, 4 },
+    { 0x1FA5, 2278, 4 },
+    { 0x1FA6, 2282, 4 },
+    { 0x1FA7, 2286, 4 },
+    { 0x1FA8, 2290, 3 },
+    { 0x1FA9, 2293, 3 },
+    { 0x1FAA, 2296, 4 },
+    { 0x1FAB, 2300, 4 },
+    { 0x1FAC, 2304, 4 },
+    { 0x1FAD, 2308, 4 },
+    { 0x1FAE, 2312, 4 },
+    { 0x1FAF, 2316, 4 },
+    { 0x1FB0, 2320, 2 },
+    { 0x1FB1, 2322, 2 },
+    { 0x1FB2, 2324, 3 },
+    { 0x1FB3, 2327, 2 },
+    { 0x1FB4, 2329, 3 },
+    { 0x1FB6, 2332, 2 },
+    { 0x1FB7, 2334, 3 },
+    { 0x1FB8, 2337, 2 },
+    { 0x1FB9, 2339, 2 },
+    { 0x1FBA, 2341, 2 },
+    { 0x1FBB, 2343, 2 },
+    { 0x1FBC, 2345, 2 },
+    { 0x1FBE, 2347, 1 },
+    { 0x1FC1, 2348, 2 },
+    { 0x1FC2, 2350, 3 },
+    { 0x1FC3, 2353, 2 },
+    { 0x1FC4, 2355, 3 },
+    { 0x1FC6, 2358, 2 },
+    { 0x1FC7, 2360, 3 },
+    { 0x1FC8, 2363, 2 },
+    { 0x1FC9, 2365, 2 },
+    { 0x1FCA, 2367, 2 },
+    { 0x1FCB, 2369, 2 },
+    { 0x1FCC, 2371, 2 },
+    { 0x1FCD, 2373, 2 },
+    { 0x1FCE, 2375, 2 },
+    { 0x1FCF, 2377, 2 },
+    { 0x1FD0, 2379, 2 },
+    { 0x1FD1, 2381, 2 },
+    { 0x1FD2, 2383, 3 },
+    { 0x1FD3, 2386, 3 },
+    { 0x1FD6, 2389, 2 },
+    { 0x1FD7, 2391, 3 },
+    { 0x1FD8, 2394, 2 },
+    { 0x1FD9, 2396, 2 },
+    { 0x1FDA, 2398, 2 },
+    { 0x1FDB, 2400, 2 },
+    { 0x1FDD, 2402, 2 },
+    { 0x1FDE, 2404, 2 },
+    { 0x1FDF, 2406, 2 },
+    { 0x1FE0, 2408, 2 },
+    { 0x1FE1, 2410, 2 },
+    { 0x1FE2, 2412, 3 },
+    { 0x1FE3, 2415, 3 },
+    { 0x1FE4, 2418, 2 },
+    { 0x1FE5, 2420, 2 },
+    { 0x1FE6, 2422, 2 },
+    { 0x1FE7, 2424, 3 },
+    { 0x1FE8, 2427, 2 },
+    { 0x1FE9, 2429, 2 },
+    { 0x1FEA, 2431, 2 },
+    { 0x1FEB, 2433, 2 },
+    { 0x1FEC, 2435, 2 },
+    { 0x1FED, 2437, 2 },
+    { 0x1FEE, 2439, 2 },
+    { 0x1FEF, 2441, 1 },
+    { 0x1FF2, 2442, 3 },
+    { 0x1FF3, 2445, 2 },
+    { 0x1FF4, 2447, 3 },
+    { 0x1FF6, 2450, 2 },
+    { 0x1FF7, 2452, 3 },
+    { 0x1FF8, 2455, 2 },
+    { 0x1FF9, 2457, 2 },
+    { 0x1FFA, 2459, 2 },
+    { 0x1FFB, 2461, 2 },
+    { 0x1FFC, 2463, 2 },
+    { 0x1FFD, 2465, 1 },
+    { 0x2000, 2466, 1 },
+    { 0x2001, 2467, 1 },
+    { 0x2126, 2468, 1 },
+    { 0x212A, 2469, 1 },
+    { 0x212B, 2470, 2 },
+    { 0x2132, 2472, 1 },
+    { 0x2160, 2473, 1 },
+    { 0x2161, 2474, 1 },
+    { 0x2162, 2475, 1 },
+    { 0x2163, 2476, 1 },
+    { 0x2164, 2477, 1 },
+    { 0x2165, 2478, 1 },
+    { 0x2166, 2479, 1 },
+    { 0x2167, 2480, 1 },
+    { 0x2168, 2481, 1 },
+    { 0x2169, 2482, 1 },
+    { 0x216A, 2483, 1 },
+    { 0x216B, 2484, 1 },
+    { 0x216C, 2485, 1 },
+    { 0x216D, 2486, 1 },
+    { 0x216E, 2487, 1 },
+    { 0x216F, 2488, 1 },
+    { 0x2183, 2489, 1 },
+    { 0x219A, 2490, 2 },
+    { 0x219B, 2492, 2 },
+    { 0x21AE, 2494, 2 },
+    { 0x21CD, 2496, 2 },
+    { 0x21CE, 2498, 2 },
+    { 0x21CF, 2500, 2 },
+    { 0x2204, 2502, 2 },
+    { 0x2209, 2504, 2 },
+    { 0x220C, 2506, 2 },
+    { 0x2224, 2508, 2 },
+    { 0x2226, 2510, 2 },
+    { 0x2241, 2512, 2 },
+    { 0x2244, 2514, 2 },
+    { 0x2247, 2516, 2 },
+    { 0x2249, 2518, 2 },
+    { 0x2260, 2520, 2 },
+    { 0x2262, 2522, 2 },
+    { 0x226D, 2524, 2 },
+    { 0x226E, 2526, 2 },
+    { 0x226F, 2528, 2 },
+    { 0x2270, 2530, 2 },
+    { 0x2271, 2532, 2 },
+    { 0x2274, 2534, 2 },
+    { 0x2275, 2536, 2 },
+    { 0x2278, 2538, 2 },
+    { 0x2279, 2540, 2 },
+    { 0x2280, 2542, 2 },
+    { 0x2281, 2544, 2 },
+    { 0x2284, 2546, 2 },
+    { 0x2285, 2548, 2 },
+    { 0x2288, 2550, 2 },
+    { 0x2289, 2552, 2 },
+    { 0x22AC, 2554, 2 },
+    { 0x22AD, 2556, 2 },
+    { 0x22AE, 2558, 2 },
+    { 0x22AF, 2560, 2 },
+    { 0x22E0, 2562, 2 },
+    { 0x22E1, 2564, 2 },
+    { 0x22E2, 2566, 2 },
+    { 0x22E3, 2568, 2 },
+    { 0x22EA, 2570, 2 },
+    { 0x22EB, 2572, 2 },
+    { 0x22EC, 2574, 2 },
+    { 0x22ED, 2576, 2 },
+    { 0x2329, 2578, 1 },
+    { 0x232A, 2579, 1 },
+    { 0x24B6, 2580, 1 },
+    { 0x24B7, 2581, 1 },
+    { 0x24B8, 2582, 1 },
+    { 0x24B9, 2583, 1 },
+    { 0x24BA, 2584, 1 },
+    { 0x24BB, 2585, 1 },
+    { 0x24BC, 2586, 1 },
+    { 0x24BD, 2587, 1 },
+    { 0x24BE, 2588, 1 },
+    { 0x24BF, 2589, 1 },
+    { 0x24C0, 2590, 1 },
+    { 0x24C1, 2591, 1 },
+    { 0x24C2, 2592, 1 },
+    { 0x24C3, 2593, 1 },
+    { 0x24C4, 2594, 1 },
+    { 0x24C5, 2595, 1 },
+    { 0x24C6, 2596, 1 },
+    { 0x24C7, 2597, 1 },
+    { 0x24C8, 2598, 1 },
+    { 0x24C9, 2599, 1 },
+    { 0x24CA, 2600, 1 },
+    { 0x24CB, 2601, 1 },
+    { 0x24CC, 2602, 1 },
+    { 0x24CD, 2603, 1 },
+    { 0x24CE, 2604, 1 },
+    { 0x24CF, 2605, 1 },
+    { 0x2ADC, 2606, 2 },
+    { 0x2C00, 2608, 1 },
+    { 0x2C01, 2609, 1 },
+    { 0x2C02, 2610, 1 },
+    { 0x2C03, 2611, 1 },
+    { 0x2C04, 2612, 1 },
+    { 0x2C05, 2613, 1 },
+    { 0x2C06, 2614, 1 },
+    { 0x2C07, 2615, 1 },
+    { 0x2C08, 2616, 1 },
+    { 0x2C09, 2617, 1 },
+    { 0x2C0A, 2618, 1 },
+    { 0x2C0B, 2619, 1 },
+    { 0x2C0C, 2620, 1 },
+    { 0x2C0D, 2621, 1 },
+    { 0x2C0E, 2622, 1 },
+    { 0x2C0F, 2623, 1 },
+    { 0x2C10, 2624, 1 },
+    { 0x2C11, 2625, 1 },
+    { 0x2C12, 2626, 1 },
+    { 0x2C13, 2627, 1 },
+    { 0x2C14, 2628, 1 },
+    { 0x2C15, 2629, 1 },
+    { 0x2C16, 2630, 1 },
+    { 0x2C17, 2631, 1 },
+    { 0x2C18, 2632, 1 },
+    { 0x2C19, 2633, 1 },
+    { 0x2C1A, 2634, 1 },
+    { 0x2C1B, 2635, 1 },
+    { 0x2C1C, 2636, 1 },
+    { 0x2C1D, 2637, 1 },
+    { 0x2C1E, 2638, 1 },
+    { 0x2C1F, 2639, 1 },
+    { 0x2C20, 2640, 1 },
+    { 0x2C21, 2641, 1 },
+    { 0x2C22, 2642, 1 },
+    { 0x2C23, 2643, 1 },
+    { 0x2C24, 2644, 1 },
+    { 0x2C25, 2645, 1 },
+    { 0x2C26, 2646, 1 },
+    { 0x2C27, 2647, 1 },
+    { 0x2C28, 2648, 1 },
+    { 0x2C29, 2649, 1 },
+    { 0x2C2A, 2650, 1 },
+    { 0x2C2B, 2651, 1 },
+    { 0x2C2C, 2652, 1 },
+    { 0x2C2D, 2653, 1 },
+    { 0x2C2E, 2654, 1 },
+    { 0x2C2F, 2655, 1 },
+    { 0x2C60, 2656, 1 },
+    { 0x2C62, 2657, 1 },
+    { 0x2C63, 2658, 1 },
+    { 0x2C64, 2659, 1 },
+    { 0x2C67, 2660, 1 },
+    { 0x2C69, 2661, 1 },
+    { 0x2C6B, 2662, 1 },
+    { 0x2C6D, 2663, 1 },
+    { 0x2C6E, 2664, 1 },
+    { 0x2C6F, 2665, 1 },
+    { 0x2C70, 2666, 1 },
+    { 0x2C72, 2667, 1 },
+    { 0x2C75, 2668, 1 },
+    { 0x2C7E, 2669, 1 },
+    { 0x2C7F, 2670, 1 },
+    { 0x2C80, 2671, 1 },
+    { 0x2C82, 2672, 1 },
+    { 0x2C84, 2673, 1 },
+    { 0x2C86, 2674, 1 },
+    { 0x2C88, 2675, 1 },
+    { 0x2C8A, 2676, 1 },
+    { 0x2C8C, 2677, 1 },
+    { 0x2C8E, 2678, 1 },
+    { 0x2C90, 2679, 1 },
+    { 0x2C92, 2680, 1 },
+    { 0x2C94, 2681, 1 },
+    { 0x2C96, 2682, 1 },
+    { 0x2C98, 2683, 1 },
+    { 0x2C9A, 2684, 1 },
+    { 0x2C9C, 2685, 1 },
+    { 0x2C9E, 2686, 1 },
+    { 0x2CA0, 2687, 1 },
+    { 0x2CA2, 2688, 1 },
+    { 0x2CA4, 2689, 1 },
+    { 0x2CA6, 2690, 1 },
+    { 0x2CA8, 2691, 1 },
+    { 0x2CAA, 2692, 1 },
+    { 0x2CAC, 2693, 1 },
+    { 0x2CAE, 2694, 1 },
+    { 0x2CB0, 2695, 1 },
+    { 0x2CB2, 2696, 1 },
+    { 0x2CB4, 2697, 1 },
+    { 0x2CB6, 2698, 1 },
+    { 0x2CB8, 2699, 1 },
+    { 0x2CBA, 2700, 1 },
+    { 0x2CBC, 2701, 1 },
+    { 0x2CBE, 2702, 1 },
+    { 0x2CC0, 2703, 1 },
+    { 0x2CC2, 2704, 1 },
+    { 0x2CC4, 2705, 1 },
+    { 0x2CC6, 2706, 1 },
+    { 0x2CC8, 2707, 1 },
+    { 0x2CCA, 2708, 1 },
+    { 0x2CCC, 2709, 1 },
+    { 0x2CCE, 2710, 1 },
+    { 0x2CD0, 2711, 1 },
+    { 0x2CD2, 2712, 1 },
+    { 0x2CD4, 2713, 1 },
+    { 0x2CD6, 2714, 1 },
+    { 0x2CD8, 2715, 1 },
+    { 0x2CDA, 2716, 1 },
+    { 0x2CDC, 2717, 1 },
+    { 0x2CDE, 2718, 1 },
+    { 0x2CE0, 2719, 1 },
+    { 0x2CE2, 2720, 1 },
+    { 0x2CEB, 2721, 1 },
+    { 0x2CED, 2722, 1 },
+    { 0x2CF2, 2723, 1 },
+    { 0x304C, 2724, 2 },
+    { 0x304E, 2726, 2 },
+    { 0x3050, 2728, 2 },
+    { 0x3052, 2730, 2 },
+    { 0x3054, 2732, 2 },
+    { 0x3056, 2734, 2 },
+    { 0x3058, 2736, 2 },
+    { 0x305A, 2738, 2 },
+    { 0x305C, 2740, 2 },
+    { 0x305E, 2742, 2 },
+    { 0x3060, 2744, 2 },
+    { 0x3062, 2746, 2 },
+    { 0x3065, 2748, 2 },
+    { 0x3067, 2750, 2 },
+    { 0x3069, 2752, 2 },
+    { 0x3070, 2754, 2 },
+    { 0x3071, 2756, 2 },
+    { 0x3073, 2758, 2 },
+    { 0x3074, 2760, 2 },
+    { 0x3076, 2762, 2 },
+    { 0x3077, 2764, 2 },
+    { 0x3079, 2766, 2 },
+    { 0x307A, 2768, 2 },
+    { 0x307C, 2770, 2 },
+    { 0x307D, 2772, 2 },
+    { 0x3094, 2774, 2 },
+    { 0x309E, 2776, 2 },
+    { 0x30AC, 2778, 2 },
+    { 0x30AE, 2780, 2 },
+    { 0x30B0, 2782, 2 },
+    { 0x30B2, 2784, 2 },
+    { 0x30B4, 2786, 2 },
+    { 0x30B6, 2788, 2 },
+    { 0x30B8, 2790, 2 },
+    { 0x30BA, 2792, 2 },
+    { 0x30BC, 2794, 2 },
+    { 0x30BE, 2796, 2 },
+    { 0x30C0, 2798, 2 },
+    { 0x30C2, 2800, 2 },
+    { 0x30C5, 2802, 2 },
+    { 0x30C7, 2804, 2 },
+    { 0x30C9, 2806, 2 },
+    { 0x30D0, 2808, 2 },
+    { 0x30D1, 2810, 2 },
+    { 0x30D3, 2812, 2 },
+    { 0x30D4, 2814, 2 },
+    { 0x30D6, 2816, 2 },
+    { 0x30D7, 2818, 2 },
+    { 0x30D9, 2820, 2 },
+    { 0x30DA, 2822, 2 },
+    { 0x30DC, 2824, 2 },
+    { 0x30DD, 2826, 2 },
+    { 0x30F4, 2828, 2 },
+    { 0x30F7, 2830, 2 },
+    { 0x30F8, 2832, 2 },
+    { 0x30F9, 2834, 2 },
+    { 0x30FA, 2836, 2 },
+    { 0x30FE, 2838, 2 },
+    { 0xA640, 2840, 1 },
+    { 0xA642, 2841, 1 },
+    { 0xA644, 2842, 1 },
+    { 0xA646, 2843, 1 },
+    { 0xA648, 2844, 1 },
+    { 0xA64A, 2845, 1 },
+    { 0xA64C, 2846, 1 },
+    { 0xA64E, 2847, 1 },
+    { 0xA650, 2848, 1 },
+    { 0xA652, 2849, 1 },
+    { 0xA654, 2850, 1 },
+    { 0xA656, 2851, 1 },
+    { 0xA658, 2852, 1 },
+    { 0xA65A, 2853, 1 },
+    { 0xA65C, 2854, 1 },
+    { 0xA65E, 2855, 1 },
+    { 0xA660, 2856, 1 },
+    { 0xA662, 2857, 1 },
+    { 0xA664, 2858, 1 },
+    { 0xA666, 2859, 1 },
+    { 0xA668, 2860, 1 },
+    { 0xA66A, 2861, 1 },
+    { 0xA66C, 2862, 1 },
+    { 0xA680, 2863, 1 },
+    { 0xA682, 2864, 1 },
+    { 0xA684, 2865, 1 },
+    { 0xA686, 2866, 1 },
+    { 0xA688, 2867, 1 },
+    { 0xA68A, 2868, 1 },
+    { 0xA68C, 2869, 1 },
+    { 0xA68E, 2870, 1 },
+    { 0xA690, 2871, 1 },
+    { 0xA692, 2872, 1 },
+    { 0xA694, 2873, 1 },
+    { 0xA696, 2874, 1 },
+    { 0xA698, 2875, 1 },
+    { 0xA69A, 2876, 1 },
+    { 0xA722, 2877, 1 },
+    { 0xA724, 2878, 1 },
+    { 0xA726, 2879, 1 },
+    { 0xA728, 2880, 1 },
+    { 0xA72A, 2881, 1 },
+    { 0xA72C, 2882, 1 },
+    { 0xA72E, 2883, 1 },
+    { 0xA732, 2884, 1 },
+    { 0xA734, 2885, 1 },
+    { 0xA736, 2886, 1 },
+    { 0xA738, 2887, 1 },
+    { 0xA73A, 2888, 1 },
+    { 0xA73C, 2889, 1 },
+    { 0xA73E, 2890, 1 },
+    { 0xA740, 2891, 1 },
+    { 0xA742, 2892, 1 },
+    { 0xA744, 2893, 1 },
+    { 0xA746, 2894, 1 },
+    { 0xA748, 2895, 1 },
+    { 0xA74A, 2896, 1 },
+    { 0xA74C, 2897, 1 },
+    { 0xA74E, 2898, 1 },
+    { 0xA750, 2899, 1 },
+    { 0xA752, 2900, 1 },
+    { 0xA754, 2901, 1 },
+    { 0xA756, 2902, 1 },
+    { 0xA758, 2903, 1 },
+    { 0xA75A, 2904, 1 },
+    { 0xA75C, 2905, 1 },
+    { 0xA75E, 2906, 1 },
+    { 0xA760, 2907, 1 },
+    { 0xA762, 2908, 1 },
+    { 0xA764, 2909, 1 },
+    { 0xA766, 2910, 1 },
+    { 0xA768, 2911, 1 },
+    { 0xA76A, 2912, 1 },
+    { 0xA76C, 2913, 1 },
+    { 0xA76E, 2914, 1 },
+    { 0xA779, 2915, 1 },
+    { 0xA77B, 2916, 1 },
+    { 0xA77D, 2917, 1 },
+    { 0xA77E, 2918, 1 },
+    { 0xA780, 2919, 1 },
+    { 0xA782, 2920, 1 },
+    { 0xA784, 2921, 1 },
+    { 0xA786, 2922, 1 },
+    { 0xA78B, 2923, 1 },
+    { 0xA78D, 2924, 1 },
+    { 0xA790, 2925, 1 },
+    { 0xA792, 2926, 1 },
+    { 0xA796, 2927, 1 },
+    { 0xA798, 2928, 1 },
+    { 0xA79A, 2929, 1 },
+    { 0xA79C, 2930, 1 },
+    { 0xA79E, 2931, 1 },
+    { 0xA7A0, 2932, 1 },
+    { 0xA7A2, 2933, 1 },
+    { 0xA7A4, 2934, 1 },
+    { 0xA7A6, 2935, 1 },
+    { 0xA7A8, 2936, 1 },
+    { 0xA7AA, 2937, 1 },
+    { 0xA7AB, 2938, 1 },
+    { 0xA7AC, 2939, 1 },
+    { 0xA7AD, 2940, 1 },
+    { 0xA7AE, 2941, 1 },
+    { 0xA7B0, 2942, 1 },
+    { 0xA7B1, 2943, 1 },
+    { 0xA7B2, 2944, 1 },
+    { 0xA7B3, 2945, 1 },
+    { 0xA7B4, 2946, 1 },
+    { 0xA7B6, 2947, 1 },
+    { 0xA7B8, 2948, 1 },
+    { 0xA7BA, 2949, 1 },
+    { 0xA7BC, 2950, 1 },
+    { 0xA7BE, 2951, 1 },
+    { 0xA7C0, 2952, 1 },
+    { 0xA7C2, 2953, 1 },
+    { 0xA7C4, 2954, 1 },
+    { 0xA7C5, 2955, 1 },
+    { 0xA7C6, 2956, 1 },
+    { 0xA7C7, 2957, 1 },
+    { 0xA7C9, 2958, 1 },
+    { 0xA7D0, 2959, 1 },
+    { 0xA7D6, 2960, 1 },
+    { 0xA7D8, 2961, 1 },
+    { 0xA7F5, 2962, 1 },
+    { 0xAB70, 2963, 1 },
+    { 0xAB71, 2964, 1 },
+    { 0xAB72, 2965, 1 },
+    { 0xAB73, 2966, 1 },
+    { 0xAB74, 2967, 1 },
+    { 0xAB75, 2968, 1 },
+    { 0xAB76, 2969, 1 },
+    { 0xAB77, 2970, 1 },
+    { 0xAB78, 2971, 1 },
+    { 0xAB79, 2972, 1 },
+    { 0xAB7A, 2973, 1 },
+    { 0xAB7B, 2974, 1 },
+    { 0xAB7C, 2975, 1 },
+    { 0xAB7D, 2976, 1 },
+    { 0xAB7E, 2977, 1 },
+    { 0xAB7F, 2978, 1 },
+    { 0xAB80, 2979, 1 },
+    { 0xAB81, 2980, 1 },
+    { 0xAB82, 2981, 1 },
+    { 0xAB83, 2982, 1 },
+    { 0xAB84, 2983, 1 },
+    { 0xAB85, 2984, 1 },
+    { 0xAB86, 2985, 1 },
+    { 0xAB87, 2986, 1 },
+    { 0xAB88, 2987, 1 },
+    { 0xAB89, 2988, 1 },
+    { 0xAB8A, 2989, 1 },
+    { 0xAB8B, 2990, 1 },
+    { 0xAB8C, 2991, 1 },
+    { 0xAB8D, 2992, 1 },
+    { 0xAB8E, 2993, 1 },
+    { 0xAB8F, 2994, 1 },
+    { 0xAB90, 2995, 1 },
+    { 0xAB91, 2996, 1 },
+    { 0xAB92, 2997, 1 },
+    { 0xAB93, 2998, 1 },
+    { 0xAB94, 2999, 1 },
+    { 0xAB95, 3000, 1 },
+    { 0xAB96, 3001, 1 },
+    { 0xAB97, 3002, 1 },
+    { 0xAB98, 3003, 1 },
+    { 0xAB99, 3004, 1 },
+    { 0xAB9A, 3005, 1 },
+    { 0xAB9B, 3006, 1 },
+    { 0xAB9C, 3007, 1 },
+    { 0xAB9D, 3008, 1 },
+    { 0xAB9E, 3009, 1 },
+    { 0xAB9F, 3010, 1 },
+    { 0xABA0, 3011, 1 },
+    { 0xABA1, 3012, 1 },
+    { 0xABA2, 3013, 1 },
+    { 0xABA3, 3014, 1 },
+    { 0xABA4, 3015, 1 },
+    { 0xABA5, 3016, 1 },
+    { 0xABA6, 3017, 1 },
+    { 0xABA7, 3018, 1 },
+    { 0xABA8, 3019, 1 },
+    { 0xABA9, 3020, 1 },
+    { 0xABAA, 3021, 1 },
+    { 0xABAB, 3022, 1 },
+    { 0xABAC, 3023, 1 },
+    { 0xABAD, 3024, 1 },
+    { 0xABAE, 3025, 1 },
+    { 0xABAF, 3026, 1 },
+    { 0xABB0, 3027, 1 },
+    { 0xABB1, 3028, 1 },
+    { 0xABB2, 3029, 1 },
+    { 0xABB3, 3030, 1 },
+    { 0xABB4, 3031, 1 },
+    { 0xABB5, 3032, 1 },
+    { 0xABB6, 3033, 1 },
+    { 0xABB7, 3034, 1 },
+    { 0xABB8, 3035, 1 },
+    { 0xABB9, 3036, 1 },
+    { 0xABBA, 3037, 1 },
+    { 0xABBB, 3038, 1 },
+    { 0xABBC, 3039, 1 },
+    { 0xABBD, 3040, 1 },
+    { 0xABBE, 3041, 1 },
+    { 0xABBF, 3042, 1 },
+    { 0xF900, 3043, 1 },
+    { 0xF901, 3044, 1 },
+    { 0xF902, 3045, 1 },
+    { 0xF903, 3046, 1 },
+    { 0xF904, 3047, 1 },
+    { 0xF905, 3048, 1 },
+    { 0xF906, 3049, 1 },
+    { 0xF907, 3050, 1 },
+    { 0xF908, 3051, 1 },
+    { 0xF909, 3052, 1 },
+    { 0xF90A, 3053, 1 },
+    { 0xF90B, 3054, 1 },
+    { 0xF90C, 3055, 1 },
+    { 0xF90D, 3056, 1 },
+    { 0xF90E, 3057, 1 },
+    { 0xF90F, 3058, 1 },
+    { 0xF910, 3059, 1 },
+    { 0xF911, 3060, 1 },
+    { 0xF912, 3061, 1 },
+    { 0xF913, 3062, 1 },
+    { 0xF914, 3063, 1 },
+    { 0xF915, 3064, 1 },
+    { 0xF916, 3065, 1 },
+    { 0xF917, 3066, 1 },
+    { 0xF918, 3067, 1 },
+    { 0xF919, 3068, 1 },
+    { 0xF91A, 3069, 1 },
+    { 0xF91B, 3070, 1 },
+    { 0xF91C, 3071, 1 },
+    { 0xF91D, 3072, 1 },
+    { 0xF91E, 3073, 1 },
+    { 0xF91F, 3074, 1 },
+    { 0xF920, 3075, 1 },
+    { 0xF921, 3076, 1 },
+    { 0xF922, 3077, 1 },
+    { 0xF923, 3078, 1 },
+    { 0xF924, 3079, 1 },
+    { 0xF925, 3080, 1 },
+    { 0xF926, 3081, 1 },
+    { 0xF927, 3082, 1 },
+    { 0xF928, 3083, 1 },
+    { 0xF929, 3084, 1 },
+    { 0xF92A, 3085, 1 },
+    { 0xF92B, 3086, 1 },
+    { 0xF92C, 3087, 1 },
+    { 0xF92D, 3088, 1 },
+    { 0xF92E, 3089, 1 },
+    { 0xF92F, 3090, 1 },
+    { 0xF930, 3091, 1 },
+    { 0xF931, 3092, 1 },
+    { 0xF932, 3093, 1 },
+    { 0xF933, 3094, 1 },
+    { 0xF934, 3095, 1 },
+    { 0xF935, 3096, 1 },
+    { 0xF936, 3097, 1 },
+    { 0xF937, 3098, 1 },
+    { 0xF938, 3099, 1 },
+    { 0xF939, 3100, 1 },
+    { 0xF93A, 3101, 1 },
+    { 0xF93B, 3102, 1 },
+    { 0xF93C, 3103, 1 },
+    { 0xF93D, 3104, 1 },
+    { 0xF93E, 3105, 1 },
+    { 0xF93F, 3106, 1 },
+    { 0xF940, 3107, 1 },
+    { 0xF941, 3108, 1 },
+    { 0xF942, 3109, 1 },
+    { 0xF943, 3110, 1 },
+    { 0xF944, 3111, 1 },
+    { 0xF945, 3112, 1 },
+    { 0xF946, 3113, 1 },
+    { 0xF947, 3114, 1 },
+    { 0xF948, 3115, 1 },
+    { 0xF949, 3116, 1 },
+    { 0xF94A, 3117, 1 },
+    { 0xF94B, 3118, 1 },
+    { 0xF94C, 3119, 1 },
+    { 0xF94D, 3120, 1 },
+    { 0xF94E, 3121, 1 },
+    { 0xF94F, 3122, 1 },
+    { 0xF950, 3123, 1 },
+    { 0xF951, 3124, 1 },
+    { 0xF952, 3125, 1 },
+    { 0xF953, 3126, 1 },
+    { 0xF954, 3127, 1 },
+    { 0xF955, 3128, 1 },
+    { 0xF956, 3129, 1 },
+    { 0xF957, 3130, 1 },
+    { 0xF958, 3131, 1 },
+    { 0xF959, 3132, 1 },
+    { 0xF95A, 3133, 1 },
+    { 0xF95B, 3134, 1 },
+    { 0xF95C, 3135, 1 },
+    { 0xF95D, 3136, 1 },
+    { 0xF95E, 3137, 1 },
+    { 0xF95F, 3138, 1 },
+    { 0xF960, 3139, 1 },
+    { 0xF961, 3140, 1 },
+    { 0xF962, 3141, 1 },
+    { 0xF963, 3142, 1 },
+    { 0xF964, 3143, 1 },
+    { 0xF965, 3144, 1 },
+    { 0xF966, 3145, 1 },
+    { 0xF967, 3146, 1 },
+    { 0xF968, 3147, 1 },
+    { 0xF969, 3148, 1 },
+    { 0xF96A, 3149, 1 },
+    { 0xF96B, 3150, 1 },
+    { 0xF96C, 3151, 1 },
+    { 0xF96D, 3152, 1 },
+    { 0xF96E, 3153, 1 },
+    { 0xF96F, 3154, 1 },
+    { 0xF970, 3155, 1 },
+    { 0xF971, 3156, 1 },
+    { 0xF972, 3157, 1 },
+    { 0xF973, 3158, 1 },
+    { 0xF974, 3159, 1 },
+    { 0xF975, 3160, 1 },
+    { 0xF976, 3161, 1 },
+    { 0xF977, 3162, 1 },
+    { 0xF978, 3163, 1 },
+    { 0xF979, 3164, 1 },
+    { 0xF97A, 3165, 1 },
+    { 0xF97B, 3166, 1 },
+    { 0xF97C, 3167, 1 },
+    { 0xF97D, 3168, 1 },
+    { 0xF97E, 3169, 1 },
+    { 0xF97F, 3170, 1 },
+    { 0xF980, 3171, 1 },
+    { 0xF981, 3172, 1 },
+    { 0xF982, 3173, 1 },
+    { 0xF983, 3174, 1 },
+    { 0xF984, 3175, 1 },
+    { 0xF985, 3176, 1 },
+    { 0xF986, 3177, 1 },
+    { 0xF987, 3178, 1 },
+    { 0xF988, 3179, 1 },
+    { 0xF989, 3180, 1 },
+    { 0xF98A, 3181, 1 },
+    { 0xF98B, 3182, 1 },
+    { 0xF98C, 3183, 1 },
+    { 0xF98D, 3184, 1 },
+    { 0xF98E, 3185, 1 },
+    { 0xF98F, 3186, 1 },
+    { 0xF990, 3187, 1 },
+    { 0xF991, 3188, 1 },
+    { 0xF992, 3189, 1 },
+    { 0xF993, 3190, 1 },
+    { 0xF994, 3191, 1 },
+    { 0xF995, 3192, 1 },
+    { 0xF996, 3193, 1 },
+    { 0xF997, 3194, 1 },
+    { 0xF998, 3195, 1 },
+    { 0xF999, 3196, 1 },
+    { 0xF99A, 3197, 1 },
+    { 0xF99B, 3198, 1 },
+    { 0xF99C, 3199, 1 },
+    { 0xF99D, 3200, 1 },
+    { 0xF99E, 3201, 1 },
+    { 0xF99F, 3202, 1 },
+    { 0xF9A0, 3203, 1 },
+    { 0xF9A1, 3204, 1 },
+    { 0xF9A2, 3205, 1 },
+    { 0xF9A3, 3206, 1 },
+    { 0xF9A4, 3207, 1 },
+    { 0xF9A5, 3208, 1 },
+    { 0xF9A6, 3209, 1 },
+    { 0xF9A7, 3210, 1 },
+    { 0xF9A8, 3211, 1 },
+    { 0xF9A9, 3212, 1 },
+    { 0xF9AA, 3213, 1 },
+    { 0xF9AB, 3214, 1 },
+    { 0xF9AC, 3215, 1 },
+    { 0xF9AD, 3216, 1 },
+    { 0xF9AE, 3217, 1 },
+    { 0xF9AF, 3218, 1 },
+    { 0xF9B0, 3219, 1 },
+    { 0xF9B1, 3220, 1 },
+    { 0xF9B2, 3221, 1 },
+    { 0xF9B3, 3222, 1 },
+    { 0xF9B4, 3223, 1 },
+    { 0xF9B5, 3224, 1 },
+    { 0xF9B6, 3225, 1 },
+    { 0xF9B7, 3226, 1 },
+    { 0xF9B8, 3227, 1 },
+    { 0xF9B9, 3228, 1 },
+    { 0xF9BA, 3229, 1 },
+    { 0xF9BB, 3230, 1 },
+    { 0xF9BC, 3231, 1 },
+    { 0xF9BD, 3232, 1 },
+    { 0xF9BE, 3233, 1 },
+    { 0xF9BF, 3234, 1 },
+    { 0xF9C0, 3235, 1 },
+    { 0xF9C1, 3236, 1 },
+    { 0xF9C2, 3237, 1 },
+    { 0xF9C3, 3238, 1 },
+    { 0xF9C4, 3239, 1 },
+    { 0xF9C5, 3240, 1 },
+    { 0xF9C6, 3241, 1 },
+    { 0xF9C7, 3242, 1 },
+    { 0xF9C8, 3243, 1 },
+    { 0xF9C9, 3244, 1 },
+    { 0xF9CA, 3245, 1 },
+    { 0xF9CB, 3246, 1 },
+    { 0xF9CC, 3247, 1 },
+    { 0xF9CD, 3248, 1 },
+    { 0xF9CE, 3249, 1 },
+    { 0xF9CF, 3250, 1 },
+    { 0xF9D0, 3251, 1 },
+    { 0xF9D1, 3252, 1 },
+    { 0xF9D2, 3253, 1 },
+    { 0xF9D3, 3254, 1 },
+    { 0xF9D4, 3255, 1 },
+    { 0xF9D5, 3256, 1 },
+    { 0xF9D6, 3257, 1 },
+    { 0xF9D7, 3258, 1 },
+    { 0xF9D8, 3259, 1 },
+    { 0xF9D9, 3260, 1 },
+    { 0xF9DA, 3261, 1 },
+    { 0xF9DB, 3262, 1 },
+    { 0xF9DC, 3263, 1 },
+    { 0xF9DD, 3264, 1 },
+    { 0xF9DE, 3265, 1 },
+    { 0xF9DF, 3266, 1 },
+    { 0xF9E0, 3267, 1 },
+    { 0xF9E1, 3268, 1 },
+    { 0xF9E2, 3269, 1 },
+    { 0xF9E3, 3270, 1 },
+    { 0xF9E4, 3271, 1 },
+    { 0xF9E5, 3272, 1 },
+    { 0xF9E6, 3273, 1 },
+    { 0xF9E7, 3274, 1 },
+    { 0xF9E8, 3275, 1 },
+    { 0xF9E9, 3276, 1 },
+    { 0xF9EA, 3277, 1 },
+    { 0xF9EB, 3278, 1 },
+    { 0xF9EC, 3279, 1 },
+    { 0xF9ED, 3280, 1 },
+    { 0xF9EE, 3281, 1 },
+    { 0xF9EF, 3282, 1 },
+    { 0xF9F0, 3283, 1 },
+    { 0xF9F1, 3284, 1 },
+    { 0xF9F2, 3285, 1 },
+    { 0xF9F3, 3286, 1 },
+    { 0xF9F4, 3287, 1 },
+    { 0xF9F5, 3288, 1 },
+    { 0xF9F6, 3289, 1 },
+    { 0xF9F7, 3290, 1 },
+    { 0xF9F8, 3291, 1 },
+    { 0xF9F9, 3292, 1 },
+    { 0xF9FA, 3293, 1 },
+    { 0xF9FB, 3294, 1 },
+    { 0xF9FC, 3295, 1 },
+    { 0xF9FD, 3296, 1 },
+    { 0xF9FE, 3297, 1 },
+    { 0xF9FF, 3298, 1 },
+    { 0xFA00, 3299, 1 },
+    { 0xFA01, 3300, 1 },
+    { 0xFA02, 3301, 1 },
+    { 0xFA03, 3302, 1 },
+    { 0xFA04, 3303, 1 },
+    { 0xFA05, 3304, 1 },
+    { 0xFA06, 3305, 1 },
+    { 0xFA07, 3306, 1 },
+    { 0xFA08, 3307, 1 },
+    { 0xFA09, 3308, 1 },
+    { 0xFA0A, 3309, 1 },
+    { 0xFA0B, 3310, 1 },
+    { 0xFA0C, 3311, 1 },
+    { 0xFA0D, 3312, 1 },
+    { 0xFA10, 3313, 1 },
+    { 0xFA12, 3314, 1 },
+    { 0xFA15, 3315, 1 },
+    { 0xFA16, 3316, 1 },
+    { 0xFA17, 3317, 1 },
+    { 0xFA18, 3318, 1 },
+    { 0xFA19, 3319, 1 },
+    { 0xFA1A, 3320, 1 },
+    { 0xFA1B, 3321, 1 },
+    { 0xFA1C, 3322, 1 },
+    { 0xFA1D, 3323, 1 },
+    { 0xFA1E, 3324, 1 },
+    { 0xFA20, 3325, 1 },
+    { 0xFA22, 3326, 1 },
+    { 0xFA25, 3327, 1 },
+    { 0xFA26, 3328, 1 },
+    { 0xFA2A, 3329, 1 },
+    { 0xFA2B, 3330, 1 },
+    { 0xFA2C, 3331, 1 },
+    { 0xFA2D, 3332, 1 },
+    { 0xFA2E, 3333, 1 },
+    { 0xFA2F, 3334, 1 },
+    { 0xFA30, 3335, 1 },
+    { 0xFA31, 3336, 1 },
+    { 0xFA32, 3337, 1 },
+    { 0xFA33, 3338, 1 },
+    { 0xFA34, 3339, 1 },
+    { 0xFA35, 3340, 1 },
+    { 0xFA36, 3341, 1 },
+    { 0xFA37, 3342, 1 },
+    { 0xFA38, 3343, 1 },
+    { 0xFA39, 3344, 1 },
+    { 0xFA3A, 3345, 1 },
+    { 0xFA3B, 3346, 1 },
+    { 0xFA3C, 3347, 1 },
+    { 0xFA3D, 3348, 1 },
+    { 0xFA3E, 3349, 1 },
+    { 0xFA3F, 3350, 1 },
+    { 0xFA40, 3351, 1 },
+    { 0xFA41, 3352, 1 },
+    { 0xFA42, 3353, 1 },
+    { 0xFA43, 3354, 1 },
+    { 0xFA44, 3355, 1 },
+    { 0xFA45, 3356, 1 },
+    { 0xFA46, 3357, 1 },
+    { 0xFA47, 3358, 1 },
+    { 0xFA48, 3359, 1 },
+    { 0xFA49, 3360, 1 },
+    { 0xFA4A, 3361, 1 },
+    { 0xFA4B, 3362, 1 },
+    { 0xFA4C, 3363, 1 },
+    { 0xFA4D, 3364, 1 },
+    { 0xFA4E, 3365, 1 },
+    { 0xFA4F, 3366, 1 },
+    { 0xFA50, 3367, 1 },
+    { 0xFA51, 3368, 1 },
+    { 0xFA52, 3369, 1 },
+    { 0xFA53, 3370, 1 },
+    { 0xFA54, 3371, 1 },
+    { 0xFA55, 3372, 1 },
+    { 0xFA56, 3373, 1 },
+    { 0xFA57, 3374, 1 },
+    { 0xFA58, 3375, 1 },
+    { 0xFA59, 3376, 1 },
+    { 0xFA5A, 3377, 1 },
+    { 0xFA5B, 3378, 1 },
+    { 0xFA5C, 3379, 1 },
+    { 0xFA5D, 3380, 1 },
+    { 0xFA5E, 3381, 1 },
+    { 0xFA5F, 3382, 1 },
+    { 0xFA60, 3383, 1 },
+    { 0xFA61, 3384, 1 },
+    { 0xFA62, 3385, 1 },
+    { 0xFA63, 3386, 1 },
+    { 0xFA64, 3387, 1 },
+    { 0xFA65, 3388, 1 },
+    { 0xFA66, 3389, 1 },
+    { 0xFA67, 3390, 1 },
+    { 0xFA68, 3391, 1 },
+    { 0xFA69, 3392, 1 },
+    { 0xFA6A, 3393, 1 },
+    { 0xFA6B, 3394, 1 },
+    { 0xFA6C, 3395, 1 },
+    { 0xFA6D, 3396, 1 },
+    { 0xFA70, 3397, 1 },
+    { 0xFA71, 3398, 1 },
+    { 0xFA72, 3399, 1 },
+    { 0xFA73, 3400, 1 },
+    { 0xFA74, 3401, 1 },
+    { 0xFA75, 3402, 1 },
+    { 0xFA76, 3403, 1 },
+    { 0xFA77, 3404, 1 },
+    { 0xFA78, 3405, 1 },
+    { 0xFA79, 3406, 1 },
+    { 0xFA7A, 3407, 1 },
+    { 0xFA7B, 3408, 1 },
+    { 0xFA7C, 3409, 1 },
+    { 0xFA7D, 3410, 1 },
+    { 0xFA7E, 3411, 1 },
+    { 0xFA7F, 3412, 1 },
+    { 0xFA80, 3413, 1 },
+    { 0xFA81, 3414, 1 },
+    { 0xFA82, 3415, 1 },
+    { 0xFA83, 3416, 1 },
+    { 0xFA84, 3417, 1 },
+    { 0xFA85, 3418, 1 },
+    { 0xFA86, 3419, 1 },
+    { 0xFA87, 3420, 1 },
+    { 0xFA88, 3421, 1 },
+    { 0xFA89, 3422, 1 },
+    { 0xFA8A, 3423, 1 },
+    { 0xFA8B, 3424, 1 },
+    { 0xFA8C, 3425, 1 },
+    { 0xFA8D, 3426, 1 },
+    { 0xFA8E, 3427, 1 },
+    { 0xFA8F, 3428, 1 },
+    { 0xFA90, 3429, 1 },
+    { 0xFA91, 3430, 1 },
+    { 0xFA92, 3431, 1 },
+    { 0xFA93, 3432, 1 },
+    { 0xFA94, 3433, 1 },
+    { 0xFA95, 3434, 1 },
+    { 0xFA96, 3435, 1 },
+    { 0xFA97, 3436, 1 },
+    { 0xFA98, 3437, 1 },
+    { 0xFA99, 3438, 1 },
+    { 0xFA9A, 3439, 1 },
+    { 0xFA9B, 3440, 1 },
+    { 0xFA9C, 3441, 1 },
+    { 0xFA9D, 3442, 1 },
+    { 0xFA9E, 3443, 1 },
+    { 0xFA9F, 3444, 1 },
+    { 0xFAA0, 3445, 1 },
+    { 0xFAA1, 3446, 1 },
+    { 0xFAA2, 3447, 1 },
+    { 0xFAA3, 3448, 1 },
+    { 0xFAA4, 3449, 1 },
+    { 0xFAA5, 3450, 1 },
+    { 0xFAA6, 3451, 1 },
+    { 0xFAA7, 3452, 1 },
+    { 0xFAA8, 3453, 1 },
+    { 0xFAA9, 3454, 1 },
+    { 0xFAAA, 3455, 1 },
+    { 0xFAAB, 3456, 1 },
+    { 0xFAAC, 3457, 1 },
+    { 0xFAAD, 3458, 1 },
+    { 0xFAAE, 3459, 1 },
+    { 0xFAAF, 3460, 1 },
+    { 0xFAB0, 3461, 1 },
+    { 0xFAB1, 3462, 1 },
+    { 0xFAB2, 3463, 1 },
+    { 0xFAB3, 3464, 1 },
+    { 0xFAB4, 3465, 1 },
+    { 0xFAB5, 3466, 1 },
+    { 0xFAB6, 3467, 1 },
+    { 0xFAB7, 3468, 1 },
+    { 0xFAB8, 3469, 1 },
+    { 0xFAB9, 3470, 1 },
+    { 0xFABA, 3471, 1 },
+    { 0xFABB, 3472, 1 },
+    { 0xFABC, 3473, 1 },
+    { 0xFABD, 3474, 1 },
+    { 0xFABE, 3475, 1 },
+    { 0xFABF, 3476, 1 },
+    { 0xFAC0, 3477, 1 },
+    { 0xFAC1, 3478, 1 },
+    { 0xFAC2, 3479, 1 },
+    { 0xFAC3, 3480, 1 },
+    { 0xFAC4, 3481, 1 },
+    { 0xFAC5, 3482, 1 },
+    { 0xFAC6, 3483, 1 },
+    { 0xFAC7, 3484, 1 },
+    { 0xFAC8, 3485, 1 },
+    { 0xFAC9, 3486, 1 },
+    { 0xFACA, 3487, 1 },
+    { 0xFACB, 3488, 1 },
+    { 0xFACC, 3489, 1 },
+    { 0xFACD, 3490, 1 },
+    { 0xFACE, 3491, 1 },
+    { 0xFACF, 3492, 1 },
+    { 0xFAD0, 3493, 1 },
+    { 0xFAD1, 3494, 1 },
+    { 0xFAD2, 3495, 1 },
+    { 0xFAD3, 3496, 1 },
+    { 0xFAD4, 3497, 1 },
+    { 0xFAD5, 3498, 1 },
+    { 0xFAD6, 3499, 1 },
+    { 0xFAD7, 3500, 1 },
+    { 0xFAD8, 3501, 1 },
+    { 0xFAD9, 3502, 1 },
+    { 0xFB00, 3503, 2 },
+    { 0xFB01, 3505, 2 },
+    { 0xFB02, 3507, 2 },
+    { 0xFB03, 3509, 3 },
+    { 0xFB04, 3512, 3 },
+    { 0xFB05, 3515, 2 },
+    { 0xFB06, 3517, 2 },
+    { 0xFB13, 3519, 2 },
+    { 0xFB14, 3521, 2 },
+    { 0xFB15, 3523, 2 },
+    { 0xFB16, 3525, 2 },
+    { 0xFB17, 3527, 2 },
+    { 0xFB1D, 3529, 2 },
+    { 0xFB1F, 3531, 2 },
+    { 0xFB2A, 3533, 2 },
+    { 0xFB2B, 3535, 2 },
+    { 0xFB2C, 3537, 3 },
+    { 0xFB2D, 3540, 3 },
+    { 0xFB2E, 3543, 2 },
+    { 0xFB2F, 3545, 2 },
+    { 0xFB30, 3547, 2 },
+    { 0xFB31, 3549, 2 },
+    { 0xFB32, 3551, 2 },
+    { 0xFB33, 3553, 2 },
+    { 0xFB34, 3555, 2 },
+    { 0xFB35, 3557, 2 },
+    { 0xFB36, 3559, 2 },
+    { 0xFB38, 3561, 2 },
+    { 0xFB39, 3563, 2 },
+    { 0xFB3A, 3565, 2 },
+    { 0xFB3B, 3567, 2 },
+    { 0xFB3C, 3569, 2 },
+    { 0xFB3E, 3571, 2 },
+    { 0xFB40, 3573, 2 },
+    { 0xFB41, 3575, 2 },
+    { 0xFB43, 3577, 2 },
+    { 0xFB44, 3579, 2 },
+    { 0xFB46, 3581, 2 },
+    { 0xFB47, 3583, 2 },
+    { 0xFB48, 3585, 2 },
+    { 0xFB49, 3587, 2 },
+    { 0xFB4A, 3589, 2 },
+    { 0xFB4B, 3591, 2 },
+    { 0xFB4C, 3593, 2 },
+    { 0xFB4D, 3595, 2 },
+    { 0xFB4E, 3597, 2 },
+    { 0xFF21, 3599, 1 },
+    { 0xFF22, 3600, 1 },
+    { 0xFF23, 3601, 1 },
+    { 0xFF24, 3602, 1 },
+    { 0xFF25, 3603, 1 },
+    { 0xFF26, 3604, 1 },
+    { 0xFF27, 3605, 1 },
+    { 0xFF28, 3606, 1 },
+    { 0xFF29, 3607, 1 },
+    { 0xFF2A, 3608, 1 },
+    { 0xFF2B, 3609, 1 },
+    { 0xFF2C, 3610, 1 },
+    { 0xFF2D, 3611, 1 },
+    { 0xFF2E, 3612, 1 },
+    { 0xFF2F, 3613, 1 },
+    { 0xFF30, 3614, 1 },
+    { 0xFF31, 3615, 1 },
+    { 0xFF32, 3616, 1 },
+    { 0xFF33, 3617, 1 },
+    { 0xFF34, 3618, 1 },
+    { 0xFF35, 3619, 1 },
+    { 0xFF36, 3620, 1 },
+    { 0xFF37, 3621, 1 },
+    { 0xFF38, 3622, 1 },
+    { 0xFF39, 3623, 1 },
+    { 0xFF3A, 3624, 1 },
+    { 0x10400, 3625, 1 },
+    { 0x10401, 3626, 1 },
+    { 0x10402, 3627, 1 },
+    { 0x10403, 3628, 1 },
+    { 0x10404, 3629, 1 },
+    { 0x10405, 3630, 1 },
+    { 0x10406, 3631, 1 },
+    { 0x10407, 3632, 1 },
+    { 0x10408, 3633, 1 },
+    { 0x10409, 3634, 1 },
+    { 0x1040A, 3635, 1 },
+    { 0x1040B, 3636, 1 },
+    { 0x1040C, 3637, 1 },
+    { 0x1040D, 3638, 1 },
+    { 0x1040E, 3639, 1 },
+    { 0x1040F, 3640, 1 },
+    { 0x10410, 3641, 1 },
+    { 0x10411, 3642, 1 },
+    { 0x10412, 3643, 1 },
+    { 0x10413, 3644, 1 },
+    { 0x10414, 3645, 1 },
+    { 0x10415, 3646, 1 },
+    { 0x10416, 3647, 1 },
+    { 0x10417, 3648, 1 },
+    { 0x10418, 3649, 1 },
+    { 0x10419, 3650, 1 },
+    { 0x1041A, 3651, 1 },
+    { 0x1041B, 3652, 1 },
+    { 0x1041C, 3653, 1 },
+    { 0x1041D, 3654, 1 },
+    { 0x1041E, 3655, 1 },
+    { 0x1041F, 3656, 1 },
+    { 0x10420, 3657, 1 },
+    { 0x10421, 3658, 1 },
+    { 0x10422, 3659, 1 },
+    { 0x10423, 3660, 1 },
+    { 0x10424, 3661, 1 },
+    { 0x10425, 3662, 1 },
+    { 0x10426, 3663, 1 },
+    { 0x10427, 3664, 1 },
+    { 0x104B0, 3665, 1 },
+    { 0x104B1, 3666, 1 },
+    { 0x104B2, 3667, 1 },
+    { 0x104B3, 3668, 1 },
+    { 0x104B4, 3669, 1 },
+    { 0x104B5, 3670, 1 },
+    { 0x104B6, 3671, 1 },
+    { 0x104B7, 3672, 1 },
+    { 0x104B8, 3673, 1 },
+    { 0x104B9, 3674, 1 },
+    { 0x104BA, 3675, 1 },
+    { 0x104BB, 3676, 1 },
+    { 0x104BC, 3677, 1 },
+    { 0x104BD, 3678, 1 },
+    { 0x104BE, 3679, 1 },
+    { 0x104BF, 3680, 1 },
+    { 0x104C0, 3681, 1 },
+    { 0x104C1, 3682, 1 },
+    { 0x104C2, 3683, 1 },
+    { 0x104C3, 3684, 1 },
+    { 0x104C4, 3685, 1 },
+    { 0x104C5, 3686, 1 },
+    { 0x104C6, 3687, 1 },
+    { 0x104C7, 3688, 1 },
+    { 0x104C8, 3689, 1 },
+    { 0x104C9, 3690, 1 },
+    { 0x104CA, 3691, 1 },
+    { 0x104CB, 3692, 1 },
+    { 0x104CC, 3693, 1 },
+    { 0x104CD, 3694, 1 },
+    { 0x104CE, 3695, 1 },
+    { 0x104CF, 3696, 1 },
+    { 0x104D0, 3697, 1 },
+    { 0x104D1, 3698, 1 },
+    { 0x104D2, 3699, 1 },
+    { 0x104D3, 3700, 1 },
+    { 0x10570, 3701, 1 },
+    { 0x10571, 3702, 1 },
+    { 0x10572, 3703, 1 },
+    { 0x10573, 3704, 1 },
+    { 0x10574, 3705, 1 },
+    { 0x10575, 3706, 1 },
+    { 0x10576, 3707, 1 },
+    { 0x10577, 3708, 1 },
+    { 0x10578, 3709, 1 },
+    { 0x10579, 3710, 1 },
+    { 0x1057A, 3711, 1 },
+    { 0x1057C, 3712, 1 },
+    { 0x1057D, 3713, 1 },
+    { 0x1057E, 3714, 1 },
+    { 0x1057F, 3715, 1 },
+    { 0x10580, 3716, 1 },
+    { 0x10581, 3717, 1 },
+    { 0x10582, 3718, 1 },
+    { 0x10583, 3719, 1 },
+    { 0x10584, 3720, 1 },
+    { 0x10585, 3721, 1 },
+    { 0x10586, 3722, 1 },
+    { 0x10587, 3723, 1 },
+    { 0x10588, 3724, 1 },
+    { 0x10589, 3725, 1 },
+    { 0x1058A, 3726, 1 },
+    { 0x1058C, 3727, 1 },
+    { 0x1058D, 3728, 1 },
+    { 0x1058E, 3729, 1 },
+    { 0x1058F, 3730, 1 },
+    { 0x10590, 3731, 1 },
+    { 0x10591, 3732, 1 },
+    { 0x10592, 3733, 1 },
+    { 0x10594, 3734, 1 },
+    { 0x10595, 3735, 1 },
+    { 0x10C80, 3736, 1 },
+    { 0x10C81, 3737, 1 },
+    { 0x10C82, 3738, 1 },
+    { 0x10C83, 3739, 1 },
+    { 0x10C84, 3740, 1 },
+    { 0x10C85, 3741, 1 },
+    { 0x10C86, 3742, 1 },
+    { 0x10C87, 3743, 1 },
+    { 0x10C88, 3744, 1 },
+    { 0x10C89, 3745, 1 },
+    { 0x10C8A, 3746, 1 },
+    { 0x10C8B, 3747, 1 },
+    { 0x10C8C, 3748, 1 },
+    { 0x10C8D, 3749, 1 },
+    { 0x10C8E, 3750, 1 },
+    { 0x10C8F, 3751, 1 },
+    { 0x10C90, 3752, 1 },
+    { 0x10C91, 3753, 1 },
+    { 0x10C92, 3754, 1 },
+    { 0x10C93, 3755, 1 },
+    { 0x10C94, 3756, 1 },
+    { 0x10C95, 3757, 1 },
+    { 0x10C96, 3758, 1 },
+    { 0x10C97, 3759, 1 },
+    { 0x10C98, 3760, 1 },
+    { 0x10C99, 3761, 1 },
+    { 0x10C9A, 3762, 1 },
+    { 0x10C9B, 3763, 1 },
+    { 0x10C9C, 3764, 1 },
+    { 0x10C9D, 3765, 1 },
+    { 0x10C9E, 3766, 1 },
+    { 0x10C9F, 3767, 1 },
+    { 0x10CA0, 3768, 1 },
+    { 0x10CA1, 3769, 1 },
+    { 0x10CA2, 3770, 1 },
+    { 0x10CA3, 3771, 1 },
+    { 0x10CA4, 3772, 1 },
+    { 0x10CA5, 3773, 1 },
+    { 0x10CA6, 3774, 1 },
+    { 0x10CA7, 3775, 1 },
+    { 0x10CA8, 3776, 1 },
+    { 0x10CA9, 3777, 1 },
+    { 0x10CAA, 3778, 1 },
+    { 0x10CAB, 3779, 1 },
+    { 0x10CAC, 3780, 1 },
+    { 0x10CAD, 3781, 1 },
+    { 0x10CAE, 3782, 1 },
+    { 0x10CAF, 3783, 1 },
+    { 0x10CB0, 3784, 1 },
+    { 0x10CB1, 3785, 1 },
+    { 0x10CB2, 3786, 1 },
+    { 0x1109A, 3787, 2 },
+    { 0x1109C, 3789, 2 },
+    { 0x110AB, 3791, 2 },
+    { 0x1112E, 3793, 2 },
+    { 0x1112F, 3795, 2 },
+    { 0x1134B, 3797, 2 },
+    { 0x1134C, 3799, 2 },
+    { 0x114BB, 3801, 2 },
+    { 0x114BC, 3803, 2 },
+    { 0x114BE, 3805, 2 },
+    { 0x115BA, 3807, 2 },
+    { 0x115BB, 3809, 2 },
+    { 0x118A0, 3811, 1 },
+    { 0x118A1, 3812, 1 },
+    { 0x118A2, 3813, 1 },
+    { 0x118A3, 3814, 1 },
+    { 0x118A4, 3815, 1 },
+    { 0x118A5, 3816, 1 },
+    { 0x118A6, 3817, 1 },
+    { 0x118A7, 3818, 1 },
+    { 0x118A8, 3819, 1 },
+    { 0x118A9, 3820, 1 },
+    { 0x118AA, 3821, 1 },
+    { 0x118AB, 3822, 1 },
+    { 0x118AC, 3823, 1 },
+    { 0x118AD, 3824, 1 },
+    { 0x118AE, 3825, 1 },
+    { 0x118AF, 3826, 1 },
+    { 0x118B0, 3827, 1 },
+    { 0x118B1, 3828, 1 },
+    { 0x118B2, 3829, 1 },
+    { 0x118B3, 3830, 1 },
+    { 0x118B4, 3831, 1 },
+    { 0x118B5, 3832, 1 },
+    { 0x118B6, 3833, 1 },
+    { 0x118B7, 3834, 1 },
+    { 0x118B8, 3835, 1 },
+    { 0x118B9, 3836, 1 },
+    { 0x118BA, 3837, 1 },
+    { 0x118BB, 3838, 1 },
+    { 0x118BC, 3839, 1 },
+    { 0x118BD, 3840, 1 },
+    { 0x118BE, 3841, 1 },
+    { 0x118BF, 3842, 1 },
+    { 0x11938, 3843, 2 },
+    { 0x16E40, 3845, 1 },
+    { 0x16E41, 3846, 1 },
+    { 0x16E42, 3847, 1 },
+    { 0x16E43, 3848, 1 },
+    { 0x16E44, 3849, 1 },
+    { 0x16E45, 3850, 1 },
+    { 0x16E46, 3851, 1 },
+    { 0x16E47, 3852, 1 },
+    { 0x16E48, 3853, 1 },
+    { 0x16E49, 3854, 1 },
+    { 0x16E4A, 3855, 1 },
+    { 0x16E4B, 3856, 1 },
+    { 0x16E4C, 3857, 1 },
+    { 0x16E4D, 3858, 1 },
+    { 0x16E4E, 3859, 1 },
+    { 0x16E4F, 3860, 1 },
+    { 0x16E50, 3861, 1 },
+    { 0x16E51, 3862, 1 },
+    { 0x16E52, 3863, 1 },
+    { 0x16E53, 3864, 1 },
+    { 0x16E54, 3865, 1 },
+    { 0x16E55, 3866, 1 },
+    { 0x16E56, 3867, 1 },
+    { 0x16E57, 3868, 1 },
+    { 0x16E58, 3869, 1 },
+    { 0x16E59, 3870, 1 },
+    { 0x16E5A, 3871, 1 },
+    { 0x16E5B, 3872, 1 },
+    { 0x16E5C, 3873, 1 },
+    { 0x16E5D, 3874, 1 },
+    { 0x16E5E, 3875, 1 },
+    { 0x16E5F, 3876, 1 },
+    { 0x1D15E, 3877, 2 },
+    { 0x1D15F, 3879, 2 },
+    { 0x1D160, 3881, 3 },
+    { 0x1D161, 3884, 3 },
+    { 0x1D162, 3887, 3 },
+    { 0x1D163, 3890, 3 },
+    { 0x1D164, 3893, 3 },
+    { 0x1D1BB, 3896, 2 },
+    { 0x1D1BC, 3898, 2 },
+    { 0x1D1BD, 3900, 3 },
+    { 0x1D1BE, 3903, 3 },
+    { 0x1D1BF, 3906, 3 },
+    { 0x1D1C0, 3909, 3 },
+    { 0x1E900, 3912, 1 },
+    { 0x1E901, 3913, 1 },
+    { 0x1E902, 3914, 1 },
+    { 0x1E903, 3915, 1 },
+    { 0x1E904, 3916, 1 },
+    { 0x1E905, 3917, 1 },
+    { 0x1E906, 3918, 1 },
+    { 0x1E907, 3919, 1 },
+    { 0x1E908, 3920, 1 },
+    { 0x1E909, 3921, 1 },
+    { 0x1E90A, 3922, 1 },
+    { 0x1E90B, 3923, 1 },
+    { 0x1E90C, 3924, 1 },
+    { 0x1E90D, 3925, 1 },
+    { 0x1E90E, 3926, 1 },
+    { 0x1E90F, 3927, 1 },
+    { 0x1E910, 3928, 1 },
+    { 0x1E911, 3929, 1 },
+    { 0x1E912, 3930, 1 },
+    { 0x1E913, 3931, 1 },
+    { 0x1E914, 3932, 1 },
+    { 0x1E915, 3933, 1 },
+    { 0x1E916, 3934, 1 },
+    { 0x1E917, 3935, 1 },
+    { 0x1E918, 3936, 1 },
+    { 0x1E919, 3937, 1 },
+    { 0x1E91A, 3938, 1 },
+    { 0x1E91B, 3939, 1 },
+    { 0x1E91C, 3940, 1 },
+    { 0x1E91D, 3941, 1 },
+    { 0x1E91E, 3942, 1 },
+    { 0x1E91F, 3943, 1 },
+    { 0x1E920, 3944, 1 },
+    { 0x1E921, 3945, 1 },
+    { 0x2F800, 3946, 1 },
+    { 0x2F801, 3947, 1 },
+    { 0x2F802, 3948, 1 },
+    { 0x2F803, 3949, 1 },
+    { 0x2F804, 3950, 1 },
+    { 0x2F805, 3951, 1 },
+    { 0x2F806, 3952, 1 },
+    { 0x2F807, 3953, 1 },
+    { 0x2F808, 3954, 1 },
+    { 0x2F809, 3955, 1 },
+    { 0x2F80A, 3956, 1 },
+    { 0x2F80B, 3957, 1 },
+    { 0x2F80C, 3958, 1 },
+    { 0x2F80D, 3959, 1 },
+    { 0x2F80E, 3960, 1 },
+    { 0x2F80F, 3961, 1 },
+    { 0x2F810, 3962, 1 },
+    { 0x2F811, 3963, 1 },
+    { 0x2F812, 3964, 1 },
+    { 0x2F813, 3965, 1 },
+    { 0x2F814, 3966, 1 },
+    { 0x2F815, 3967, 1 },
+    { 0x2F816, 3968, 1 },
+    { 0x2F817, 3969, 1 },
+    { 0x2F818, 3970, 1 },
+    { 0x2F819, 3971, 1 },
+    { 0x2F81A, 3972, 1 },
+    { 0x2F81B, 3973, 1 },
+    { 0x2F81C, 3974, 1 },
+    { 0x2F81D, 3975, 1 },
+    { 0x2F81E, 3976, 1 },
+    { 0x2F81F, 3977, 1 },
+    { 0x2F820, 3978, 1 },
+    { 0x2F821, 3979, 1 },
+    { 0x2F822, 3980, 1 },
+    { 0x2F823, 3981, 1 },
+    { 0x2F824, 3982, 1 },
+    { 0x2F825, 3983, 1 },
+    { 0x2F826, 3984, 1 },
+    { 0x2F827, 3985, 1 },
+    { 0x2F828, 3986, 1 },
+    { 0x2F829, 3987, 1 },
+    { 0x2F82A, 3988, 1 },
+    { 0x2F82B, 3989, 1 },
+    { 0x2F82C, 3990, 1 },
+    { 0x2F82D, 3991, 1 },
+    { 0x2F82E, 3992, 1 },
+    { 0x2F82F, 3993, 1 },
+    { 0x2F830, 3994, 1 },
+    { 0x2F831, 3995, 1 },
+    { 0x2F832, 3996, 1 },
+    { 0x2F833, 3997, 1 },
+    { 0x2F834, 3998, 1 },
+    { 0x2F835, 3999, 1 },
+    { 0x2F836, 4000, 1 },
+    { 0x2F837, 4001, 1 },
+    { 0x2F838, 4002, 1 },
+    { 0x2F839, 4003, 1 },
+    { 0x2F83A, 4004, 1 },
+    { 0x2F83B, 4005, 1 },
+    { 0x2F83C, 4006, 1 },
+    { 0x2F83D, 4007, 1 },
+    { 0x2F83E, 4008, 1 },
+    { 0x2F83F, 4009, 1 },
+    { 0x2F840, 4010, 1 },
+    { 0x2F841, 4011, 1 },
+    { 0x2F842, 4012, 1 },
+    { 0x2F843, 4013, 1 },
+    { 0x2F844, 4014, 1 },
+    { 0x2F845, 4015, 1 },
+    { 0x2F846, 4016, 1 },
+    { 0x2F847, 4017, 1 },
+    { 0x2F848, 4018, 1 },
+    { 0x2F849, 4019, 1 },
+    { 0x2F84A, 4020, 1 },
+    { 0x2F84B, 4021, 1 },
+    { 0x2F84C, 4022, 1 },
+    { 0x2F84D, 4023, 1 },
+    { 0x2F84E, 4024, 1 },
+    { 0x2F84F, 4025, 1 },
+    { 0x2F850, 4026, 1 },
+    { 0x2F851, 4027, 1 },
+    { 0x2F852, 4028, 1 },
+    { 0x2F853, 4029, 1 },
+    { 0x2F854, 4030, 1 },
+    { 0x2F855, 4031, 1 },
+    { 0x2F856, 4032, 1 },
+    { 0x2F857, 4033, 1 },
+    { 0x2F858, 4034, 1 },
+    { 0x2F859, 4035, 1 },
+    { 0x2F85A, 4036, 1 },
+    { 0x2F85B, 4037, 1 },
+    { 0x2F85C, 4038, 1 },
+    { 0x2F85D, 4039, 1 },
+    { 0x2F85E, 4040, 1 },
+    { 0x2F85F, 4041, 1 },
+    { 0x2F860, 4042, 1 },
+    { 0x2F861, 4043, 1 },
+    { 0x2F862, 4044, 1 },
+    { 0x2F863, 4045, 1 },
+    { 0x2F864, 4046, 1 },
+    { 0x2F865, 4047, 1 },
+    { 0x2F866, 4048, 1 },
+    { 0x2F867, 4049, 1 },
+    { 0x2F868, 4050, 1 },
+    { 0x2F869, 4051, 1 },
+    { 0x2F86A, 4052, 1 },
+    { 0x2F86B, 4053, 1 },
+    { 0x2F86C, 4054, 1 },
+    { 0x2F86D, 4055, 1 },
+    { 0x2F86E, 4056, 1 },
+    { 0x2F86F, 4057, 1 },
+    { 0x2F870, 4058, 1 },
+    { 0x2F871, 4059, 1 },
+    { 0x2F872, 4060, 1 },
+    { 0x2F873, 4061, 1 },
+    { 0x2F874, 4062, 1 },
+    { 0x2F875, 4063, 1 },
+    { 0x2F876, 4064, 1 },
+    { 0x2F877, 4065, 1 },
+    { 0x2F878, 4066, 1 },
+    { 0x2F879, 4067, 1 },
+    { 0x2F87A, 4068, 1 },
+    { 0x2F87B, 4069, 1 },
+    { 0x2F87C, 4070, 1 },
+    { 0x2F87D, 4071, 1 },
+    { 0x2F87E, 4072, 1 },
+    { 0x2F87F, 4073, 1 },
+    { 0x2F880, 4074, 1 },
+    { 0x2F881, 4075, 1 },
+    { 0x2F882, 4076, 1 },
+    { 0x2F883, 4077, 1 },
+    { 0x2F884, 4078, 1 },
+    { 0x2F885, 4079, 1 },
+    { 0x2F886, 4080, 1 },
+    { 0x2F887, 4081, 1 },
+    { 0x2F888, 4082, 1 },
+    { 0x2F889, 4083, 1 },
+    { 0x2F88A, 4084, 1 },
+    { 0x2F88B, 4085, 1 },
+    { 0x2F88C, 4086, 1 },
+    { 0x2F88D, 4087, 1 },
+    { 0x2F88E, 4088, 1 },
+    { 0x2F88F, 4089, 1 },
+    { 0x2F890, 4090, 1 },
+    { 0x2F891, 4091, 1 },
+    { 0x2F892, 4092, 1 },
+    { 0x2F893, 4093, 1 },
+    { 0x2F894, 4094, 1 },
+    { 0x2F895, 4095, 1 },
+    { 0x2F896, 4096, 1 },
+    { 0x2F897, 4097, 1 },
+    { 0x2F898, 4098, 1 },
+    { 0x2F899, 4099, 1 },
+    { 0x2F89A, 4100, 1 },
+    { 0x2F89B, 4101, 1 },
+    { 0x2F89C, 4102, 1 },
+    { 0x2F89D, 4103, 1 },
+    { 0x2F89E, 4104, 1 },
+    { 0x2F89F, 4105, 1 },
+    { 0x2F8A0, 4106, 1 },
+    { 0x2F8A1, 4107, 1 },
+    { 0x2F8A2, 4108, 1 },
+    { 0x2F8A3, 4109, 1 },
+    { 0x2F8A4, 4110, 1 },
+    { 0x2F8A5, 4111, 1 },
+    { 0x2F8A6, 4112, 1 },
+    { 0x2F8A7, 4113, 1 },
+    { 0x2F8A8, 4114, 1 },
+    { 0x2F8A9, 4115, 1 },
+    { 0x2F8AA, 4116, 1 },
+    { 0x2F8AB, 4117, 1 },
+    { 0x2F8AC, 4118, 1 },
+    { 0x2F8AD, 4119, 1 },
+    { 0x2F8AE, 4120, 1 },
+    { 0x2F8AF, 4121, 1 },
+    { 0x2F8B0, 4122, 1 },
+    { 0x2F8B1, 4123, 1 },
+    { 0x2F8B2, 4124, 1 },
+    { 0x2F8B3, 4125, 1 },
+    { 0x2F8B4, 4126, 1 },
+    { 0x2F8B5, 4127, 1 },
+    { 0x2F8B6, 4128, 1 },
+    { 0x2F8B7, 4129, 1 },
+    { 0x2F8B8, 4130, 1 },
+    { 0x2F8B9, 4131, 1 },
+    { 0x2F8BA, 4132, 1 },
+    { 0x2F8BB, 4133, 1 },
+    { 0x2F8BC, 4134, 1 },
+    { 0x2F8BD, 4135, 1 },
+    { 0x2F8BE, 4136, 1 },
+    { 0x2F8BF, 4137, 1 },
+    { 0x2F8C0, 4138, 1 },
+    { 0x2F8C1, 4139, 1 },
+    { 0x2F8C2, 4140, 1 },
+    { 0x2F8C3, 4141, 1 },
+    { 0x2F8C4, 4142, 1 },
+    { 0x2F8C5, 4143, 1 },
+    { 0x2F8C6, 4144, 1 },
+    { 0x2F8C7, 4145, 1 },
+    { 0x2F8C8, 4146, 1 },
+    { 0x2F8C9, 4147, 1 },
+    { 0x2F8CA, 4148, 1 },
+    { 0x2F8CB, 4149, 1 },
+    { 0x2F8CC, 4150, 1 },
+    { 0x2F8CD, 4151, 1 },
+    { 0x2F8CE, 4152, 1 },
+    { 0x2F8CF, 4153, 1 },
+    { 0x2F8D0, 4154, 1 },
+    { 0x2F8D1, 4155, 1 },
+    { 0x2F8D2, 4156, 1 },
+    { 0x2F8D3, 4157, 1 },
+    { 0x2F8D4, 4158, 1 },
+    { 0x2F8D5, 4159, 1 },
+    { 0x2F8D6, 4160, 1 },
+    { 0x2F8D7, 4161, 1 },
+    { 0x2F8D8, 4162, 1 },
+    { 0x2F8D9, 4163, 1 },
+    { 0x2F8DA, 4164, 1 },
+    { 0x2F8DB, 4165, 1 },
+    { 0x2F8DC, 4166, 1 },
+    { 0x2F8DD, 4167, 1 },
+    { 0x2F8DE, 4168, 1 },
+    { 0x2F8DF, 4169, 1 },
+    { 0x2F8E0, 4170, 1 },
+    { 0x2F8E1, 4171, 1 },
+    { 0x2F8E2, 4172, 1 },
+    { 0x2F8E3, 4173, 1 },
+    { 0x2F8E4, 4174, 1 },
+    { 0x2F8E5, 4175, 1 },
+    { 0x2F8E6, 4176, 1 },
+    { 0x2F8E7, 4177, 1 },
+    { 0x2F8E8, 4178, 1 },
+    { 0x2F8E9, 4179, 1 },
+    { 0x2F8EA, 4180, 1 },
+    { 0x2F8EB, 4181, 1 },
+    { 0x2F8EC, 4182, 1 },
+    { 0x2F8ED, 4183, 1 },
+    { 0x2F8EE, 4184, 1 },
+    { 0x2F8EF, 4185, 1 },
+    { 0x2F8F0, 4186, 1 },
+    { 0x2F8F1, 4187, 1 },
+    { 0x2F8F2, 4188, 1 },
+    { 0x2F8F3, 4189, 1 },
+    { 0x2F8F4, 4190, 1 },
+    { 0x2F8F5, 4191, 1 },
+    { 0x2F8F6, 4192, 1 },
+    { 0x2F8F7, 4193, 1 },
+    { 0x2F8F8, 4194, 1 },
+    { 0x2F8F9, 4195, 1 },
+    { 0x2F8FA, 4196, 1 },
+    { 0x2F8FB, 4197, 1 },
+    { 0x2F8FC, 4198, 1 },
+    { 0x2F8FD, 4199, 1 },
+    { 0x2F8FE, 4200, 1 },
+    { 0x2F8FF, 4201, 1 },
+    { 0x2F900, 4202, 1 },
+    { 0x2F901, 4203, 1 },
+    { 0x2F902, 4204, 1 },
+    { 0x2F903, 4205, 1 },
+    { 0x2F904, 4206, 1 },
+    { 0x2F905, 4207, 1 },
+    { 0x2F906, 4208, 1 },
+    { 0x2F907, 4209, 1 },
+    { 0x2F908, 4210, 1 },
+    { 0x2F909, 4211, 1 },
+    { 0x2F90A, 4212, 1 },
+    { 0x2F90B, 4213, 1 },
+    { 0x2F90C, 4214, 1 },
+    { 0x2F90D, 4215, 1 },
+    { 0x2F90E, 4216, 1 },
+    { 0x2F90F, 4217, 1 },
+    { 0x2F910, 4218, 1 },
+    { 0x2F911, 4219, 1 },
+    { 0x2F912, 4220, 1 },
+    { 0x2F913, 4221, 1 },
+    { 0x2F914, 4222, 1 },
+    { 0x2F915, 4223, 1 },
+    { 0x2F916, 4224, 1 },
+    { 0x2F917, 4225, 1 },
+    { 0x2F918, 4226, 1 },
+    { 0x2F919, 4227, 1 },
+    { 0x2F91A, 4228, 1 },
+    { 0x2F91B, 4229, 1 },
+    { 0x2F91C, 4230, 1 },
+    { 0x2F91D, 4231, 1 },
+    { 0x2F91E, 4232, 1 },
+    { 0x2F91F, 4233, 1 },
+    { 0x2F920, 4234, 1 },
+    { 0x2F921, 4235, 1 },
+    { 0x2F922, 4236, 1 },
+    { 0x2F923, 4237, 1 },
+    { 0x2F924, 4238, 1 },
+    { 0x2F925, 4239, 1 },
+    { 0x2F926, 4240, 1 },
+    { 0x2F927, 4241, 1 },
+    { 0x2F928, 4242, 1 },
+    { 0x2F929, 4243, 1 },
+    { 0x2F92A, 4244, 1 },
+    { 0x2F92B, 4245, 1 },
+    { 0x2F92C, 4246, 1 },
+    { 0x2F92D, 4247, 1 },
+    { 0x2F92E, 4248, 1 },
+    { 0x2F92F, 4249, 1 },
+    { 0x2F930, 4250, 1 },
+    { 0x2F931, 4251, 1 },
+    { 0x2F932, 4252, 1 },
+    { 0x2F933, 4253, 1 },
+    { 0x2F934, 4254, 1 },
+    { 0x2F935, 4255, 1 },
+    { 0x2F936, 4256, 1 },
+    { 0x2F937, 4257, 1 },
+    { 0x2F938, 4258, 1 },
+    { 0x2F939, 4259, 1 },
+    { 0x2F93A, 4260, 1 },
+    { 0x2F93B, 4261, 1 },
+    { 0x2F93C, 4262, 1 },
+    { 0x2F93D, 4263, 1 },
+    { 0x2F93E, 4264, 1 },
+    { 0x2F93F, 4265, 1 },
+    { 0x2F940, 4266, 1 },
+    { 0x2F941, 4267, 1 },
+    { 0x2F942, 4268, 1 },
+    { 0x2F943, 4269, 1 },
+    { 0x2F944, 4270, 1 },
+    { 0x2F945, 4271, 1 },
+    { 0x2F946, 4272, 1 },
+    { 0x2F947, 4273, 1 },
+    { 0x2F948, 4274, 1 },
+    { 0x2F949, 4275, 1 },
+    { 0x2F94A, 4276, 1 },
+    { 0x2F94B, 4277, 1 },
+    { 0x2F94C, 4278, 1 },
+    { 0x2F94D, 4279, 1 },
+    { 0x2F94E, 4280, 1 },
+    { 0x2F94F, 4281, 1 },
+    { 0x2F950, 4282, 1 },
+    { 0x2F951, 4283, 1 },
+    { 0x2F952, 4284, 1 },
+    { 0x2F953, 4285, 1 },
+    { 0x2F954, 4286, 1 },
+    { 0x2F955, 4287, 1 },
+    { 0x2F956, 4288, 1 },
+    { 0x2F957, 4289, 1 },
+    { 0x2F958, 4290, 1 },
+    { 0x2F959, 4291, 1 },
+    { 0x2F95A, 4292, 1 },
+    { 0x2F95B, 4293, 1 },
+    { 0x2F95C, 4294, 1 },
+    { 0x2F95D, 4295, 1 },
+    { 0x2F95E, 4296, 1 },
+    { 0x2F95F, 4297, 1 },
+    { 0x2F960, 4298, 1 },
+    { 0x2F961, 4299, 1 },
+    { 0x2F962, 4300, 1 },
+    { 0x2F963, 4301, 1 },
+    { 0x2F964, 4302, 1 },
+    { 0x2F965, 4303, 1 },
+    { 0x2F966, 4304, 1 },
+    { 0x2F967, 4305, 1 },
+    { 0x2F968, 4306, 1 },
+    { 0x2F969, 4307, 1 },
+    { 0x2F96A, 4308, 1 },
+    { 0x2F96B, 4309, 1 },
+    { 0x2F96C, 4310, 1 },
+    { 0x2F96D, 4311, 1 },
+    { 0x2F96E, 4312, 1 },
+    { 0x2F96F, 4313, 1 },
+    { 0x2F970, 4314, 1 },
+    { 0x2F971, 4315, 1 },
+    { 0x2F972, 4316, 1 },
+    { 0x2F973, 4317, 1 },
+    { 0x2F974, 4318, 1 },
+    { 0x2F975, 4319, 1 },
+    { 0x2F976, 4320, 1 },
+    { 0x2F977, 4321, 1 },
+    { 0x2F978, 4322, 1 },
+    { 0x2F979, 4323, 1 },
+    { 0x2F97A, 4324, 1 },
+    { 0x2F97B, 4325, 1 },
+    { 0x2F97C, 4326, 1 },
+    { 0x2F97D, 4327, 1 },
+    { 0x2F97E, 4328, 1 },
+    { 0x2F97F, 4329, 1 },
+    { 0x2F980, 4330, 1 },
+    { 0x2F981, 4331, 1 },
+    { 0x2F982, 4332, 1 },
+    { 0x2F983, 4333, 1 },
+    { 0x2F984, 4334, 1 },
+    { 0x2F985, 4335, 1 },
+    { 0x2F986, 4336, 1 },
+    { 0x2F987, 4337, 1 },
+    { 0x2F988, 4338, 1 },
+    { 0x2F989, 4339, 1 },
+    { 0x2F98A, 4340, 1 },
+    { 0x2F98B, 4341, 1 },
+    { 0x2F98C, 4342, 1 },
+    { 0x2F98D, 4343, 1 },
+    { 0x2F98E, 4344, 1 },
+    { 0x2F98F, 4345, 1 },
+    { 0x2F990, 4346, 1 },
+    { 0x2F991, 4347, 1 },
+    { 0x2F992, 4348, 1 },
+    { 0x2F993, 4349, 1 },
+    { 0x2F994, 4350, 1 },
+    { 0x2F995, 4351, 1 },
+    { 0x2F996, 4352, 1 },
+    { 0x2F997, 4353, 1 },
+    { 0x2F998, 4354, 1 },
+    { 0x2F999, 4355, 1 },
+    { 0x2F99A, 4356, 1 },
+    { 0x2F99B, 4357, 1 },
+    { 0x2F99C, 4358, 1 },
+    { 0x2F99D, 4359, 1 },
+    { 0x2F99E, 4360, 1 },
+    { 0x2F99F, 4361, 1 },
+    { 0x2F9A0, 4362, 1 },
+    { 0x2F9A1, 4363, 1 },
+    { 0x2F9A2, 4364, 1 },
+    { 0x2F9A3, 4365, 1 },
+    { 0x2F9A4, 4366, 1 },
+    { 0x2F9A5, 4367, 1 },
+    { 0x2F9A6, 4368, 1 },
+    { 0x2F9A7, 4369, 1 },
+    { 0x2F9A8, 4370, 1 },
+    { 0x2F9A9, 4371, 1 },
+    { 0x2F9AA, 4372, 1 },
+    { 0x2F9AB, 4373, 1 },
+    { 0x2F9AC, 4374, 1 },
+    { 0x2F9AD, 4375, 1 },
+    { 0x2F9AE, 4376, 1 },
+    { 0x2F9AF, 4377, 1 },
+    { 0x2F9B0, 4378, 1 },
+    { 0x2F9B1, 4379, 1 },
+    { 0x2F9B2, 4380, 1 },
+    { 0x2F9B3, 4381, 1 },
+    { 0x2F9B4, 4382, 1 },
+    { 0x2F9B5, 4383, 1 },
+    { 0x2F9B6, 4384, 1 },
+    { 0x2F9B7, 4385, 1 },
+    { 0x2F9B8, 4386, 1 },
+    { 0x2F9B9, 4387, 1 },
+    { 0x2F9BA, 4388, 1 },
+    { 0x2F9BB, 4389, 1 },
+    { 0x2F9BC, 4390, 1 },
+    { 0x2F9BD, 4391, 1 },
+    { 0x2F9BE, 4392, 1 },
+    { 0x2F9BF, 4393, 1 },
+    { 0x2F9C0, 4394, 1 },
+    { 0x2F9C1, 4395, 1 },
+    { 0x2F9C2, 4396, 1 },
+    { 0x2F9C3, 4397, 1 },
+    { 0x2F9C4, 4398, 1 },
+    { 0x2F9C5, 4399, 1 },
+    { 0x2F9C6, 4400, 1 },
+    { 0x2F9C7, 4401, 1 },
+    { 0x2F9C8, 4402, 1 },
+    { 0x2F9C9, 4403, 1 },
+    { 0x2F9CA, 4404, 1 },
+    { 0x2F9CB, 4405, 1 },
+    { 0x2F9CC, 4406, 1 },
+    { 0x2F9CD, 4407, 1 },
+    { 0x2F9CE, 4408, 1 },
+    { 0x2F9CF, 4409, 1 },
+    { 0x2F9D0, 4410, 1 },
+    { 0x2F9D1, 4411, 1 },
+    { 0x2F9D2, 4412, 1 },
+    { 0x2F9D3, 4413, 1 },
+    { 0x2F9D4, 4414, 1 },
+    { 0x2F9D5, 4415, 1 },
+    { 0x2F9D6, 4416, 1 },
+    { 0x2F9D7, 4417, 1 },
+    { 0x2F9D8, 4418, 1 },
+    { 0x2F9D9, 4419, 1 },
+    { 0x2F9DA, 4420, 1 },
+    { 0x2F9DB, 4421, 1 },
+    { 0x2F9DC, 4422, 1 },
+    { 0x2F9DD, 4423, 1 },
+    { 0x2F9DE, 4424, 1 },
+    { 0x2F9DF, 4425, 1 },
+    { 0x2F9E0, 4426, 1 },
+    { 0x2F9E1, 4427, 1 },
+    { 0x2F9E2, 4428, 1 },
+    { 0x2F9E3, 4429, 1 },
+    { 0x2F9E4, 4430, 1 },
+    { 0x2F9E5, 4431, 1 },
+    { 0x2F9E6, 4432, 1 },
+    { 0x2F9E7, 4433, 1 },
+    { 0x2F9E8, 4434, 1 },
+    { 0x2F9E9, 4435, 1 },
+    { 0x2F9EA, 4436, 1 },
+    { 0x2F9EB, 4437, 1 },
+    { 0x2F9EC, 4438, 1 },
+    { 0x2F9ED, 4439, 1 },
+    { 0x2F9EE, 4440, 1 },
+    { 0x2F9EF, 4441, 1 },
+    { 0x2F9F0, 4442, 1 },
+    { 0x2F9F1, 4443, 1 },
+    { 0x2F9F2, 4444, 1 },
+    { 0x2F9F3, 4445, 1 },
+    { 0x2F9F4, 4446, 1 },
+    { 0x2F9F5, 4447, 1 },
+    { 0x2F9F6, 4448, 1 },
+    { 0x2F9F7, 4449, 1 },
+    { 0x2F9F8, 4450, 1 },
+    { 0x2F9F9, 4451, 1 },
+    { 0x2F9FA, 4452, 1 },
+    { 0x2F9FB, 4453, 1 },
+    { 0x2F9FC, 4454, 1 },
+    { 0x2F9FD, 4455, 1 },
+    { 0x2F9FE, 4456, 1 },
+    { 0x2F9FF, 4457, 1 },
+    { 0x2FA00, 4458, 1 },
+    { 0x2FA01, 4459, 1 },
+    { 0x2FA02, 4460, 1 },
+    { 0x2FA03, 4461, 1 },
+    { 0x2FA04, 4462, 1 },
+    { 0x2FA05, 4463, 1 },
+    { 0x2FA06, 4464, 1 },
+    { 0x2FA07, 4465, 1 },
+    { 0x2FA08, 4466, 1 },
+    { 0x2FA09, 4467, 1 },
+    { 0x2FA0A, 4468, 1 },
+    { 0x2FA0B, 4469, 1 },
+    { 0x2FA0C, 4470, 1 },
+    { 0x2FA0D, 4471, 1 },
+    { 0x2FA0E, 4472, 1 },
+    { 0x2FA0F, 4473, 1 },
+    { 0x2FA10, 4474, 1 },
+    { 0x2FA11, 4475, 1 },
+    { 0x2FA12, 4476, 1 },
+    { 0x2FA13, 4477, 1 },
+    { 0x2FA14, 4478, 1 },
+    { 0x2FA15, 4479, 1 },
+    { 0x2FA16, 4480, 1 },
+    { 0x2FA17, 4481, 1 },
+    { 0x2FA18, 4482, 1 },
+    { 0x2FA19, 4483, 1 },
+    { 0x2FA1A, 4484, 1 },
+    { 0x2FA1B, 4485, 1 },
+    { 0x2FA1C, 4486, 1 },
+    { 0x2FA1D, 4487, 1 },
+};
+
+static const CccRange ccc_table[382] = {
+    { 0x0300, 0x0314, 230 },
+    { 0x0315, 0x0315, 232 },
+    { 0x0316, 0x0319, 220 },
+    { 0x031A, 0x031A, 232 },
+    { 0x031B, 0x031B, 216 },
+    { 0x031C, 0x0320, 220 },
+    { 0x0321, 0x0322, 202 },
+    { 0x0323, 0x0326, 220 },
+    { 0x0327, 0x0328, 202 },
+    { 0x0329, 0x0333, 220 },
+    { 0x0334, 0x0338, 1 },
+    { 0x0339, 0x033C, 220 },
+    { 0x033D, 0x0344, 230 },
+    { 0x0345, 0x0345, 240 },
+    { 0x0346, 0x0346, 230 },
+    { 0x0347, 0x0349, 220 },
+    { 0x034A, 0x034C, 230 },
+    { 0x034D, 0x034E, 220 },
+    { 0x0350, 0x0352, 230 },
+    { 0x0353, 0x0356, 220 },
+    { 0x0357, 0x0357, 230 },
+    { 0x0358, 0x0358, 232 },
+    { 0x0359, 0x035A, 220 },
+    { 0x035B, 0x035B, 230 },
+    { 0x035C, 0x035C, 233 },
+    { 0x035D, 0x035E, 234 },
+    { 0x035F, 0x035F, 233 },
+    { 0x0360, 0x0361, 234 },
+    { 0x0362, 0x0362, 233 },
+    { 0x0363, 0x036F, 230 },
+    { 0x0483, 0x0487, 230 },
+    { 0x0591, 0x0591, 220 },
+    { 0x0592, 0x0595, 230 },
+    { 0x0596, 0x0596, 220 },
+    { 0x0597, 0x0599, 230 },
+    { 0x059A, 0x059A, 222 },
+    { 0x059B, 0x059B, 220 },
+    { 0x059C, 0x05A1, 230 },
+    { 0x05A2, 0x05A7, 220 },
+    { 0x05A8, 0x05A9, 230 },
+    { 0x05AA, 0x05AA, 220 },
+    { 0x05AB, 0x05AC, 230 },
+    { 0x05AD, 0x05AD, 222 },
+    { 0x05AE, 0x05AE, 228 },
+    { 0x05AF, 0x05AF, 230 },
+    { 0x05B0, 0x05B0, 10 },
+    { 0x05B1, 0x05B1, 11 },
+    { 0x05B2, 0x05B2, 12 },
+    { 0x05B3, 0x05B3, 13 },
+    { 0x05B4, 0x05B4, 14 },
+    { 0x05B5, 0x05B5, 15 },
+    { 0x05B6, 0x05B6, 16 },
+    { 0x05B7, 0x05B7, 17 },
+    { 0x05B8, 0x05B8, 18 },
+    { 0x05B9, 0x05BA, 19 },
+    { 0x05BB, 0x05BB, 20 },
+    { 0x05BC, 0x05BC, 21 },
+    { 0x05BD, 0x05BD, 22 },
+    { 0x05BF, 0x05BF, 23 },
+    { 0x05C1, 0x05C1, 24 },
+    { 0x05C2, 0x05C2, 25 },
+    { 0x05C4, 0x05C4, 230 },
+    { 0x05C5, 0x05C5, 220 },
+    { 0x05C7, 0x05C7, 18 },
+    { 0x0610, 0x0617, 230 },
+    { 0x0618, 0x0618, 30 },
+    { 0x0619, 0x0619, 31 },
+    { 0x061A, 0x061A, 32 },
+    { 0x064B, 0x064B, 27 },
+    { 0x064C, 0x064C, 28 },
+    { 0x064D, 0x064D, 29 },
+    { 0x064E, 0x064E, 30 },
+    { 0x064F, 0x064F, 31 },
+    { 0x0650, 0x0650, 32 },
+    { 0x0651, 0x0651, 33 },
+    { 0x0652, 0x0652, 34 },
+    { 0x0653, 0x0654, 230 },
+    { 0x0655, 0x0656, 220 },
+    { 0x0657, 0x065B, 230 },
+    { 0x065C, 0x065C, 220 },
+    { 0x065D, 0x065E, 230 },
+    { 0x065F, 0x065F, 220 },
+    { 0x0670, 0x0670, 35 },
+    { 0x06D6, 0x06DC, 230 },
+    { 0x06DF, 0x06E2, 230 },
+    { 0x06E3, 0x06E3, 220 },
+    { 0x06E4, 0x06E4, 230 },
+    { 0x06E7, 0x06E8, 230 },
+    { 0x06EA, 0x06EA, 220 },
+    { 0x06EB, 0x06EC, 230 },
+    { 0x06ED, 0x06ED, 220 },
+    { 0x0711, 0x0711, 36 },
+    { 0x0730, 0x0730, 230 },
+    { 0x0731, 0x0731, 220 },
+    { 0x0732, 0x0733, 230 },
+    { 0x0734, 0x0734, 220 },
+    { 0x0735, 0x0736, 230 },
+    { 0x0737, 0x0739, 220 },
+    { 0x073A, 0x073A, 230 },
+    { 0x073B, 0x073C, 220 },
+    { 0x073D, 0x073D, 230 },
+    { 0x073E, 0x073E, 220 },
+    { 0x073F, 0x0741, 230 },
+    { 0x0742, 0x0742, 220 },
+    { 0x0743, 0x0743, 230 },
+    { 0x0744, 0x0744, 220 },
+    { 0x0745, 0x0745, 230 },
+    { 0x0746, 0x0746, 220 },
+    { 0x0747, 0x0747, 230 },
+    { 0x0748, 0x0748, 220 },
+    { 0x0749, 0x074A, 230 },
+    { 0x07EB, 0x07F1, 230 },
+    { 0x07F2, 0x07F2, 220 },
+    { 0x07F3, 0x07F3, 230 },
+    { 0x07FD, 0x07FD, 220 },
+    { 0x0816, 0x0819, 230 },
+    { 0x081B, 0x0823, 230 },
+    { 0x0825, 0x0827, 230 },
+    { 0x0829, 0x082D, 230 },
+    { 0x0859, 0x085B, 220 },
+    { 0x0898, 0x0898, 230 },
+    { 0x0899, 0x089B, 220 },
+    { 0x089C, 0x089F, 230 },
+    { 0x08CA, 0x08CE, 230 },
+    { 0x08CF, 0x08D3, 220 },
+    { 0x08D4, 0x08E1, 230 },
+    { 0x08E3, 0x08E3, 220 },
+    { 0x08E4, 0x08E5, 230 },
+    { 0x08E6, 0x08E6, 220 },
+    { 0x08E7, 0x08E8, 230 },
+    { 0x08E9, 0x08E9, 220 },
+    { 0x08EA, 0x08EC, 230 },
+    { 0x08ED, 0x08EF, 220 },
+    { 0x08F0, 0x08F0, 27 },
+    { 0x08F1, 0x08F1, 28 },
+    { 0x08F2, 0x08F2, 29 },
+    { 0x08F3, 0x08F5, 230 },
+    { 0x08F6, 0x08F6, 220 },
+    { 0x08F7, 0x08F8, 230 },
+    { 0x08F9, 0x08FA, 220 },
+    { 0x08FB, 0x08FF, 230 },
+    { 0x093C, 0x093C, 7 },
+    { 0x094D, 0x094D, 9 },
+    { 0x0951, 0x0951, 230 },
+    { 0x0952, 0x0952, 220 },
+    { 0x0953, 0x0954, 230 },
+    { 0x09BC, 0x09BC, 7 },
+    { 0x09CD, 0x09CD, 9 },
+    { 0x09FE, 0x09FE, 230 },
+    { 0x0A3C, 0x0A3C, 7 },
+    { 0x0A4D, 0x0A4D, 9 },
+    { 0x0ABC, 0x0ABC, 7 },
+    { 0x0ACD, 0x0ACD, 9 },
+    { 0x0B3C, 0x0B3C, 7 },
+    { 0x0B4D, 0x0B4D, 9 },
+    { 0x0BCD, 0x0BCD, 9 },
+    { 0x0C3C, 0x0C3C, 7 },
+    { 0x0C4D, 0x0C4D, 9 },
+    { 0x0C55, 0x0C55, 84 },
+    { 0x0C56, 0x0C56, 91 },
+    { 0x0CBC, 0x0CBC, 7 },
+    { 0x0CCD, 0x0CCD, 9 },
+    { 0x0D3B, 0x0D3C, 9 },
+    { 0x0D4D, 0x0D4D, 9 },
+    { 0x0DCA, 0x0DCA, 9 },
+    { 0x0E38, 0x0E39, 103 },
+    { 0x0E3A, 0x0E3A, 9 },
+    { 0x0E48, 0x0E4B, 107 },
+    { 0x0EB8, 0x0EB9, 118 },
+    { 0x0EBA, 0x0EBA, 9 },
+    { 0x0EC8, 0x0ECB, 122 },
+    { 0x0F18, 0x0F19, 220 },
+    { 0x0F35, 0x0F35, 220 },
+    { 0x0F37, 0x0F37, 220 },
+    { 0x0F39, 0x0F39, 216 },
+    { 0x0F71, 0x0F71, 129 },
+    { 0x0F72, 0x0F72, 130 },
+    { 0x0F74, 0x0F74, 132 },
+    { 0x0F7A, 0x0F7D, 130 },
+    { 0x0F80, 0x0F80, 130 },
+    { 0x0F82, 0x0F83, 230 },
+    { 0x0F84, 0x0F84, 9 },
+    { 0x0F86, 0x0F87, 230 },
+    { 0x0FC6, 0x0FC6, 220 },
+    { 0x1037, 0x1037, 7 },
+    { 0x1039, 0x103A, 9 },
+    { 0x108D, 0x108D, 220 },
+    { 0x135D, 0x135F, 230 },
+    { 0x1714, 0x1715, 9 },
+    { 0x1734, 0x1734, 9 },
+    { 0x17D2, 0x17D2, 9 },
+    { 0x17DD, 0x17DD, 230 },
+    { 0x18A9, 0x18A9, 228 },
+    { 0x1939, 0x1939, 222 },
+    { 0x193A, 0x193A, 230 },
+    { 0x193B, 0x193B, 220 },
+    { 0x1A17, 0x1A17, 230 },
+    { 0x1A18, 0x1A18, 220 },
+    { 0x1A60, 0x1A60, 9 },
+    { 0x1A75, 0x1A7C, 230 },
+    { 0x1A7F, 0x1A7F, 220 },
+    { 0x1AB0, 0x1AB4, 230 },
+    { 0x1AB5, 0x1ABA, 220 },
+    { 0x1ABB, 0x1ABC, 230 },
+    { 0x1ABD, 0x1ABD, 220 },
+    { 0x1ABF, 0x1AC0, 220 },
+    { 0x1AC1, 0x1AC2, 230 },
+    { 0x1AC3, 0x1AC4, 220 },
+    { 0x1AC5, 0x1AC9, 230 },
+    { 0x1ACA, 0x1ACA, 220 },
+    { 0x1ACB, 0x1ACE, 230 },
+    { 0x1B34, 0x1B34, 7 },
+    { 0x1B44, 0x1B44, 9 },
+    { 0x1B6B, 0x1B6B, 230 },
+    { 0x1B6C, 0x1B6C, 220 },
+    { 0x1B6D, 0x1B73, 230 },
+    { 0x1BAA, 0x1BAB, 9 },
+    { 0x1BE6, 0x1BE6, 7 },
+    { 0x1BF2, 0x1BF3, 9 },
+    { 0x1C37, 0x1C37, 7 },
+    { 0x1CD0, 0x1CD2, 230 },
+    { 0x1CD4, 0x1CD4, 1 },
+    { 0x1CD5, 0x1CD9, 220 },
+    { 0x1CDA, 0x1CDB, 230 },
+    { 0x1CDC, 0x1CDF, 220 },
+    { 0x1CE0, 0x1CE0, 230 },
+    { 0x1CE2, 0x1CE8, 1 },
+    { 0x1CED, 0x1CED, 220 },
+    { 0x1CF4, 0x1CF4, 230 },
+    { 0x1CF8, 0x1CF9, 230 },
+    { 0x1DC0, 0x1DC1, 230 },
+    { 0x1DC2, 0x1DC2, 220 },
+    { 0x1DC3, 0x1DC9, 230 },
+    { 0x1DCA, 0x1DCA, 220 },
+    { 0x1DCB, 0x1DCC, 230 },
+    { 0x1DCD, 0x1DCD, 234 },
+    { 0x1DCE, 0x1DCE, 214 },
+    { 0x1DCF, 0x1DCF, 220 },
+    { 0x1DD0, 0x1DD0, 202 },
+    { 0x1DD1, 0x1DF5, 230 },
+    { 0x1DF6, 0x1DF6, 232 },
+    { 0x1DF7, 0x1DF8, 228 },
+    { 0x1DF9, 0x1DF9, 220 },
+    { 0x1DFA, 0x1DFA, 218 },
+    { 0x1DFB, 0x1DFB, 230 },
+    { 0x1DFC, 0x1DFC, 233 },
+    { 0x1DFD, 0x1DFD, 220 },
+    { 0x1DFE, 0x1DFE, 230 },
+    { 0x1DFF, 0x1DFF, 220 },
+    { 0x20D0, 0x20D1, 230 },
+    { 0x20D2, 0x20D3, 1 },
+    { 0x20D4, 0x20D7, 230 },
+    { 0x20D8, 0x20DA, 1 },
+    { 0x20DB, 0x20DC, 230 },
+    { 0x20E1, 0x20E1, 230 },
+    { 0x20E5, 0x20E6, 1 },
+    { 0x20E7, 0x20E7, 230 },
+    { 0x20E8, 0x20E8, 220 },
+    { 0x20E9, 0x20E9, 230 },
+    { 0x20EA, 0x20EB, 1 },
+    { 0x20EC, 0x20EF, 220 },
+    { 0x20F0, 0x20F0, 230 },
+    { 0x2CEF, 0x2CF1, 230 },
+    { 0x2D7F, 0x2D7F, 9 },
+    { 0x2DE0, 0x2DFF, 230 },
+    { 0x302A, 0x302A, 218 },
+    { 0x302B, 0x302B, 228 },
+    { 0x302C, 0x302C, 232 },
+    { 0x302D, 0x302D, 222 },
+    { 0x302E, 0x302F, 224 },
+    { 0x3099, 0x309A, 8 },
+    { 0xA66F, 0xA66F, 230 },
+    { 0xA674, 0xA67D, 230 },
+    { 0xA69E, 0xA69F, 230 },
+    { 0xA6F0, 0xA6F1, 230 },
+    { 0xA806, 0xA806, 9 },
+    { 0xA82C, 0xA82C, 9 },
+    { 0xA8C4, 0xA8C4, 9 },
+    { 0xA8E0, 0xA8F1, 230 },
+    { 0xA92B, 0xA92D, 220 },
+    { 0xA953, 0xA953, 9 },
+    { 0xA9B3, 0xA9B3, 7 },
+    { 0xA9C0, 0xA9C0, 9 },
+    { 0xAAB0, 0xAAB0, 230 },
+    { 0xAAB2, 0xAAB3, 230 },
+    { 0xAAB4, 0xAAB4, 220 },
+    { 0xAAB7, 0xAAB8, 230 },
+    { 0xAABE, 0xAABF, 230 },
+    { 0xAAC1, 0xAAC1, 230 },
+    { 0xAAF6, 0xAAF6, 9 },
+    { 0xABED, 0xABED, 9 },
+    { 0xFB1E, 0xFB1E, 26 },
+    { 0xFE20, 0xFE26, 230 },
+    { 0xFE27, 0xFE2D, 220 },
+    { 0xFE2E, 0xFE2F, 230 },
+    { 0x101FD, 0x101FD, 220 },
+    { 0x102E0, 0x102E0, 220 },
+    { 0x10376, 0x1037A, 230 },
+    { 0x10A0D, 0x10A0D, 220 },
+    { 0x10A0F, 0x10A0F, 230 },
+    { 0x10A38, 0x10A38, 230 },
+    { 0x10A39, 0x10A39, 1 },
+    { 0x10A3A, 0x10A3A, 220 },
+    { 0x10A3F, 0x10A3F, 9 },
+    { 0x10AE5, 0x10AE5, 230 },
+    { 0x10AE6, 0x10AE6, 220 },
+    { 0x10D24, 0x10D27, 230 },
+    { 0x10EAB, 0x10EAC, 230 },
+    { 0x10F46, 0x10F47, 220 },
+    { 0x10F48, 0x10F4A, 230 },
+    { 0x10F4B, 0x10F4B, 220 },
+    { 0x10F4C, 0x10F4C, 230 },
+    { 0x10F4D, 0x10F50, 220 },
+    { 0x10F82, 0x10F82, 230 },
+    { 0x10F83, 0x10F83, 220 },
+    { 0x10F84, 0x10F84, 230 },
+    { 0x10F85, 0x10F85, 220 },
+    { 0x11046, 0x11046, 9 },
+    { 0x11070, 0x11070, 9 },
+    { 0x1107F, 0x1107F, 9 },
+    { 0x110B9, 0x110B9, 9 },
+    { 0x110BA, 0x110BA, 7 },
+    { 0x11100, 0x11102, 230 },
+    { 0x11133, 0x11134, 9 },
+    { 0x11173, 0x11173, 7 },
+    { 0x111C0, 0x111C0, 9 },
+    { 0x111CA, 0x111CA, 7 },
+    { 0x11235, 0x11235, 9 },
+    { 0x11236, 0x11236, 7 },
+    { 0x112E9, 0x112E9, 7 },
+    { 0x112EA, 0x112EA, 9 },
+    { 0x1133B, 0x1133C, 7 },
+    { 0x1134D, 0x1134D, 9 },
+    { 0x11366, 0x1136C, 230 },
+    { 0x11370, 0x11374, 230 },
+    { 0x11442, 0x11442, 9 },
+    { 0x11446, 0x11446, 7 },
+    { 0x1145E, 0x1145E, 230 },
+    { 0x114C2, 0x114C2, 9 },
+    { 0x114C3, 0x114C3, 7 },
+    { 0x115BF, 0x115BF, 9 },
+    { 0x115C0, 0x115C0, 7 },
+    { 0x1163F, 0x1163F, 9 },
+    { 0x116B6, 0x116B6, 9 },
+    { 0x116B7, 0x116B7, 7 },
+    { 0x1172B, 0x1172B, 9 },
+    { 0x11839, 0x11839, 9 },
+    { 0x1183A, 0x1183A, 7 },
+    { 0x1193D, 0x1193E, 9 },
+    { 0x11943, 0x11943, 7 },
+    { 0x119E0, 0x119E0, 9 },
+    { 0x11A34, 0x11A34, 9 },
+    { 0x11A47, 0x11A47, 9 },
+    { 0x11A99, 0x11A99, 9 },
+    { 0x11C3F, 0x11C3F, 9 },
+    { 0x11D42, 0x11D42, 7 },
+    { 0x11D44, 0x11D45, 9 },
+    { 0x11D97, 0x11D97, 9 },
+    { 0x16AF0, 0x16AF4, 1 },
+    { 0x16B30, 0x16B36, 230 },
+    { 0x16FF0, 0x16FF1, 6 },
+    { 0x1BC9E, 0x1BC9E, 1 },
+    { 0x1D165, 0x1D166, 216 },
+    { 0x1D167, 0x1D169, 1 },
+    { 0x1D16D, 0x1D16D, 226 },
+    { 0x1D16E, 0x1D172, 216 },
+    { 0x1D17B, 0x1D182, 220 },
+    { 0x1D185, 0x1D189, 230 },
+    { 0x1D18A, 0x1D18B, 220 },
+    { 0x1D1AA, 0x1D1AD, 230 },
+    { 0x1D242, 0x1D244, 230 },
+    { 0x1E000, 0x1E006, 230 },
+    { 0x1E008, 0x1E018, 230 },
+    { 0x1E01B, 0x1E021, 230 },
+    { 0x1E023, 0x1E024, 230 },
+    { 0x1E026, 0x1E02A, 230 },
+    { 0x1E130, 0x1E136, 230 },
+    { 0x1E2AE, 0x1E2AE, 230 },
+    { 0x1E2EC, 0x1E2EF, 230 },
+    { 0x1E8D0, 0x1E8D6, 220 },
+    { 0x1E944, 0x1E949, 230 },
+    { 0x1E94A, 0x1E94A, 7 },
+};
@@ -0,0 +1,330 @@
+/*
+ * walk.c - Parallel directory traversal with ordered output
+ * ---------------------------------------------------------
+ * The tree is discovered as it is walked: each visited directory hands back
+ * its subdirectories in display order, and those become children of its node.
+ * Workers pull pending nodes from a deque (children are pushed to the front,
+ * so the pool naturally works close to the depth-first frontier), while the
+ * calling thread follows the tree in pre-order and emits each node as soon as
+ * it is done.
+ *
+ * A node's output may be split at its children (walk_add_child_here()): the
+ * printer then emits the part before the first child, that child's subtree,
+ * the part up to the next child and so on, finishing the node's output on
+ * the way back up.  Unsplit output is emitted, and freed, in one piece.
+ *
+ * Memory accounting covers every live node plus all rendered-but-unprinted
+ * output.  While that total is under the cap the pool runs freely; above it,
+ * workers only accept the node the printer is currently waiting on.  Because
+ * that node is always runnable, the printer keeps draining the buffer and the
+ * pool resumes as soon as usage drops back under the cap.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "gls.h"
+#include "walk.h"
+#include "numa.h"
+
+enum { NODE_PENDING, NODE_RUNNING, NODE_DONE };
+
+struct WalkNode {
+    char *path;
+    int depth;
+    int state;
+    int index;                  // position within parent->children
+    int status;                 // visit() return value
+    WalkNode *parent;
+    WalkNode **children;
+    int child_count;
+    int child_capacity;
+    size_t split;               // where in parent->out this subtree goes
+    char *out;                  // rendered output, owned until emitted
+    size_t out_len;
+    size_t emitted;             // bytes of out already emitted
+    bool begun;                 // emit() has seen this node
+    void *data;                 // visitor payload, owned by emit()/leave()
+    size_t data_bytes;          // payload size charged against the cap
+    WalkNode *prev, *next;      // pending deque links
+};
+
+typedef struct {
+    const WalkConfig *cfg;
+    pthread_mutex_t lock;
+    pthread_cond_t work_cv;     // workers wait here for runnable nodes
+    pthread_cond_t done_cv;     // printer waits here for its head node
+    WalkNode *q_head, *q_tail;
+    WalkNode *out_head;         // node blocking the output stream
+    size_t mem_used;
+    bool stop;
+} Walker;
+
+typedef struct {
+    Walker *w;
+    int index;                  // spreads workers over NUMA nodes
+} WorkerArg;
+
+// ========================================
+// Node Helpers
+// ========================================
+
+static size_t node_charge(const WalkNode *node) {
+    return sizeof(WalkNode) + strlen(node->path) + 1 +
+           (size_t)node->child_capacity * sizeof(WalkNode *);
+}
+
+static WalkNode *new_node(WalkNode *parent, const char *path) {
+    WalkNode *node = xcalloc(1, sizeof(WalkNode));
+    node->path = xstrdup(path);
+    node->parent = parent;
+    node->depth = parent ? parent->depth + 1 : 0;
+    node->state = NODE_PENDING;
+    node->split = SIZE_MAX;
+    return node;
+}
+
+// Caller holds the lock; the node's children must already be freed.
+static void free_node(Walker *w, WalkNode *node) {
+    w->mem_used -= node_charge(node) + node->out_len;
+    free(node->out);
+    free(node->children);
+    free(node->path);
+    free(node);
+}
+
+const char *walk_node_path(const WalkNode *node) { return node->path; }
+int walk_node_depth(const WalkNode *node) { return node->depth; }
+WalkNode *walk_node_parent(const WalkNode *node) { return node->parent; }
+void *walk_node_data(const WalkNode *node) { return node->data; }
+void walk_node_set_data(WalkNode *node, void *data, size_t bytes) {
+    node->data = data;
+    node->data_bytes = bytes;
+}
+
+WalkNode *walk_add_child(WalkNode *parent, const char *path) {
+    if (parent->child_count >= parent->child_capacity) {
+        parent->child_capacity = parent->child_capacity ? parent->child_capacity * 2 : 8;
+        parent->children = xrealloc(parent->children,
+                                    (size_t)parent->child_capacity * sizeof(WalkNode *));
+    }
+    WalkNode *child = new_node(parent, path);
+    child->index = parent->child_count;
+    parent->children[parent->child_count++] = child;
+    return child;
+}
+
+WalkNode *walk_add_child_here(WalkNode *parent, const char *path, FILE *out) {
+    WalkNode *child = walk_add_child(parent, path);
+    fflush(out);
+    long pos = ftell(out);
+    child->split = pos > 0 ? (size_t)pos : 0;
+    return child;
+}
+
+// ========================================
+// Pending Deque (caller holds the lock)
+// ========================================
+
+static void queue_unlink(Walker *w, WalkNode *node) {
+    if (node->prev) node->prev->next = node->next;
+    else w->q_head = node->next;
+    if (node->next) node->next->prev = node->prev;
+    else w->q_tail = node->prev;
+    node->prev = node->next = NULL;
+}
+
+static void queue_push_front(Walker *w, WalkNode *node) {
+    node->prev = NULL;
+    node->next = w->q_head;
+    if (w->q_head) w->q_head->prev = node;
+    else w->q_tail = node;
+    w->q_head = node;
+}
+
+// Below the cap any pending node will do; above it, only the output head.
+static WalkNode *pick_node(Walker *w) {
+    if (w->mem_used < w->cfg->mem_limit) return w->q_head;
+    if (w->out_head && w->out_head->state == NODE_PENDING) return w->out_head;
+    return NULL;
+}
+
+// ========================================
+// Workers
+// ========================================
+
+static void *worker_main(void *arg) {
+    Walker *w = ((WorkerArg *)arg)->w;
+    const WalkConfig *cfg = w->cfg;
+
+    // Everything a worker allocates for a directory is first touched here,
+    // so pinning keeps each listing on the node that reads and sorts it.
+    numa_bind_worker(((WorkerArg *)arg)->index);
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+        WalkNode *node;
+        while (!w->stop && (node = pick_node(w)) == NULL)
+            pthread_cond_wait(&w->work_cv, &w->lock);
+        if (w->stop) break;
+
+        queue_unlink(w, node);
+        node->state = NODE_RUNNING;
+        pthread_mutex_unlock(&w->lock);
+
+        char *buf = NULL;
+        size_t len = 0;
+        FILE *out = open_memstream(&buf, &len);
+        if (!out) {
+            fprintf(stderr, "Fatal: Out of memory (open_memstream).\n");
+            exit(EXIT_FAILURE);
+        }
+        node->status = cfg->visit(node, out, cfg->ctx);
+        fclose(out);
+
+        pthread_mutex_lock(&w->lock);
+        node->out = buf;
+        node->out_len = len;
+        w->mem_used += len + node->data_bytes;
+        // Children go to the front in reverse so the first one runs next;
+        // this keeps the pool working just ahead of the printer.
+        for (int i = node->child_count - 1; i >= 0; i--) {
+            w->mem_used += node_charge(node->children[i]);
+            queue_push_front(w, node->children[i]);
+        }
+        w->mem_used += (size_t)node->child_capacity * sizeof(WalkNode *);
+        node->state = NODE_DONE;
+        if (node->child_count > 0) pthread_cond_broadcast(&w->work_cv);
+        if (node == w->out_head) pthread_cond_signal(&w->done_cv);
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+}
+
+// ========================================
+// Ordered Emission
+// ========================================
+
+// Emit the node's output up to `end` (clamped to its length).  The first
+// call always reaches emit(), even for a node with no output; the buffer is
+// released once it has been emitted in full.
+static void emit_node(Walker *w, WalkNode *node, size_t end) {
+    const WalkConfig *cfg = w->cfg;
+    bool first = !node->begun;
+
+    if (!first && !node->out) return;
+    if (end > node->out_len) end = node->out_len;
+    const char *buf = node->out ? node->out + node->emitted : "";
+    size_t len = end - node->emitted;
+    if (cfg->emit) {
+        if (first || len > 0) cfg->emit(node, buf, len, cfg->ctx);
+    } else if (len > 0) {
+        fwrite(buf, 1, len, stdout);
+    }
+    node->begun = true;
+    node->emitted = end;
+    if (end < node->out_len) return;
+
+    pthread_mutex_lock(&w->lock);
+    bool was_capped = w->mem_used >= cfg->mem_limit;
+    w->mem_used -= node->out_len + node->data_bytes;
+    node->data_bytes = 0;
+    free(node->out);
+    node->out = NULL;
+    node->out_len = 0;
+    if (was_capped && w->mem_used < cfg->mem_limit)
+        pthread_cond_broadcast(&w->work_cv);
+    pthread_mutex_unlock(&w->lock);
+}
+
+// Where the output of `node` stops for its child `i` (the end when it has
+// no such child or the child was not placed inside it).
+static size_t segment_end(const WalkNode *node, int i) {
+    return i < node->child_count ? node->children[i]->split : SIZE_MAX;
+}
+
+int walk_tree(const char *root_path, const WalkConfig *cfg) {
+    Walker w = { .cfg = cfg };
+    int result = 0;
+    int jobs = cfg->jobs > 0 ? cfg->jobs : 1;
+
+    pthread_mutex_init(&w.lock, NULL);
+    pthread_cond_init(&w.work_cv, NULL);
+    pthread_cond_init(&w.done_cv, NULL);
+
+    WalkNode *root = new_node(NULL, root_path);
+    w.mem_used = node_charge(root);
+    queue_push_front(&w, root);
+
+    pthread_t *threads = xcalloc((size_t)jobs, sizeof(pthread_t));
+    WorkerArg *args = xcalloc((size_t)jobs, sizeof(WorkerArg));
+    int started = 0;
+    for (; started < jobs; started++) {
+        args[started] = (WorkerArg){ &w, started };
+        if (pthread_create(&threads[started], NULL, worker_main, &args[started]) != 0) break;
+    }
+    if (started == 0) {
+        fprintf(stderr, "Fatal: Unable to start worker threads.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    WalkNode *cur = root;
+    while (cur) {
+        pthread_mutex_lock(&w.lock);
+        w.out_head = cur;
+        while (cur->state != NODE_DONE) {
+            // Jump the queue so the node holding up the output runs next.
+            if (cur->state == NODE_PENDING && w.q_head != cur) {
+                queue_unlink(&w, cur);
+                queue_push_front(&w, cur);
+            }
+            pthread_cond_broadcast(&w.work_cv);
+            pthread_cond_wait(&w.done_cv, &w.lock);
+        }
+        pthread_mutex_unlock(&w.lock);
+
+        if (cur->status != 0) result = 1;
+        emit_node(&w, cur, segment_end(cur, 0));
+
+        if (cur->child_count > 0) {
+            cur = cur->children[0];
+            continue;
+        }
+        // Leaf: finish and free completed subtrees on the way up, emitting
+        // each parent's output up to its next child.
+        while (cur) {
+            WalkNode *parent = cur->parent;
+            int next = cur->index + 1;
+            emit_node(&w, cur, SIZE_MAX);
+            if (cfg->leave) cfg->leave(cur, cfg->ctx);
+            pthread_mutex_lock(&w.lock);
+            free_node(&w, cur);
+            pthread_mutex_unlock(&w.lock);
+            if (!parent) {
+                cur = NULL;
+                break;
+            }
+            emit_node(&w, parent, segment_end(parent, next));
+            if (next < parent->child_count) {
+                cur = parent->children[next];
+                break;
+            }
+            cur = parent;
+        }
+    }
+
+    pthread_mutex_lock(&w.lock);
+    w.stop = true;
+    pthread_cond_broadcast(&w.work_cv);
+    pthread_mutex_unlock(&w.lock);
+    for (int i = 0; i < started; i++) pthread_join(threads[i], NULL);
+    free(threads);
+    free(args);
+
+    pthread_cond_destroy(&w.done_cv);
+    pthread_cond_destroy(&w.work_cv);
+    pthread_mutex_destroy(&w.lock);
+    return result;
+}
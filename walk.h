@@ -0,0 +1,61 @@
+#ifndef WALK_H
+#define WALK_H
+
+/*
+ * walk.h - Parallel directory traversal with ordered output
+ * ---------------------------------------------------------
+ * A pool of worker threads visits directories concurrently while the calling
+ * thread emits each directory's rendered output in depth-first order.  Output
+ * that is finished but not yet printable sits in a reorder buffer whose size
+ * is capped; once the cap is reached workers only pick up the directory that
+ * is blocking the output head, so memory stays bounded on any tree shape.
+ *
+ * A directory's output normally precedes all of its subdirectories'.  A
+ * visitor can instead place each subtree at a point inside its own output
+ * (walk_add_child_here()), which is how --tree nests children under their
+ * entry lines.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+
+typedef struct WalkNode WalkNode;
+
+typedef struct {
+    // Runs on a worker thread.  Render the directory into `out` and call
+    // walk_add_child() for each subdirectory, in the order it should print.
+    // Return non-zero to flag an error (the walk still continues).
+    int (*visit)(WalkNode *node, FILE *out, void *ctx);
+    // Runs on the calling thread, strictly in depth-first order.  NULL means
+    // the rendered bytes are written to stdout unchanged.  Called once per
+    // node, or once per segment for nodes split by walk_add_child_here().
+    void (*emit)(WalkNode *node, const char *buf, size_t len, void *ctx);
+    // Optional.  Runs on the calling thread once a node and its whole
+    // subtree have been emitted, children before parents; the parent's data
+    // is still valid, so totals can be folded upwards here.
+    void (*leave)(WalkNode *node, void *ctx);
+    void *ctx;
+    int jobs;               // worker threads (>= 1)
+    size_t mem_limit;       // reorder buffer cap in bytes
+} WalkConfig;
+
+// Accessors used by visitors
+const char *walk_node_path(const WalkNode *node);
+int walk_node_depth(const WalkNode *node);
+WalkNode *walk_node_parent(const WalkNode *node);      // NULL for the root
+void *walk_node_data(const WalkNode *node);
+// Attach a payload for emit() to consume; `bytes` is charged against the
+// reorder buffer cap until the node has been emitted.
+void walk_node_set_data(WalkNode *node, void *data, size_t bytes);
+
+// Queue a subdirectory of `parent`.  Only valid from inside visit().
+WalkNode *walk_add_child(WalkNode *parent, const char *path);
+// The same, but the child's subtree is emitted at the current end of `out`
+// (the visitor's stream) instead of after all of the parent's output.  Use
+// one form or the other for all children of a node.
+WalkNode *walk_add_child_here(WalkNode *parent, const char *path, FILE *out);
+
+// Walk the tree rooted at `root_path`.  Returns 0 if every visit succeeded.
+int walk_tree(const char *root_path, const WalkConfig *cfg);
+
+#endif
@@ -0,0 +1,692 @@
+/*
+ * where.c - Entry filter expressions for --where
+ * ----------------------------------------------
+ * The expression is parsed once into a tree whose tests already carry
+ * their final values: sizes are scaled, relative times are resolved
+ * against the start of the run, and `not` is pushed down into the tests
+ * (not size > 1G becomes size <= 1G), so only and/or nodes remain.
+ * Folding then flattens nested and/or, drops constants and tests that
+ * cannot fail, and the children of every and/or are reordered cheapest
+ * first: name and type tests, which need no stat, before the rest.
+ *
+ * The tree is compiled into a flat program of tests and short-circuit
+ * jumps, run once per entry.  A second program, with every stat-based test
+ * replaced by true, runs between readdir() and lstat(); whatever it
+ * rejects can never match, so those entries are never stat'ed at all.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <dirent.h>
+#include "gls.h"
+#include "pattern.h"
+#include "where.h"
+
+enum { F_NAME, F_TYPE, F_SIZE, F_MTIME, F_ATIME, F_CTIME, F_LINKS, F_UID, F_GID };
+enum { C_EQ, C_NE, C_LT, C_LE, C_GT, C_GE, C_MATCH, C_NOMATCH };
+enum { N_CONST, N_TEST, N_AND, N_OR };
+enum { I_TEST, I_CONST, I_JUMP_FALSE, I_JUMP_TRUE, I_END };
+
+static const struct {
+    const char *name;
+    bool needs_stat;
+} fields[] = {
+    [F_NAME] = { "name", false },   [F_TYPE] = { "type", false },
+    [F_SIZE] = { "size", true },    [F_MTIME] = { "mtime", true },
+    [F_ATIME] = { "atime", true },  [F_CTIME] = { "ctime", true },
+    [F_LINKS] = { "links", true },  [F_UID] = { "uid", true },
+    [F_GID] = { "gid", true },
+};
+
+typedef struct {
+    int field;
+    int cmp;
+    long long value;            // numbers, times, S_IF* type bits
+    char *text;                 // name: the text or pattern as written
+    Pattern *pat;               // name ~ and !~
+} Test;
+
+typedef struct Node {
+    int kind;
+    bool value;                 // N_CONST
+    Test *test;                 // N_TEST
+    struct Node **kids;         // N_AND, N_OR
+    int nkids;
+} Node;
+
+// One instruction.  Tests carry field, comparison and number inline;
+// name tests also point back at their text and pattern.
+typedef struct {
+    unsigned char op;
+    unsigned char field;
+    unsigned char cmp;
+    bool value;                 // I_CONST
+    int target;                 // jumps
+    long long num;
+    const Test *test;
+} Insn;
+
+typedef struct {
+    Insn *code;
+    int count;
+    int capacity;
+} Program;
+
+static struct {
+    bool enabled;
+    Program full;
+    Program pre;                // empty when the name/type tests decide nothing
+} where;
+
+bool where_enabled(void) {
+    return where.enabled;
+}
+
+// ========================================
+// Parsing
+// ========================================
+
+typedef struct {
+    const char *text;           // the whole expression, for messages
+    const char *p;
+    time_t now;
+    bool failed;
+} Parser;
+
+static void parse_error(Parser *ps, const char *what, const char *at) {
+    if (ps->failed) return;
+    ps->failed = true;
+    if (at && *at) fprintf(stderr, "Error: --where: %s at '%s'\n", what, at);
+    else fprintf(stderr, "Error: --where: %s at the end of '%s'\n", what, ps->text);
+}
+
+static Node *new_node(int kind) {
+    Node *n = xcalloc(1, sizeof(Node));
+    n->kind = kind;
+    return n;
+}
+
+static Node *new_const(bool value) {
+    Node *n = new_node(N_CONST);
+    n->value = value;
+    return n;
+}
+
+static void free_test(Test *t) {
+    free(t->text);
+    pattern_free(t->pat);
+    free(t);
+}
+
+// Frees the tests as well, unless the tree is a copy that shares them.
+static void free_tree(Node *n, bool tests) {
+    if (!n) return;
+    for (int i = 0; i < n->nkids; i++) free_tree(n->kids[i], tests);
+    free(n->kids);
+    if (tests && n->test) free_test(n->test);
+    free(n);
+}
+
+static void add_kid(Node *n, Node *kid) {
+    n->kids = xrealloc(n->kids, (size_t)(n->nkids + 1) * sizeof(Node *));
+    n->kids[n->nkids++] = kid;
+}
+
+static void skip_space(Parser *ps) {
+    while (isspace((unsigned char)*ps->p)) ps->p++;
+}
+
+static bool is_operator_char(char c) {
+    return c == '=' || c == '!' || c == '<' || c == '>' || c == '~';
+}
+
+// A bare word (up to a space, parenthesis or operator) or a quoted string.
+// Returns a new string, or NULL if there is none; `quoted` tells keywords
+// from values.
+static char *read_word(Parser *ps, bool *quoted) {
+    skip_space(ps);
+    const char *start = ps->p;
+    *quoted = *start == '\'' || *start == '"';
+    if (*quoted) {
+        const char *end = strchr(start + 1, *start);
+        if (!end) {
+            parse_error(ps, "unterminated quote", start);
+            return NULL;
+        }
+        ps->p = end + 1;
+        return strndup(start + 1, (size_t)(end - start - 1));
+    }
+    while (*ps->p && !isspace((unsigned char)*ps->p) && *ps->p != '(' && *ps->p != ')' &&
+           !is_operator_char(*ps->p))
+        ps->p++;
+    if (ps->p == start) return NULL;
+    return strndup(start, (size_t)(ps->p - start));
+}
+
+// Look at the next bare keyword without consuming it.
+static bool peek_keyword(Parser *ps, const char *word) {
+    skip_space(ps);
+    size_t len = strlen(word);
+    if (strncmp(ps->p, word, len) != 0) return false;
+    char next = ps->p[len];
+    return next == '\0' || isspace((unsigned char)next) || next == '(' || next == ')';
+}
+
+static bool accept_keyword(Parser *ps, const char *word) {
+    if (!peek_keyword(ps, word)) return false;
+    ps->p += strlen(word);
+    return true;
+}
+
+static int read_operator(Parser *ps) {
+    static const struct {
+        const char *text;
+        int cmp;
+    } ops[] = {
+        { "==", C_EQ }, { "!=", C_NE }, { "!~", C_NOMATCH }, { "<=", C_LE },
+        { ">=", C_GE }, { "=", C_EQ },  { "<", C_LT },       { ">", C_GT },
+        { "~", C_MATCH },
+    };
+    skip_space(ps);
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) {
+        size_t len = strlen(ops[i].text);
+        if (strncmp(ps->p, ops[i].text, len) == 0) {
+            ps->p += len;
+            return ops[i].cmp;
+        }
+    }
+    parse_error(ps, "expected =, !=, <, <=, >, >=, ~ or !~", ps->p);
+    return -1;
+}
+
+static bool parse_number(const char *s, long long *out, const char **end) {
+    char *e;
+    long long v = strtoll(s, &e, 10);
+    if (e == s) return false;
+    *out = v;
+    *end = e;
+    return true;
+}
+
+static bool parse_size_value(const char *s, long long *out) {
+    const char *e;
+    if (*s == '-' || !parse_number(s, out, &e)) return false;
+    const char *units = "KMGTP";
+    const char *u = *e ? strchr(units, toupper((unsigned char)*e)) : NULL;
+    if (u) {
+        for (const char *k = units; k <= u; k++) *out *= 1024;
+        e++;
+        if (*e == 'i') e++;
+    }
+    if (*e == 'B' || *e == 'b') e++;
+    return *e == '\0';
+}
+
+static bool parse_time_value(Parser *ps, const char *s, long long *out) {
+    struct tm tm = {0};
+    int n = 0;
+    if (sscanf(s, "%4d-%2d-%2d%n", &tm.tm_year, &tm.tm_mon, &tm.tm_mday, &n) == 3) {
+        const char *rest = s + n;
+        if (*rest == 'T' || *rest == ' ') {
+            n = 0;
+            if (sscanf(rest + 1, "%2d:%2d%n:%2d%n", &tm.tm_hour, &tm.tm_min, &n, &tm.tm_sec,
+                       &n) < 2)
+                return false;
+            rest += 1 + n;
+        }
+        if (*rest != '\0') return false;
+        tm.tm_year -= 1900;
+        tm.tm_mon -= 1;
+        tm.tm_isdst = -1;
+        *out = (long long)mktime(&tm);
+        return true;
+    }
+
+    static const struct {
+        char unit;
+        long long seconds;
+    } units[] = { { 's', 1 }, { 'm', 60 }, { 'h', 3600 }, { 'd', 86400 }, { 'w', 604800 } };
+    long long v;
+    const char *e;
+    if (!parse_number(s, &v, &e) || e[0] == '\0' || e[1] != '\0') return false;
+    for (size_t i = 0; i < sizeof(units) / sizeof(units[0]); i++) {
+        if (*e == units[i].unit) {
+            *out = (long long)ps->now + v * units[i].seconds;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_type_value(const char *s, long long *out) {
+    static const struct {
+        char letter;
+        long long mode;
+    } types[] = {
+        { 'f', S_IFREG }, { 'd', S_IFDIR }, { 'l', S_IFLNK }, { 'p', S_IFIFO },
+        { 's', S_IFSOCK }, { 'c', S_IFCHR }, { 'b', S_IFBLK },
+    };
+    for (size_t i = 0; s[0] && !s[1] && i < sizeof(types) / sizeof(types[0]); i++) {
+        if (types[i].letter == s[0]) {
+            *out = types[i].mode;
+            return true;
+        }
+    }
+    return false;
+}
+
+static Node *parse_test(Parser *ps) {
+    const char *at = (skip_space(ps), ps->p);
+    bool quoted;
+    char *word = read_word(ps, &quoted);
+    if (!word) {
+        parse_error(ps, "expected a test", at);
+        return NULL;
+    }
+    if (!quoted && (strcmp(word, "true") == 0 || strcmp(word, "false") == 0)) {
+        Node *n = new_const(word[0] == 't');
+        free(word);
+        return n;
+    }
+    int field = -1;
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+        if (!quoted && strcmp(word, fields[i].name) == 0) field = (int)i;
+    free(word);
+    if (field < 0) {
+        parse_error(ps, "unknown field", at);
+        return NULL;
+    }
+
+    const char *op_at = (skip_space(ps), ps->p);
+    int cmp = read_operator(ps);
+    if (cmp < 0) return NULL;
+    bool text_op = cmp == C_MATCH || cmp == C_NOMATCH;
+    if ((field == F_NAME && cmp != C_EQ && cmp != C_NE && !text_op) ||
+        (field == F_TYPE && cmp != C_EQ && cmp != C_NE) || (field > F_TYPE && text_op)) {
+        parse_error(ps, "operator does not apply to this field", op_at);
+        return NULL;
+    }
+
+    const char *value_at = (skip_space(ps), ps->p);
+    char *value = read_word(ps, &quoted);
+    if (!value) {
+        parse_error(ps, "expected a value", value_at);
+        return NULL;
+    }
+
+    Test *t = xcalloc(1, sizeof(Test));
+    t->field = field;
+    t->cmp = cmp;
+    bool ok = true;
+    const char *e;
+    switch (field) {
+        case F_NAME:
+            t->text = value;
+            value = NULL;
+            if (text_op) t->pat = pattern_compile(t->text, false);
+            break;
+        case F_TYPE:
+            ok = parse_type_value(value, &t->value);
+            break;
+        case F_SIZE:
+            ok = parse_size_value(value, &t->value);
+            break;
+        case F_MTIME:
+        case F_ATIME:
+        case F_CTIME:
+            ok = parse_time_value(ps, value, &t->value);
+            break;
+        default:
+            ok = parse_number(value, &t->value, &e) && *e == '\0';
+            break;
+    }
+    free(value);
+    if (!ok) {
+        parse_error(ps, "invalid value", value_at);
+        free_test(t);
+        return NULL;
+    }
+    Node *n = new_node(N_TEST);
+    n->test = t;
+    return n;
+}
+
+// Push a `not` down to the tests (De Morgan), so the tree stays and/or only.
+static void negate(Node *n) {
+    static const int inverse[] = {
+        [C_EQ] = C_NE, [C_NE] = C_EQ, [C_LT] = C_GE, [C_LE] = C_GT,
+        [C_GT] = C_LE, [C_GE] = C_LT, [C_MATCH] = C_NOMATCH, [C_NOMATCH] = C_MATCH,
+    };
+    switch (n->kind) {
+        case N_CONST: n->value = !n->value; break;
+        case N_TEST:  n->test->cmp = inverse[n->test->cmp]; break;
+        default:
+            n->kind = n->kind == N_AND ? N_OR : N_AND;
+            for (int i = 0; i < n->nkids; i++) negate(n->kids[i]);
+            break;
+    }
+}
+
+static Node *parse_or(Parser *ps);
+
+static Node *parse_unary(Parser *ps) {
+    if (accept_keyword(ps, "not")) {
+        Node *n = parse_unary(ps);
+        if (n) negate(n);
+        return n;
+    }
+    skip_space(ps);
+    if (*ps->p == '(') {
+        ps->p++;
+        Node *n = parse_or(ps);
+        if (!n) return NULL;
+        skip_space(ps);
+        if (*ps->p != ')') {
+            parse_error(ps, "expected )", ps->p);
+            free_tree(n, true);
+            return NULL;
+        }
+        ps->p++;
+        return n;
+    }
+    return parse_test(ps);
+}
+
+static Node *parse_binary(Parser *ps, int kind) {
+    const char *keyword = kind == N_OR ? "or" : "and";
+    Node *first = kind == N_OR ? parse_binary(ps, N_AND) : parse_unary(ps);
+    if (!first || !peek_keyword(ps, keyword)) return first;
+
+    Node *n = new_node(kind);
+    add_kid(n, first);
+    while (accept_keyword(ps, keyword)) {
+        Node *next = kind == N_OR ? parse_binary(ps, N_AND) : parse_unary(ps);
+        if (!next) {
+            free_tree(n, true);
+            return NULL;
+        }
+        add_kid(n, next);
+    }
+    return n;
+}
+
+static Node *parse_or(Parser *ps) {
+    return parse_binary(ps, N_OR);
+}
+
+// ========================================
+// Folding and Ordering
+// ========================================
+
+// A test that holds, or fails, for every entry: 1 or 0; -1 otherwise.
+static int test_constant(const Test *t) {
+    // Only a non-empty run of stars matches every name; "" matches none.
+    if (t->field == F_NAME && t->pat && t->text[0] == '*' &&
+        t->text[strspn(t->text, "*")] == '\0')
+        return t->cmp == C_MATCH;
+    if (t->field == F_SIZE || t->field == F_LINKS) {
+        // Never negative.
+        if ((t->cmp == C_GE && t->value <= 0) || (t->cmp == C_GT && t->value < 0)) return 1;
+        if ((t->cmp == C_LT && t->value <= 0) || (t->cmp == C_LE && t->value < 0)) return 0;
+    }
+    return -1;
+}
+
+static int cost(const Node *n) {
+    switch (n->kind) {
+        case N_CONST: return 0;
+        case N_TEST:
+            if (fields[n->test->field].needs_stat) return 100;
+            return n->test->pat ? 2 : 1;
+        default: {
+            int sum = 0;
+            for (int i = 0; i < n->nkids; i++) sum += cost(n->kids[i]);
+            return sum;
+        }
+    }
+}
+
+static bool needs_stat(const Node *n) {
+    if (n->kind == N_TEST) return fields[n->test->field].needs_stat;
+    for (int i = 0; i < n->nkids; i++)
+        if (needs_stat(n->kids[i])) return true;
+    return false;
+}
+
+// Children that need no stat first, then by cost; stable otherwise.
+static int order_key(const Node *n) {
+    return (needs_stat(n) ? 1 << 24 : 0) + cost(n);
+}
+
+static Node *fold(Node *n, bool tests) {
+    if (n->kind == N_TEST) {
+        int c = test_constant(n->test);
+        if (c < 0) return n;
+        free_tree(n, tests);
+        return new_const(c == 1);
+    }
+    if (n->kind == N_CONST) return n;
+
+    // and: true is the identity and false decides; or the other way round.
+    bool identity = n->kind == N_AND;
+    Node **kids = n->kids;
+    int nkids = n->nkids;
+    n->kids = NULL;
+    n->nkids = 0;
+    bool decided = false;
+    for (int i = 0; i < nkids; i++) {
+        Node *kid = decided ? kids[i] : fold(kids[i], tests);
+        if (decided) {
+            free_tree(kid, tests);
+        } else if (kid->kind == N_CONST) {
+            decided = kid->value != identity;
+            free(kid);
+        } else if (kid->kind == n->kind) {
+            for (int j = 0; j < kid->nkids; j++) add_kid(n, kid->kids[j]);
+            free(kid->kids);
+            free(kid);
+        } else {
+            add_kid(n, kid);
+        }
+    }
+    free(kids);
+    if (decided || n->nkids == 0) {
+        free_tree(n, tests);
+        return new_const(decided ? !identity : identity);
+    }
+    if (n->nkids == 1) {
+        Node *only = n->kids[0];
+        free(n->kids);
+        free(n);
+        return only;
+    }
+    for (int i = 1; i < n->nkids; i++) {
+        Node *kid = n->kids[i];
+        int key = order_key(kid), j = i;
+        for (; j > 0 && order_key(n->kids[j - 1]) > key; j--) n->kids[j] = n->kids[j - 1];
+        n->kids[j] = kid;
+    }
+    return n;
+}
+
+// The tree with every stat-based test assumed true; shares the tests.
+static Node *without_stat(const Node *n) {
+    Node *copy = new_node(n->kind);
+    copy->value = n->value;
+    copy->test = n->test;
+    if (n->kind == N_TEST && fields[n->test->field].needs_stat) {
+        copy->kind = N_CONST;
+        copy->value = true;
+        copy->test = NULL;
+    }
+    for (int i = 0; i < n->nkids; i++) add_kid(copy, without_stat(n->kids[i]));
+    return copy;
+}
+
+// ========================================
+// Compiling and Running
+// ========================================
+
+static int emit(Program *p, Insn insn) {
+    if (p->count == p->capacity) {
+        p->capacity = p->capacity ? p->capacity * 2 : 16;
+        p->code = xrealloc(p->code, (size_t)p->capacity * sizeof(Insn));
+    }
+    p->code[p->count] = insn;
+    return p->count++;
+}
+
+// Leaves the node's value in the accumulator.  and/or jump to their end
+// as soon as one child decides, with that child's value still in it.
+static void compile(Program *p, const Node *n) {
+    if (n->kind == N_CONST) {
+        emit(p, (Insn){ .op = I_CONST, .value = n->value });
+        return;
+    }
+    if (n->kind == N_TEST) {
+        const Test *t = n->test;
+        emit(p, (Insn){ .op = I_TEST, .field = (unsigned char)t->field,
+                        .cmp = (unsigned char)t->cmp, .num = t->value, .test = t });
+        return;
+    }
+    int *jumps = xmalloc((size_t)n->nkids * sizeof(int));
+    for (int i = 0; i < n->nkids; i++) {
+        compile(p, n->kids[i]);
+        if (i < n->nkids - 1)
+            jumps[i] = emit(p, (Insn){ .op = n->kind == N_AND ? I_JUMP_FALSE : I_JUMP_TRUE });
+    }
+    for (int i = 0; i < n->nkids - 1; i++) p->code[jumps[i]].target = p->count;
+    free(jumps);
+}
+
+static long long dtype_mode(unsigned char d_type) {
+    switch (d_type) {
+        case DT_REG:  return S_IFREG;
+        case DT_DIR:  return S_IFDIR;
+        case DT_LNK:  return S_IFLNK;
+        case DT_FIFO: return S_IFIFO;
+        case DT_SOCK: return S_IFSOCK;
+        case DT_CHR:  return S_IFCHR;
+        case DT_BLK:  return S_IFBLK;
+        default:      return 0;
+    }
+}
+
+static bool eval_test(const Insn *in, const FileEntry *fe, const char *name, bool have_stat) {
+    const struct stat *st = &fe->st;
+    long long v;
+    switch (in->field) {
+        case F_NAME:
+            if (in->test->pat) return pattern_match(in->test->pat, name) == (in->cmp == C_MATCH);
+            return (strcmp(name, in->test->text) == 0) == (in->cmp == C_EQ);
+        case F_TYPE:
+            if (have_stat) v = st->st_mode & S_IFMT;
+            else if ((v = dtype_mode(fe->d_type)) == 0) return true;   // known after the stat
+            break;
+        case F_SIZE:  v = (long long)st->st_size; break;
+        case F_MTIME: v = (long long)ST_MTIM(st).tv_sec; break;
+        case F_ATIME: v = (long long)ST_ATIM(st).tv_sec; break;
+        case F_CTIME: v = (long long)ST_CTIM(st).tv_sec; break;
+        case F_LINKS: v = (long long)st->st_nlink; break;
+        case F_UID:   v = (long long)st->st_uid; break;
+        default:      v = (long long)st->st_gid; break;
+    }
+    switch (in->cmp) {
+        case C_EQ: return v == in->num;
+        case C_NE: return v != in->num;
+        case C_LT: return v < in->num;
+        case C_LE: return v <= in->num;
+        case C_GT: return v > in->num;
+        default:   return v >= in->num;
+    }
+}
+
+static bool run(const Program *p, const FileEntry *fe, const char *name, bool have_stat) {
+    const Insn *code = p->code;
+    bool acc = true;
+    for (int pc = 0;;) {
+        const Insn *in = &code[pc];
+        switch (in->op) {
+            case I_TEST:       acc = eval_test(in, fe, name, have_stat); pc++; break;
+            case I_CONST:      acc = in->value; pc++; break;
+            case I_JUMP_FALSE: pc = acc ? pc + 1 : in->target; break;
+            case I_JUMP_TRUE:  pc = acc ? in->target : pc + 1; break;
+            default:           return acc;
+        }
+    }
+}
+
+// ========================================
+// Public Interface
+// ========================================
+
+int where_init(const Options *opts) {
+    if (!opts->where) return 0;
+    if (opts->duplicates || opts->collisions || opts->compare || opts->check_names ||
+        opts->tree || opts->query) {
+        fprintf(stderr, "Error: --where applies to plain, -R and --merge listings only\n");
+        return 1;
+    }
+
+    Parser ps = { .text = opts->where, .p = opts->where, .now = time(NULL) };
+    Node *tree = parse_or(&ps);
+    skip_space(&ps);
+    if (tree && *ps.p) parse_error(&ps, "unexpected text", ps.p);
+    if (ps.failed) {
+        free_tree(tree, true);
+        return 1;
+    }
+    tree = fold(tree, true);
+    compile(&where.full, tree);
+    emit(&where.full, (Insn){ .op = I_END });
+
+    Node *pre = fold(without_stat(tree), false);
+    if (!(pre->kind == N_CONST && pre->value)) {
+        compile(&where.pre, pre);
+        emit(&where.pre, (Insn){ .op = I_END });
+    }
+    free_tree(pre, false);
+    // The programs point into the tests, which live for the whole run.
+    free_tree(tree, false);
+    where.enabled = true;
+    return 0;
+}
+
+void where_prefilter(DirListing *list, bool keep_dirs) {
+    if (!where.enabled || where.pre.count == 0) return;
+    int kept = 0;
+    for (int i = 0; i < list->count; i++) {
+        FileEntry *fe = &list->entries[i];
+        bool maybe_dir = fe->d_type == DT_DIR || fe->d_type == DT_UNKNOWN;
+        if ((keep_dirs && maybe_dir) || run(&where.pre, fe, fe->name, false))
+            list->entries[kept++] = *fe;
+        else
+            free(fe->name);
+    }
+    list->count = kept;
+}
+
+void where_apply(DirListing *list) {
+    if (!where.enabled) return;
+    int kept = 0;
+    list->total_blocks = 0;
+    for (int i = 0; i < list->count; i++) {
+        FileEntry *fe = &list->entries[i];
+        if (run(&where.full, fe, fe->name, true)) {
+            list->total_blocks += fe->st.st_blocks;
+            list->entries[kept++] = *fe;
+        } else {
+            free(fe->name);
+        }
+    }
+    list->count = kept;
+}
+
+bool where_match(const FileEntry *fe) {
+    if (!where.enabled) return true;
+    const char *slash = strrchr(fe->name, '/');
+    return run(&where.full, fe, slash && slash[1] ? slash + 1 : fe->name, true);
+}
@@ -0,0 +1,45 @@
+#ifndef WHERE_H
+#define WHERE_H
+
+/*
+ * where.h - Entry filter expressions for --where
+ * ----------------------------------------------
+ * --where=EXPR lists only the entries EXPR holds for, for example
+ *
+ *     --where="size > 1G and mtime < -30d and not name ~ '*.keep'"
+ *
+ * A test is FIELD OP VALUE:
+ *   name                 = != ~ !~       text, or a wildcard pattern for ~
+ *   type                 = !=            f d l p s c b
+ *   size                 = != < <= > >=  bytes; K M G T P suffixes are 1024-based
+ *   mtime atime ctime    = != < <= > >=  [+-]N with s m h d w, relative to now
+ *                                        (-30d is 30 days ago), or YYYY-MM-DD
+ *                                        [THH:MM[:SS]] in local time
+ *   links uid gid        = != < <= > >=  numbers
+ * Tests combine with not, and, or (and binds tighter) and parentheses;
+ * true and false are constants.  Values with spaces or operator characters
+ * are quoted with ' or ".  With -R, directories that fail the test are not
+ * listed but are still descended into.
+ */
+
+#include <stdbool.h>
+#include "gls.h"
+
+// Compile opts->where.  Returns non-zero (after printing why) if it does
+// not parse or cannot be used with the other options.
+int where_init(const Options *opts);
+bool where_enabled(void);
+
+// Before the stat batch: drop entries that the name and type tests alone
+// already rule out.  With `keep_dirs` (-R) possible directories are kept
+// for descending.  No-op without --where.
+void where_prefilter(DirListing *list, bool keep_dirs);
+
+// After the stat batch: drop entries that do not match and recompute the
+// block total.  No-op without --where.
+void where_apply(DirListing *list);
+
+// One stat'ed entry named on its own; `name` tests see its last component.
+bool where_match(const FileEntry *fe);
+
+#endif
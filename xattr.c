@@ -0,0 +1,149 @@
+/*
+ * xattr.c - Extended attribute / ACL indicator for --xattrs
+ * ---------------------------------------------------------
+ * One llistxattr() with a zero-sized buffer answers the common case (no
+ * attributes) in a single call; only entries that have some are asked for
+ * their names, to tell an ACL from a security label from anything else.
+ * POSIX ACLs and SELinux labels are themselves xattrs on Linux.  On macOS
+ * ACLs are not, so they are checked separately.
+ *
+ * A filesystem without xattr support answers ENOTSUP.  Its device number is
+ * then remembered and no entry on it is queried again for the rest of the
+ * run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/xattr.h>
+#ifdef __APPLE__
+#include <sys/acl.h>
+#endif
+#include "gls.h"
+#include "backend.h"
+#include "xattr.h"
+
+#ifndef ENOTSUP
+#define ENOTSUP EOPNOTSUPP
+#endif
+
+#define MAX_BARE_DEVS 64
+
+static bool enabled = false;
+
+// Devices known to lack xattr support.
+static dev_t bare_devs[MAX_BARE_DEVS];
+static int bare_count = 0;
+static pthread_mutex_t bare_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void xattr_init(const Options *opts) {
+    enabled = opts->xattrs;
+}
+
+bool xattr_enabled(void) {
+    return enabled;
+}
+
+static bool dev_is_bare(dev_t dev) {
+    bool bare = false;
+    pthread_mutex_lock(&bare_lock);
+    for (int i = 0; i < bare_count && !bare; i++) bare = bare_devs[i] == dev;
+    pthread_mutex_unlock(&bare_lock);
+    return bare;
+}
+
+static void mark_bare(dev_t dev) {
+    pthread_mutex_lock(&bare_lock);
+    bool known = false;
+    for (int i = 0; i < bare_count && !known; i++) known = bare_devs[i] == dev;
+    if (!known && bare_count < MAX_BARE_DEVS) bare_devs[bare_count++] = dev;
+    pthread_mutex_unlock(&bare_lock);
+}
+
+static ssize_t list_names(const char *path, char *buf, size_t len) {
+#ifdef __APPLE__
+    return listxattr(path, buf, len, XATTR_NOFOLLOW);
+#else
+    return llistxattr(path, buf, len);
+#endif
+}
+
+// Classify an entry; sets *unsupported if its filesystem has no xattrs.
+static char classify(const char *path, bool *unsupported) {
+#ifdef __APPLE__
+    acl_t acl = acl_get_link_np(path, ACL_TYPE_EXTENDED);
+    if (acl) {
+        acl_free(acl);
+        return '+';
+    }
+#endif
+    ssize_t len = list_names(path, NULL, 0);
+    if (len < 0) {
+        if (errno == ENOTSUP) *unsupported = true;
+        return ' ';
+    }
+    if (len == 0) return ' ';
+
+    char *names = xmalloc((size_t)len);
+    len = list_names(path, names, (size_t)len);
+    if (len < 0) {
+        // Attributes were added in between (ERANGE); all we know is "some".
+        free(names);
+        return '@';
+    }
+    char indicator = '@';
+    for (ssize_t off = 0; off < len; off += (ssize_t)strlen(names + off) + 1) {
+        const char *name = names + off;
+        if (strncmp(name, "system.posix_acl_", 17) == 0 || strcmp(name, "system.nfs4_acl") == 0) {
+            indicator = '+';
+            break;
+        }
+        if (strcmp(name, "security.selinux") == 0) indicator = '.';
+    }
+    free(names);
+    return indicator;
+}
+
+char xattr_indicator(const char *path, const struct stat *st) {
+    if (!enabled) return '\0';
+    if (!backend_is_fs() || dev_is_bare(st->st_dev)) return ' ';
+
+    bool unsupported = false;
+    char indicator = classify(path, &unsupported);
+    if (unsupported) mark_bare(st->st_dev);
+    return indicator;
+}
+
+void xattr_batch(const char *dir, FileEntry *entries, const bool *ok, int count) {
+    bool fs = backend_is_fs();
+    // Entries of one directory nearly always share a device, so the shared
+    // table is consulted once per device change rather than per entry.
+    dev_t last_dev = 0;
+    bool have_last = false, last_bare = false;
+
+    for (int i = 0; i < count; i++) {
+        FileEntry *fe = &entries[i];
+        if (ok && !ok[i]) continue;
+        fe->xattr = ' ';
+        if (!fs) continue;
+
+        if (!have_last || fe->st.st_dev != last_dev) {
+            last_dev = fe->st.st_dev;
+            last_bare = dev_is_bare(last_dev);
+            have_last = true;
+        }
+        if (last_bare) continue;
+
+        char path[PATH_MAX];
+        bool unsupported = false;
+        join_path(path, sizeof(path), dir, fe->name);
+        fe->xattr = classify(path, &unsupported);
+        if (unsupported) {
+            mark_bare(last_dev);
+            last_bare = true;
+        }
+    }
+}
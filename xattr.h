@@ -0,0 +1,29 @@
+#ifndef XATTR_H
+#define XATTR_H
+
+/*
+ * xattr.h - Extended attribute / ACL indicator for --xattrs
+ * ---------------------------------------------------------
+ * With --xattrs the permissions column gains one character, as in GNU and
+ * BSD ls: '+' for an access control list, '.' for a security context only,
+ * '@' for any other extended attributes, ' ' for none.  Without the option
+ * nothing is queried and the column is not printed.
+ */
+
+#include <stdbool.h>
+#include <sys/stat.h>
+#include "gls.h"
+
+// Read --xattrs.  Call once, before any listing starts.
+void xattr_init(const Options *opts);
+bool xattr_enabled(void);
+
+// Indicator for one path (never followed); '\0' when the column is off.
+char xattr_indicator(const char *path, const struct stat *st);
+
+// Fill `xattr` of the entries of `dir` whose `ok` flag is set (all of them
+// when `ok` is NULL).  Done right after each stat batch, from the same
+// worker; a filesystem that reports no xattr support is never asked again.
+void xattr_batch(const char *dir, FileEntry *entries, const bool *ok, int count);
+
+#endif